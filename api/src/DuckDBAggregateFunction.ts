@@ -0,0 +1,222 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBAggregateFunctionInfo } from './DuckDBAggregateFunctionInfo';
+import { DuckDBDataChunk } from './DuckDBDataChunk';
+import { DuckDBType } from './DuckDBType';
+import { DuckDBVector } from './DuckDBVector';
+import { DuckDBValue } from './values';
+
+/**
+ * The states of the rows of one input chunk. Rows in the same group share a
+ * state. States that have not been set yet are created with `initState`.
+ */
+export class DuckDBAggregateStates<TState> {
+  private readonly stateIds: Float64Array;
+  private readonly states: Map<number, TState>;
+  private readonly initState: () => TState;
+  constructor(
+    stateIds: Float64Array,
+    states: Map<number, TState>,
+    initState: () => TState,
+  ) {
+    this.stateIds = stateIds;
+    this.states = states;
+    this.initState = initState;
+  }
+  public get rowCount(): number {
+    return this.stateIds.length;
+  }
+  public get(rowIndex: number): TState {
+    return getState(this.states, this.stateIds[rowIndex], this.initState);
+  }
+  public set(rowIndex: number, state: TState) {
+    this.states.set(this.stateIds[rowIndex], state);
+  }
+}
+
+/**
+ * Called once per input chunk, with the states of all its rows. Mutate the
+ * states in place, or replace them with `states.set`. May return a promise,
+ * which the query waits for.
+ */
+export type DuckDBAggregateUpdateFunction<TState> = (
+  functionInfo: DuckDBAggregateFunctionInfo,
+  inputDataChunk: DuckDBDataChunk,
+  states: DuckDBAggregateStates<TState>,
+) => void | Promise<void>;
+
+/**
+ * Merges `source` into `target`, and returns the merged state, which can be
+ * `target` itself. DuckDB combines partial results computed by different
+ * threads; the calls from all threads run one batch at a time on the main
+ * thread.
+ */
+export type DuckDBAggregateCombineFunction<TState> = (
+  functionInfo: DuckDBAggregateFunctionInfo,
+  source: TState,
+  target: TState,
+) => TState;
+
+export type DuckDBAggregateFinalizeFunction<TState> = (
+  functionInfo: DuckDBAggregateFunctionInfo,
+  state: TState,
+) => DuckDBValue;
+
+/**
+ * An aggregate function whose states are JS values.
+ *
+ * DuckDB holds only a numeric id for each state; the states themselves live in
+ * a map owned by this object, and are removed from it once DuckDB destroys
+ * them.
+ */
+export class DuckDBAggregateFunction<TState = unknown> {
+  readonly aggregate_function: duckdb.AggregateFunction;
+  private readonly states = new Map<number, TState>();
+
+  public constructor() {
+    this.aggregate_function = duckdb.create_aggregate_function();
+    duckdb.aggregate_function_set_destructor(
+      this.aggregate_function,
+      (stateIds) => {
+        for (const stateId of stateIds) {
+          this.states.delete(stateId);
+        }
+      },
+    );
+  }
+
+  public static create<TState>({
+    name,
+    returnType,
+    parameterTypes,
+    initState,
+    update,
+    combine,
+    finalize,
+    specialHandling,
+    extraInfo,
+  }: {
+    name: string;
+    returnType: DuckDBType;
+    parameterTypes?: readonly DuckDBType[];
+    initState: () => TState;
+    update: DuckDBAggregateUpdateFunction<TState>;
+    combine: DuckDBAggregateCombineFunction<TState>;
+    finalize: DuckDBAggregateFinalizeFunction<TState>;
+    specialHandling?: boolean;
+    extraInfo?: object;
+  }): DuckDBAggregateFunction<TState> {
+    const aggregateFunction = new DuckDBAggregateFunction<TState>();
+    aggregateFunction.setName(name);
+    aggregateFunction.setReturnType(returnType);
+    if (parameterTypes) {
+      for (const parameterType of parameterTypes) {
+        aggregateFunction.addParameter(parameterType);
+      }
+    }
+    aggregateFunction.setFunctions({ initState, update, combine, finalize });
+    if (specialHandling) {
+      aggregateFunction.setSpecialHandling();
+    }
+    if (extraInfo) {
+      aggregateFunction.setExtraInfo(extraInfo);
+    }
+    return aggregateFunction;
+  }
+
+  public destroySync() {
+    duckdb.destroy_aggregate_function_sync(this.aggregate_function);
+  }
+
+  public setName(name: string) {
+    duckdb.aggregate_function_set_name(this.aggregate_function, name);
+  }
+
+  public setReturnType(returnType: DuckDBType) {
+    duckdb.aggregate_function_set_return_type(
+      this.aggregate_function,
+      returnType.toLogicalType().logical_type,
+    );
+  }
+
+  public addParameter(parameterType: DuckDBType) {
+    duckdb.aggregate_function_add_parameter(
+      this.aggregate_function,
+      parameterType.toLogicalType().logical_type,
+    );
+  }
+
+  public setFunctions({
+    initState,
+    update,
+    combine,
+    finalize,
+  }: {
+    initState: () => TState;
+    update: DuckDBAggregateUpdateFunction<TState>;
+    combine: DuckDBAggregateCombineFunction<TState>;
+    finalize: DuckDBAggregateFinalizeFunction<TState>;
+  }) {
+    const states = this.states;
+    duckdb.aggregate_function_set_functions(
+      this.aggregate_function,
+      (info, input, stateIds) =>
+        update(
+          new DuckDBAggregateFunctionInfo(info),
+          new DuckDBDataChunk(input),
+          new DuckDBAggregateStates(stateIds, states, initState),
+        ),
+      (info, sourceStateIds, targetStateIds) => {
+        const functionInfo = new DuckDBAggregateFunctionInfo(info);
+        for (let i = 0; i < sourceStateIds.length; i++) {
+          const targetStateId = targetStateIds[i];
+          states.set(
+            targetStateId,
+            combine(
+              functionInfo,
+              getState(states, sourceStateIds[i], initState),
+              getState(states, targetStateId, initState),
+            ),
+          );
+        }
+      },
+      (info, stateIds, output, offset) => {
+        const functionInfo = new DuckDBAggregateFunctionInfo(info);
+        const outputVector = DuckDBVector.create(
+          output,
+          offset + stateIds.length,
+        );
+        for (let i = 0; i < stateIds.length; i++) {
+          outputVector.setItem(
+            offset + i,
+            finalize(functionInfo, getState(states, stateIds[i], initState)),
+          );
+        }
+        outputVector.flush();
+      },
+    );
+  }
+
+  public setSpecialHandling() {
+    duckdb.aggregate_function_set_special_handling(this.aggregate_function);
+  }
+
+  public setExtraInfo(extraInfo: object) {
+    duckdb.aggregate_function_set_extra_info(
+      this.aggregate_function,
+      extraInfo,
+    );
+  }
+}
+
+function getState<TState>(
+  states: Map<number, TState>,
+  stateId: number,
+  initState: () => TState,
+): TState {
+  let state = states.get(stateId);
+  if (state === undefined) {
+    state = initState();
+    states.set(stateId, state);
+  }
+  return state;
+}
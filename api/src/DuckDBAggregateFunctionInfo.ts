@@ -0,0 +1,17 @@
+import duckdb from '@duckdb/node-bindings';
+
+export class DuckDBAggregateFunctionInfo {
+  private readonly function_info: duckdb.AggregateFunctionInfo;
+  constructor(function_info: duckdb.AggregateFunctionInfo) {
+    this.function_info = function_info;
+  }
+  public get extraInfo(): object | undefined {
+    return this.getExtraInfo();
+  }
+  public getExtraInfo(): object | undefined {
+    return duckdb.aggregate_function_get_extra_info(this.function_info);
+  }
+  public setError(error: string) {
+    duckdb.aggregate_function_set_error(this.function_info, error);
+  }
+}
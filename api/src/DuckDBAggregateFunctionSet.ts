@@ -0,0 +1,30 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBAggregateFunction } from './DuckDBAggregateFunction';
+
+/** Overloads of one aggregate function, registered together under one name. */
+export class DuckDBAggregateFunctionSet {
+  readonly aggregate_function_set: duckdb.AggregateFunctionSet;
+
+  public constructor(name: string) {
+    this.aggregate_function_set = duckdb.create_aggregate_function_set(name);
+  }
+
+  public static create(
+    name: string,
+    aggregateFunctions: readonly DuckDBAggregateFunction[],
+  ): DuckDBAggregateFunctionSet {
+    const aggregateFunctionSet = new DuckDBAggregateFunctionSet(name);
+    for (const aggregateFunction of aggregateFunctions) {
+      aggregateFunctionSet.add(aggregateFunction);
+    }
+    return aggregateFunctionSet;
+  }
+
+  /** The function's name must match the set's. */
+  public add(aggregateFunction: DuckDBAggregateFunction) {
+    duckdb.add_aggregate_function_to_set(
+      this.aggregate_function_set,
+      aggregateFunction.aggregate_function,
+    );
+  }
+}
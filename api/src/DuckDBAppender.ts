@@ -3,6 +3,7 @@ import { createValue } from './createValue';
 import { DuckDBConnection } from './DuckDBConnection';
 import { DuckDBDataChunk } from './DuckDBDataChunk';
 import { DuckDBLogicalType } from './DuckDBLogicalType';
+import { ErrorType } from './enums';
 import {
   BIGNUM,
   BIT,
@@ -48,6 +49,11 @@ import {
   structValue,
 } from './values';
 
+export interface DuckDBAppenderErrorData {
+  errorType: ErrorType;
+  message: string;
+}
+
 export class DuckDBAppender {
   public readonly connection: DuckDBConnection;
   private readonly appender: duckdb.Appender;
@@ -61,6 +67,25 @@ export class DuckDBAppender {
   public flushSync() {
     duckdb.appender_flush_sync(this.appender);
   }
+  /**
+   * Discards all rows appended since the last successful flush, leaving the
+   * appender usable. After a failed flush, this drops the bad batch so that
+   * appending can continue with the same appender.
+   */
+  public clear() {
+    duckdb.appender_clear(this.appender);
+  }
+  /** The error of the most recent failed operation, or null if none. */
+  public get errorData(): DuckDBAppenderErrorData | null {
+    const errorData = duckdb.appender_error_data(this.appender);
+    if (!duckdb.error_data_has_error(errorData)) {
+      return null;
+    }
+    return {
+      errorType: duckdb.error_data_error_type(errorData),
+      message: duckdb.error_data_message(errorData),
+    };
+  }
   public get columnCount(): number {
     return duckdb.appender_column_count(this.appender);
   }
@@ -69,12 +94,45 @@ export class DuckDBAppender {
       duckdb.appender_column_type(this.appender, columnIndex)
     ).asType();
   }
+  /**
+   * Makes the given column active. Once any column is active, rows contain
+   * only the active columns (in the order added) and the remaining columns
+   * of the table are filled with their default values.
+   */
+  public addColumn(columnName: string) {
+    duckdb.appender_add_column(this.appender, columnName);
+  }
+  public addColumns(columnNames: readonly string[]) {
+    for (const columnName of columnNames) {
+      duckdb.appender_add_column(this.appender, columnName);
+    }
+  }
+  /** Makes all columns of the table active again. */
+  public clearColumns() {
+    duckdb.appender_clear_columns(this.appender);
+  }
   public endRow() {
     duckdb.appender_end_row(this.appender);
   }
   public appendDefault() {
     duckdb.append_default(this.appender);
   }
+  /**
+   * Writes the default value of the given column into the given row of the
+   * data chunk, which must have been created with the appender's column types.
+   */
+  public appendDefaultToChunk(
+    dataChunk: DuckDBDataChunk,
+    columnIndex: number,
+    rowIndex: number
+  ) {
+    duckdb.append_default_to_chunk(
+      this.appender,
+      dataChunk.chunk,
+      columnIndex,
+      rowIndex
+    );
+  }
   public appendBoolean(value: boolean) {
     duckdb.append_bool(this.appender, value);
   }
@@ -0,0 +1,106 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBCastFunctionInfo } from './DuckDBCastFunctionInfo';
+import { DuckDBNativeLibrary } from './DuckDBNativeLibrary';
+import { DuckDBType } from './DuckDBType';
+import { DuckDBVector } from './DuckDBVector';
+
+/**
+ * Called once per chunk with whole input and output vectors. Returning false
+ * fails the cast, as does throwing. May return a promise, which the query
+ * waits for.
+ */
+export type DuckDBCastMainFunction = (
+  functionInfo: DuckDBCastFunctionInfo,
+  inputVector: DuckDBVector,
+  outputVector: DuckDBVector,
+) => boolean | void | Promise<boolean | void>;
+
+export class DuckDBCastFunction {
+  readonly cast_function: duckdb.CastFunction;
+
+  public constructor() {
+    this.cast_function = duckdb.create_cast_function();
+  }
+
+  public static create({
+    sourceType,
+    targetType,
+    mainFunction,
+    implicitCastCost,
+    extraInfo,
+  }: {
+    sourceType: DuckDBType;
+    targetType: DuckDBType;
+    mainFunction: DuckDBCastMainFunction;
+    /**
+     * Allows DuckDB to apply the cast implicitly, preferring casts of lower
+     * cost. Without it, the cast is applied only when written explicitly.
+     */
+    implicitCastCost?: number;
+    extraInfo?: object;
+  }): DuckDBCastFunction {
+    const castFunction = new DuckDBCastFunction();
+    castFunction.setSourceType(sourceType);
+    castFunction.setTargetType(targetType);
+    castFunction.setMainFunction(mainFunction);
+    if (implicitCastCost !== undefined) {
+      castFunction.setImplicitCastCost(implicitCastCost);
+    }
+    if (extraInfo) {
+      castFunction.setExtraInfo(extraInfo);
+    }
+    return castFunction;
+  }
+
+  public destroySync() {
+    duckdb.destroy_cast_function_sync(this.cast_function);
+  }
+
+  public setSourceType(sourceType: DuckDBType) {
+    duckdb.cast_function_set_source_type(
+      this.cast_function,
+      sourceType.toLogicalType().logical_type,
+    );
+  }
+
+  public setTargetType(targetType: DuckDBType) {
+    duckdb.cast_function_set_target_type(
+      this.cast_function,
+      targetType.toLogicalType().logical_type,
+    );
+  }
+
+  public setImplicitCastCost(cost: number) {
+    duckdb.cast_function_set_implicit_cast_cost(this.cast_function, cost);
+  }
+
+  public setMainFunction(mainFunction: DuckDBCastMainFunction) {
+    duckdb.cast_function_set_function(
+      this.cast_function,
+      (info, count, input, output) =>
+        mainFunction(
+          new DuckDBCastFunctionInfo(info, output),
+          DuckDBVector.create(input, count),
+          DuckDBVector.create(output, count),
+        ),
+    );
+  }
+
+  /**
+   * Sets the main function to the `duckdb_cast_function_t` exported from
+   * `library` as `symbol`, which DuckDB calls directly on its own threads.
+   *
+   * Native functions must not read extra info set from JS.
+   */
+  public setNativeMainFunction(library: DuckDBNativeLibrary, symbol: string) {
+    duckdb.cast_function_set_native_function(
+      this.cast_function,
+      library.library,
+      symbol,
+    );
+  }
+
+  public setExtraInfo(extraInfo: object) {
+    duckdb.cast_function_set_extra_info(this.cast_function, extraInfo);
+  }
+}
@@ -0,0 +1,36 @@
+import duckdb from '@duckdb/node-bindings';
+import { CastMode } from './enums';
+
+export class DuckDBCastFunctionInfo {
+  private readonly function_info: duckdb.CastFunctionInfo;
+  private readonly output: duckdb.Vector;
+  constructor(function_info: duckdb.CastFunctionInfo, output: duckdb.Vector) {
+    this.function_info = function_info;
+    this.output = output;
+  }
+  public get extraInfo(): object | undefined {
+    return this.getExtraInfo();
+  }
+  public getExtraInfo(): object | undefined {
+    return duckdb.cast_function_get_extra_info(this.function_info);
+  }
+  /** TRY for `TRY_CAST`, where failed rows should become NULL. */
+  public get castMode(): CastMode {
+    return duckdb.cast_function_get_cast_mode(this.function_info);
+  }
+  public setError(error: string) {
+    duckdb.cast_function_set_error(this.function_info, error);
+  }
+  /**
+   * Reports a failed row. In TRY mode this makes the row NULL, so call it after
+   * flushing the output vector; otherwise it fails the cast.
+   */
+  public setRowError(error: string, rowIndex: number) {
+    duckdb.cast_function_set_row_error(
+      this.function_info,
+      error,
+      rowIndex,
+      this.output,
+    );
+  }
+}
@@ -1,4 +1,5 @@
 import duckdb from '@duckdb/node-bindings';
+import { DuckDBFileSystem } from './DuckDBFileSystem';
 
 export class DuckDBClientContext {
   private readonly client_context: duckdb.ClientContext;
@@ -10,4 +11,14 @@ export class DuckDBClientContext {
   public get connectionId(): number {
     return duckdb.client_context_get_connection_id(this.client_context);
   }
+
+  public get fileSystem(): DuckDBFileSystem {
+    return this.getFileSystem();
+  }
+
+  public getFileSystem(): DuckDBFileSystem {
+    return new DuckDBFileSystem(
+      duckdb.client_context_get_file_system(this.client_context),
+    );
+  }
 }
@@ -1,6 +1,10 @@
 import duckdb from '@duckdb/node-bindings';
+import { DuckDBAggregateFunction } from './DuckDBAggregateFunction';
+import { DuckDBAggregateFunctionSet } from './DuckDBAggregateFunctionSet';
 import { DuckDBAppender } from './DuckDBAppender';
+import { DuckDBCastFunction } from './DuckDBCastFunction';
 import { DuckDBClientContext } from './DuckDBClientContext';
+import { DuckDBCopyFunction } from './DuckDBCopyFunction';
 import { DuckDBExtractedStatements } from './DuckDBExtractedStatements';
 import { DuckDBInstance } from './DuckDBInstance';
 import { DuckDBMaterializedResult } from './DuckDBMaterializedResult';
@@ -10,6 +14,7 @@ import { DuckDBPreparedStatementWeakRefCollection } from './DuckDBPreparedStatem
 import { DuckDBResult } from './DuckDBResult';
 import { DuckDBResultReader } from './DuckDBResultReader';
 import { DuckDBScalarFunction } from './DuckDBScalarFunction';
+import { DuckDBScalarFunctionSet } from './DuckDBScalarFunctionSet';
 import { DuckDBTableFunction } from './DuckDBTableFunction';
 import { DuckDBType } from './DuckDBType';
 import { DuckDBValue } from './values';
@@ -312,4 +317,34 @@ export class DuckDBConnection {
       scalarFunction.scalar_function
     );
   }
+  public registerScalarFunctionSet(
+    scalarFunctionSet: DuckDBScalarFunctionSet
+  ) {
+    duckdb.register_scalar_function_set(
+      this.connection,
+      scalarFunctionSet.scalar_function_set
+    );
+  }
+  public registerAggregateFunction(
+    aggregateFunction: DuckDBAggregateFunction
+  ) {
+    duckdb.register_aggregate_function(
+      this.connection,
+      aggregateFunction.aggregate_function
+    );
+  }
+  public registerAggregateFunctionSet(
+    aggregateFunctionSet: DuckDBAggregateFunctionSet
+  ) {
+    duckdb.register_aggregate_function_set(
+      this.connection,
+      aggregateFunctionSet.aggregate_function_set
+    );
+  }
+  public registerCastFunction(castFunction: DuckDBCastFunction) {
+    duckdb.register_cast_function(this.connection, castFunction.cast_function);
+  }
+  public registerCopyFunction(copyFunction: DuckDBCopyFunction) {
+    duckdb.register_copy_function(this.connection, copyFunction.copy_function);
+  }
 }
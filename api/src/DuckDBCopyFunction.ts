@@ -0,0 +1,173 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBCopyFunctionBindInfo } from './DuckDBCopyFunctionBindInfo';
+import { DuckDBCopyFunctionFinalizeInfo } from './DuckDBCopyFunctionFinalizeInfo';
+import { DuckDBCopyFunctionGlobalInitInfo } from './DuckDBCopyFunctionGlobalInitInfo';
+import { DuckDBCopyFunctionSinkInfo } from './DuckDBCopyFunctionSinkInfo';
+import { DuckDBDataChunk } from './DuckDBDataChunk';
+import { DuckDBTableFunction } from './DuckDBTableFunction';
+
+export type DuckDBCopyBindFunction = (
+  info: DuckDBCopyFunctionBindInfo,
+) => void | Promise<void>;
+
+export type DuckDBCopyGlobalInitFunction = (
+  info: DuckDBCopyFunctionGlobalInitInfo,
+) => void | Promise<void>;
+
+/**
+ * Called once per chunk of the query being copied. The chunk is only valid
+ * until the function returns or its promise settles.
+ */
+export type DuckDBCopySinkFunction = (
+  info: DuckDBCopyFunctionSinkInfo,
+  inputDataChunk: DuckDBDataChunk,
+) => void | Promise<void>;
+
+/**
+ * Called with copies of every chunk sunk since its previous call, in order.
+ * Calls never overlap. `globalState` is the state set by the global init
+ * function, if any.
+ */
+export type DuckDBCopyAsyncSinkFunction = (
+  dataChunks: DuckDBDataChunk[],
+  globalState: object | undefined,
+) => void | Promise<void>;
+
+export type DuckDBCopyFinalizeFunction = (
+  info: DuckDBCopyFunctionFinalizeInfo,
+) => void | Promise<void>;
+
+/**
+ * A format for `COPY ... TO`, used with `(FORMAT name)`. The bind function
+ * sees the columns and options, the global init function the path, and the
+ * sink function each chunk of the query; the finalize function runs once all
+ * chunks have been sunk. A copy-from function makes the format readable by
+ * `COPY ... FROM` too.
+ */
+export class DuckDBCopyFunction {
+  readonly copy_function: duckdb.CopyFunction;
+
+  public constructor() {
+    this.copy_function = duckdb.create_copy_function();
+  }
+
+  public static create({
+    name,
+    bindFunction,
+    globalInitFunction,
+    sinkFunction,
+    asyncSinkFunction,
+    maxPendingChunks = 16,
+    finalizeFunction,
+    copyFromFunction,
+    extraInfo,
+  }: {
+    name: string;
+    bindFunction?: DuckDBCopyBindFunction;
+    globalInitFunction?: DuckDBCopyGlobalInitFunction;
+    sinkFunction?: DuckDBCopySinkFunction;
+    /**
+     * Used instead of `sinkFunction` to write chunks in batches, without
+     * DuckDB's threads waiting for each one; see `setAsyncSinkFunction`.
+     */
+    asyncSinkFunction?: DuckDBCopyAsyncSinkFunction;
+    maxPendingChunks?: number;
+    finalizeFunction?: DuckDBCopyFinalizeFunction;
+    copyFromFunction?: DuckDBTableFunction;
+    extraInfo?: object;
+  }): DuckDBCopyFunction {
+    const copyFunction = new DuckDBCopyFunction();
+    copyFunction.setName(name);
+    copyFunction.setBindFunction(bindFunction ?? (() => {}));
+    copyFunction.setGlobalInitFunction(globalInitFunction ?? (() => {}));
+    if (asyncSinkFunction) {
+      copyFunction.setAsyncSinkFunction(asyncSinkFunction, maxPendingChunks);
+    } else if (sinkFunction) {
+      copyFunction.setSinkFunction(sinkFunction);
+    }
+    copyFunction.setFinalizeFunction(finalizeFunction ?? (() => {}));
+    if (copyFromFunction) {
+      copyFunction.setCopyFromFunction(copyFromFunction);
+    }
+    if (extraInfo) {
+      copyFunction.setExtraInfo(extraInfo);
+    }
+    return copyFunction;
+  }
+
+  public destroySync() {
+    duckdb.destroy_copy_function_sync(this.copy_function);
+  }
+
+  public setName(name: string) {
+    duckdb.copy_function_set_name(this.copy_function, name);
+  }
+
+  public setBindFunction(bindFunction: DuckDBCopyBindFunction) {
+    duckdb.copy_function_set_bind(this.copy_function, (info) =>
+      bindFunction(new DuckDBCopyFunctionBindInfo(info)),
+    );
+  }
+
+  public setGlobalInitFunction(
+    globalInitFunction: DuckDBCopyGlobalInitFunction,
+  ) {
+    duckdb.copy_function_set_global_init(this.copy_function, (info) =>
+      globalInitFunction(new DuckDBCopyFunctionGlobalInitInfo(info)),
+    );
+  }
+
+  public setSinkFunction(sinkFunction: DuckDBCopySinkFunction) {
+    duckdb.copy_function_set_sink(this.copy_function, (info, input) =>
+      sinkFunction(
+        new DuckDBCopyFunctionSinkInfo(info),
+        new DuckDBDataChunk(input),
+      ),
+    );
+  }
+
+  /**
+   * Replaces the sink function with one that copies each chunk and queues it,
+   * so DuckDB's threads wait only while `maxPendingChunks` chunks are queued
+   * or being written. `asyncSinkFunction` is called with every chunk queued
+   * since its previous call. The finalize function runs once all chunks have
+   * been written; if `asyncSinkFunction` throws or rejects, the COPY fails.
+   */
+  public setAsyncSinkFunction(
+    asyncSinkFunction: DuckDBCopyAsyncSinkFunction,
+    maxPendingChunks: number,
+  ) {
+    duckdb.copy_function_set_async_sink(
+      this.copy_function,
+      (chunks, globalState) =>
+        asyncSinkFunction(
+          chunks.map((chunk) => new DuckDBDataChunk(chunk)),
+          globalState,
+        ),
+      maxPendingChunks,
+    );
+  }
+
+  public setFinalizeFunction(finalizeFunction: DuckDBCopyFinalizeFunction) {
+    duckdb.copy_function_set_finalize(this.copy_function, (info) =>
+      finalizeFunction(new DuckDBCopyFunctionFinalizeInfo(info)),
+    );
+  }
+
+  /**
+   * Reads `COPY ... FROM` with `tableFunction`. Its first parameter must be a
+   * VARCHAR, which receives the path; its bind info gives the columns of the
+   * target table as expected result columns. Sets a copy of `tableFunction`,
+   * so set it up fully first.
+   */
+  public setCopyFromFunction(tableFunction: DuckDBTableFunction) {
+    duckdb.copy_function_set_copy_from_function(
+      this.copy_function,
+      tableFunction.table_function,
+    );
+  }
+
+  public setExtraInfo(extraInfo: object) {
+    duckdb.copy_function_set_extra_info(this.copy_function, extraInfo);
+  }
+}
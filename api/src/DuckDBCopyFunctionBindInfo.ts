@@ -0,0 +1,69 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBClientContext } from './DuckDBClientContext';
+import { DuckDBLogicalType } from './DuckDBLogicalType';
+import { DuckDBType } from './DuckDBType';
+import { readValue } from './readValue';
+import { DuckDBStructValue, DuckDBValue } from './values';
+
+export class DuckDBCopyFunctionBindInfo {
+  private readonly bind_info: duckdb.CopyFunctionBindInfo;
+  constructor(bind_info: duckdb.CopyFunctionBindInfo) {
+    this.bind_info = bind_info;
+  }
+  public get clientContext(): DuckDBClientContext {
+    return this.getClientContext();
+  }
+  public getClientContext(): DuckDBClientContext {
+    return new DuckDBClientContext(
+      duckdb.copy_function_bind_get_client_context(this.bind_info),
+    );
+  }
+  public get extraInfo(): object | undefined {
+    return this.getExtraInfo();
+  }
+  public getExtraInfo(): object | undefined {
+    return duckdb.copy_function_bind_get_extra_info(this.bind_info);
+  }
+  /** The number of columns of the query being copied. */
+  public get columnCount(): number {
+    return this.getColumnCount();
+  }
+  public getColumnCount(): number {
+    return duckdb.copy_function_bind_get_column_count(this.bind_info);
+  }
+  public getColumnType(columnIndex: number): DuckDBType {
+    return DuckDBLogicalType.create(
+      duckdb.copy_function_bind_get_column_type(this.bind_info, columnIndex),
+    ).asType();
+  }
+  public get columnTypes(): DuckDBType[] {
+    return this.getColumnTypes();
+  }
+  public getColumnTypes(): DuckDBType[] {
+    const columnTypes: DuckDBType[] = [];
+    const columnCount = this.getColumnCount();
+    for (let columnIndex = 0; columnIndex < columnCount; columnIndex++) {
+      columnTypes.push(this.getColumnType(columnIndex));
+    }
+    return columnTypes;
+  }
+  /**
+   * The options given to the COPY statement, by name. Each is a list of the
+   * values given for the option.
+   */
+  public get options(): Record<string, DuckDBValue> {
+    return this.getOptions();
+  }
+  public getOptions(): Record<string, DuckDBValue> {
+    const options = readValue(
+      duckdb.copy_function_bind_get_options(this.bind_info),
+    );
+    return options instanceof DuckDBStructValue ? { ...options.entries } : {};
+  }
+  public setBindData(bindData: object) {
+    duckdb.copy_function_bind_set_bind_data(this.bind_info, bindData);
+  }
+  public setError(error: string) {
+    duckdb.copy_function_bind_set_error(this.bind_info, error);
+  }
+}
@@ -0,0 +1,38 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBClientContext } from './DuckDBClientContext';
+
+export class DuckDBCopyFunctionFinalizeInfo {
+  private readonly finalize_info: duckdb.CopyFunctionFinalizeInfo;
+  constructor(finalize_info: duckdb.CopyFunctionFinalizeInfo) {
+    this.finalize_info = finalize_info;
+  }
+  public get clientContext(): DuckDBClientContext {
+    return this.getClientContext();
+  }
+  public getClientContext(): DuckDBClientContext {
+    return new DuckDBClientContext(
+      duckdb.copy_function_finalize_get_client_context(this.finalize_info),
+    );
+  }
+  public get extraInfo(): object | undefined {
+    return this.getExtraInfo();
+  }
+  public getExtraInfo(): object | undefined {
+    return duckdb.copy_function_finalize_get_extra_info(this.finalize_info);
+  }
+  public get bindData(): object | undefined {
+    return this.getBindData();
+  }
+  public getBindData(): object | undefined {
+    return duckdb.copy_function_finalize_get_bind_data(this.finalize_info);
+  }
+  public get globalState(): object | undefined {
+    return this.getGlobalState();
+  }
+  public getGlobalState(): object | undefined {
+    return duckdb.copy_function_finalize_get_global_state(this.finalize_info);
+  }
+  public setError(error: string) {
+    duckdb.copy_function_finalize_set_error(this.finalize_info, error);
+  }
+}
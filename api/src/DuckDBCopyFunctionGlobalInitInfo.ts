@@ -0,0 +1,53 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBClientContext } from './DuckDBClientContext';
+
+export class DuckDBCopyFunctionGlobalInitInfo {
+  private readonly global_init_info: duckdb.CopyFunctionGlobalInitInfo;
+  constructor(global_init_info: duckdb.CopyFunctionGlobalInitInfo) {
+    this.global_init_info = global_init_info;
+  }
+  public get clientContext(): DuckDBClientContext {
+    return this.getClientContext();
+  }
+  public getClientContext(): DuckDBClientContext {
+    return new DuckDBClientContext(
+      duckdb.copy_function_global_init_get_client_context(
+        this.global_init_info,
+      ),
+    );
+  }
+  public get extraInfo(): object | undefined {
+    return this.getExtraInfo();
+  }
+  public getExtraInfo(): object | undefined {
+    return duckdb.copy_function_global_init_get_extra_info(
+      this.global_init_info,
+    );
+  }
+  public get bindData(): object | undefined {
+    return this.getBindData();
+  }
+  public getBindData(): object | undefined {
+    return duckdb.copy_function_global_init_get_bind_data(
+      this.global_init_info,
+    );
+  }
+  /** The path given to the COPY statement. */
+  public get filePath(): string {
+    return this.getFilePath();
+  }
+  public getFilePath(): string {
+    return duckdb.copy_function_global_init_get_file_path(
+      this.global_init_info,
+    );
+  }
+  public setGlobalState(globalState: object) {
+    duckdb.copy_function_global_init_set_global_state(
+      this.global_init_info,
+      globalState,
+    );
+  }
+  public setError(error: string) {
+    duckdb.copy_function_global_init_set_error(this.global_init_info, error);
+  }
+}
@@ -0,0 +1,38 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBClientContext } from './DuckDBClientContext';
+
+export class DuckDBCopyFunctionSinkInfo {
+  private readonly sink_info: duckdb.CopyFunctionSinkInfo;
+  constructor(sink_info: duckdb.CopyFunctionSinkInfo) {
+    this.sink_info = sink_info;
+  }
+  public get clientContext(): DuckDBClientContext {
+    return this.getClientContext();
+  }
+  public getClientContext(): DuckDBClientContext {
+    return new DuckDBClientContext(
+      duckdb.copy_function_sink_get_client_context(this.sink_info),
+    );
+  }
+  public get extraInfo(): object | undefined {
+    return this.getExtraInfo();
+  }
+  public getExtraInfo(): object | undefined {
+    return duckdb.copy_function_sink_get_extra_info(this.sink_info);
+  }
+  public get bindData(): object | undefined {
+    return this.getBindData();
+  }
+  public getBindData(): object | undefined {
+    return duckdb.copy_function_sink_get_bind_data(this.sink_info);
+  }
+  public get globalState(): object | undefined {
+    return this.getGlobalState();
+  }
+  public getGlobalState(): object | undefined {
+    return duckdb.copy_function_sink_get_global_state(this.sink_info);
+  }
+  public setError(error: string) {
+    duckdb.copy_function_sink_set_error(this.sink_info, error);
+  }
+}
@@ -24,6 +24,8 @@ export class DuckDBDataChunk {
   }
   public reset() {
     duckdb.data_chunk_reset(this.chunk);
+    // Resetting reinitializes the vectors, so cached ones are stale.
+    this.vectors.length = 0;
   }
   public get columnCount(): number {
     return duckdb.data_chunk_get_column_count(this.chunk);
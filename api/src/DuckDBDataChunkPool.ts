@@ -0,0 +1,61 @@
+import { DuckDBDataChunk } from './DuckDBDataChunk';
+import { DuckDBType } from './DuckDBType';
+
+function typesKey(types: readonly DuckDBType[]): string {
+  return JSON.stringify(types.map((type) => type.toJson()));
+}
+
+/**
+ * Hands out data chunks for a given list of column types, reusing chunks
+ * that have been released back to the pool instead of creating new ones.
+ *
+ * Creating a chunk allocates its vectors (and logical types), and a discarded
+ * chunk is only freed when its wrapper is garbage collected. When building
+ * many chunks, such as when appending in batches, releasing each chunk after
+ * use keeps memory flat.
+ */
+export class DuckDBDataChunkPool {
+  /** The most chunks kept for reuse per list of column types. */
+  public readonly maxFreeChunksPerTypes: number;
+  private readonly freeChunks = new Map<string, DuckDBDataChunk[]>();
+  private readonly acquiredChunkKeys = new WeakMap<DuckDBDataChunk, string>();
+  constructor(maxFreeChunksPerTypes: number = 8) {
+    this.maxFreeChunksPerTypes = maxFreeChunksPerTypes;
+  }
+  public acquire(
+    types: readonly DuckDBType[],
+    rowCount?: number
+  ): DuckDBDataChunk {
+    const key = typesKey(types);
+    const chunk = this.freeChunks.get(key)?.pop() ?? DuckDBDataChunk.create(types);
+    this.acquiredChunkKeys.set(chunk, key);
+    if (rowCount != undefined) {
+      chunk.rowCount = rowCount;
+    }
+    return chunk;
+  }
+  /**
+   * Resets the chunk and makes it available to later calls to `acquire`.
+   * The chunk must not be used after it is released.
+   */
+  public release(chunk: DuckDBDataChunk) {
+    const key = this.acquiredChunkKeys.get(chunk);
+    if (key === undefined) {
+      throw new Error('Data chunk was not acquired from this pool');
+    }
+    this.acquiredChunkKeys.delete(chunk);
+    chunk.reset();
+    let freeChunks = this.freeChunks.get(key);
+    if (!freeChunks) {
+      freeChunks = [];
+      this.freeChunks.set(key, freeChunks);
+    }
+    if (freeChunks.length < this.maxFreeChunksPerTypes) {
+      freeChunks.push(chunk);
+    }
+  }
+  /** Drops all free chunks, leaving them to be garbage collected. */
+  public clear() {
+    this.freeChunks.clear();
+  }
+}
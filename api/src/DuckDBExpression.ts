@@ -0,0 +1,39 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBLogicalType } from './DuckDBLogicalType';
+import { DuckDBType } from './DuckDBType';
+import { readValue } from './readValue';
+import { DuckDBValue } from './values';
+
+/**
+ * An argument expression of a function call, as seen at bind time. Only valid
+ * during the bind function it was obtained in.
+ */
+export class DuckDBExpression {
+  readonly expression: duckdb.Expression;
+  private readonly client_context: duckdb.ClientContext;
+  constructor(
+    expression: duckdb.Expression,
+    client_context: duckdb.ClientContext,
+  ) {
+    this.expression = expression;
+    this.client_context = client_context;
+  }
+  public get returnType(): DuckDBType {
+    return this.getReturnType();
+  }
+  public getReturnType(): DuckDBType {
+    return DuckDBLogicalType.create(
+      duckdb.expression_return_type(this.expression),
+    ).asType();
+  }
+  /** Whether the expression is constant, such as a literal. */
+  public get isFoldable(): boolean {
+    return duckdb.expression_is_foldable(this.expression);
+  }
+  /** Evaluates a foldable expression to its value. */
+  public fold(): DuckDBValue {
+    return readValue(
+      duckdb.expression_fold(this.client_context, this.expression),
+    );
+  }
+}
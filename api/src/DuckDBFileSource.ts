@@ -0,0 +1,32 @@
+export interface DuckDBByteRange {
+  offset: number;
+  length: number;
+}
+
+/**
+ * A file served by JS, such as from an object store or a blob cache, for
+ * `DuckDBInstance.registerFileSource`.
+ */
+export interface DuckDBFileSource {
+  /** The size of the file, in bytes. Read once, when registered. */
+  size(): number | Promise<number>;
+  /**
+   * Reads a batch of ranges, returning one buffer per range, in order, each
+   * exactly as long as its range. Several batches may be pending at once.
+   */
+  read(
+    ranges: readonly DuckDBByteRange[],
+  ): Uint8Array[] | Promise<Uint8Array[]>;
+}
+
+export interface DuckDBFileSourceReadOptions {
+  /**
+   * The most bytes in one range. Overlapping and adjacent reads are merged
+   * into ranges up to this long, and longer reads are split. Defaults to 8 MiB.
+   */
+  maxRangeLength?: number;
+  /** The most ranges in one call to `read`. Defaults to 16. */
+  maxRangesPerRead?: number;
+  /** The most calls to `read` pending at once. Defaults to 4. */
+  maxPendingReads?: number;
+}
@@ -0,0 +1,109 @@
+import duckdb from '@duckdb/node-bindings';
+
+export interface DuckDBFileOpenFlags {
+  read?: boolean;
+  write?: boolean;
+  directIO?: boolean;
+  /** Creates the file if it does not exist. */
+  create?: boolean;
+  /** Creates the file, truncating it if it exists. */
+  createNew?: boolean;
+  append?: boolean;
+}
+
+const fileFlags: Record<keyof DuckDBFileOpenFlags, duckdb.FileFlag> = {
+  read: duckdb.FileFlag.READ,
+  write: duckdb.FileFlag.WRITE,
+  directIO: duckdb.FileFlag.DIRECT_IO,
+  create: duckdb.FileFlag.CREATE,
+  createNew: duckdb.FileFlag.CREATE_NEW,
+  append: duckdb.FileFlag.APPEND,
+};
+
+/** A file opened with `DuckDBFileSystem.open`. Operations block until done. */
+export class DuckDBFileHandle {
+  private readonly file_handle: duckdb.FileHandle;
+  constructor(file_handle: duckdb.FileHandle) {
+    this.file_handle = file_handle;
+  }
+  /**
+   * Reads into `buffer`, up to its length, from the current position. Returns
+   * the number of bytes read, which is 0 at the end of the file.
+   */
+  public read(buffer: Uint8Array): number {
+    return duckdb.file_handle_read_sync(this.file_handle, buffer);
+  }
+  /** Writes `data` at the current position, returning the bytes written. */
+  public write(data: Uint8Array): number {
+    return duckdb.file_handle_write_sync(this.file_handle, data);
+  }
+  public seek(position: number) {
+    duckdb.file_handle_seek(this.file_handle, position);
+  }
+  public get position(): number {
+    return duckdb.file_handle_tell(this.file_handle);
+  }
+  public get size(): number {
+    return duckdb.file_handle_size(this.file_handle);
+  }
+  public sync() {
+    duckdb.file_handle_sync(this.file_handle);
+  }
+  public close() {
+    duckdb.file_handle_close_sync(this.file_handle);
+  }
+}
+
+/**
+ * The file system of a database, as its queries see it: local files, plus any
+ * file systems added by extensions, such as httpfs for `s3://` paths.
+ */
+export class DuckDBFileSystem {
+  private readonly file_system: duckdb.FileSystem;
+  constructor(file_system: duckdb.FileSystem) {
+    this.file_system = file_system;
+  }
+  public open(path: string, flags: DuckDBFileOpenFlags): DuckDBFileHandle {
+    const options = duckdb.create_file_open_options();
+    for (const [key, value] of Object.entries(flags)) {
+      if (value) {
+        duckdb.file_open_options_set_flag(
+          options,
+          fileFlags[key as keyof DuckDBFileOpenFlags],
+          true,
+        );
+      }
+    }
+    return new DuckDBFileHandle(
+      duckdb.file_system_open_sync(this.file_system, path, options),
+    );
+  }
+  public readFile(path: string): Uint8Array {
+    const handle = this.open(path, { read: true });
+    try {
+      const data = new Uint8Array(handle.size);
+      let offset = 0;
+      while (offset < data.length) {
+        const read = handle.read(data.subarray(offset));
+        if (read === 0) {
+          break;
+        }
+        offset += read;
+      }
+      return data.subarray(0, offset);
+    } finally {
+      handle.close();
+    }
+  }
+  public writeFile(path: string, data: Uint8Array) {
+    const handle = this.open(path, { write: true, createNew: true });
+    try {
+      let offset = 0;
+      while (offset < data.length) {
+        offset += handle.write(data.subarray(offset));
+      }
+    } finally {
+      handle.close();
+    }
+  }
+}
@@ -1,10 +1,55 @@
 import duckdb from '@duckdb/node-bindings';
+import fs from 'node:fs';
+import os from 'node:os';
+import path from 'node:path';
 import { createConfig } from './createConfig';
 import { DuckDBConnection } from './DuckDBConnection';
+import {
+  DuckDBFileSource,
+  DuckDBFileSourceReadOptions,
+} from './DuckDBFileSource';
 import { DuckDBInstanceCache } from './DuckDBInstanceCache';
+import {
+  DuckDBReplacementScanFunction,
+  DuckDBReplacementScanInfo,
+} from './DuckDBReplacementScanInfo';
+import { FileSourceServer } from './fileSourceServer';
+
+interface FileBuffer {
+  tempDir: string;
+  path: string;
+}
+
+/**
+ * Where file buffers are written: on Linux, /dev/shm, an in-memory file system,
+ * so nothing reaches a disk; elsewhere, the temporary directory.
+ */
+function fileBufferRoot(): string {
+  if (process.platform === 'linux') {
+    try {
+      fs.accessSync('/dev/shm', fs.constants.W_OK);
+      return '/dev/shm';
+    } catch {
+      // Fall back to the temporary directory.
+    }
+  }
+  return os.tmpdir();
+}
+
+/**
+ * Creates a directory of its own for a buffer, so its path is never reused by
+ * another registration, even after the buffer is unregistered.
+ */
+function createFileBuffer(name: string): FileBuffer {
+  const tempDir = fs.mkdtempSync(path.join(fileBufferRoot(), 'duckdb-'));
+  return { tempDir, path: path.join(tempDir, path.basename(name)) };
+}
 
 export class DuckDBInstance {
   private readonly db: duckdb.Database;
+  private readonly fileBuffers = new Map<string, FileBuffer>();
+  private readonly fileSourceUrls = new Map<string, string>();
+  private fileSourceServer?: Promise<FileSourceServer>;
 
   constructor(db: duckdb.Database) {
     this.db = db;
@@ -29,7 +74,123 @@ export class DuckDBInstance {
     return new DuckDBConnection(await duckdb.connect(this.db));
   }
 
+  /**
+   * Adds a replacement scan, which can resolve tables the catalog does not have
+   * to table function calls. Replacement scans are tried in the order they
+   * were added, and cannot be removed.
+   */
+  public addReplacementScan(replacementScan: DuckDBReplacementScanFunction) {
+    duckdb.add_replacement_scan(this.db, (info, table_name) =>
+      replacementScan(new DuckDBReplacementScanInfo(info), table_name),
+    );
+  }
+
+  /**
+   * Makes `buffer` readable by queries, such as with `read_parquet`, at the
+   * returned path, without writing it to disk first. The data is copied once,
+   * so `buffer` may be reused afterwards. `name` only identifies the buffer to
+   * this instance: queries cannot refer to it, and must use the returned path.
+   *
+   * On Linux the copy lives in memory. Other platforms fall back to a
+   * temporary file. Registering a name again replaces the previous buffer.
+   */
+  public registerFileBuffer(name: string, buffer: Uint8Array): string {
+    this.unregisterFileBuffer(name);
+    const fileBuffer = createFileBuffer(name);
+    try {
+      fs.writeFileSync(fileBuffer.path, buffer);
+    } catch (error) {
+      fs.rmSync(fileBuffer.tempDir, { recursive: true, force: true });
+      throw error;
+    }
+    this.fileBuffers.set(name, fileBuffer);
+    return fileBuffer.path;
+  }
+
+  /** The path of the buffer registered as `name`, if any. */
+  public getFileBufferPath(name: string): string | undefined {
+    return this.fileBuffers.get(name)?.path;
+  }
+
+  /**
+   * Frees the buffer registered as `name`. Queries already reading it are not
+   * affected. Its path is removed, and is never given to another buffer.
+   */
+  public unregisterFileBuffer(name: string) {
+    const fileBuffer = this.fileBuffers.get(name);
+    if (!fileBuffer) {
+      return;
+    }
+    this.fileBuffers.delete(name);
+    fs.rmSync(fileBuffer.tempDir, { recursive: true, force: true });
+  }
+
+  /**
+   * Makes `source`, such as a file in an object store or a blob cache,
+   * readable by queries at the returned URL, such as with `read_parquet`,
+   * without loading it first. Queries read it through the httpfs extension,
+   * which asks for only the byte ranges it needs, such as a Parquet file's
+   * footer and the column chunks a query uses. Its reads are answered by
+   * `source` as they are made, batched: reads made close together, such as by
+   * several DuckDB threads, are merged by byte range and passed to one call to
+   * `source.read`, with several calls pending at once.
+   *
+   * The URL is served over HTTP on the loopback interface, by a server this
+   * instance starts on first use. It ends in the base name of `name`, so a
+   * reader can be detected from its extension. `name` only identifies the
+   * source to this instance: queries must use the returned URL. Registering a
+   * name again replaces the previous source.
+   */
+  public async registerFileSource(
+    name: string,
+    source: DuckDBFileSource,
+    options?: DuckDBFileSourceReadOptions,
+  ): Promise<string> {
+    const size = await source.size();
+    if (!Number.isSafeInteger(size) || size < 0) {
+      throw new Error(`File source size ${size} is not a valid size`);
+    }
+    if (!this.fileSourceServer) {
+      this.fileSourceServer = FileSourceServer.start();
+      this.fileSourceServer.catch(() => {
+        this.fileSourceServer = undefined;
+      });
+    }
+    const server = await this.fileSourceServer;
+    const url = server.add(name, source, size, options);
+    this.unregisterFileSource(name);
+    this.fileSourceUrls.set(name, url);
+    return url;
+  }
+
+  /** The URL of the source registered as `name`, if any. */
+  public getFileSourceUrl(name: string): string | undefined {
+    return this.fileSourceUrls.get(name);
+  }
+
+  /**
+   * Stops serving the source registered as `name`. Later reads of its URL,
+   * including by queries already reading it, fail.
+   */
+  public unregisterFileSource(name: string) {
+    const url = this.fileSourceUrls.get(name);
+    if (!url) {
+      return;
+    }
+    this.fileSourceUrls.delete(name);
+    void this.fileSourceServer?.then((server) => server.remove(url));
+  }
+
   public closeSync() {
     duckdb.close_sync(this.db);
+    for (const name of [...this.fileBuffers.keys()]) {
+      this.unregisterFileBuffer(name);
+    }
+    this.fileSourceUrls.clear();
+    void this.fileSourceServer?.then(
+      (server) => server.close(),
+      () => {},
+    );
+    this.fileSourceServer = undefined;
   }
 }
@@ -0,0 +1,24 @@
+import duckdb from '@duckdb/node-bindings';
+
+/**
+ * A shared library whose exported C functions can be used as the callbacks of
+ * scalar, table, and cast functions, which DuckDB then calls directly on its own
+ * threads instead of hopping to the JS thread.
+ *
+ * Each callback must have the signature of the matching C API callback type,
+ * such as `duckdb_scalar_function_t`. This cannot be checked; a mismatch is
+ * undefined behavior. Libraries are never unloaded.
+ */
+export class DuckDBNativeLibrary {
+  readonly library: duckdb.NativeLibrary;
+  readonly path: string;
+
+  constructor(library: duckdb.NativeLibrary, path: string) {
+    this.library = library;
+    this.path = path;
+  }
+
+  public static load(path: string): DuckDBNativeLibrary {
+    return new DuckDBNativeLibrary(duckdb.load_native_library(path), path);
+  }
+}
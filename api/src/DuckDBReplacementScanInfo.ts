@@ -0,0 +1,36 @@
+import duckdb from '@duckdb/node-bindings';
+import { createValue } from './createValue';
+import { DuckDBType } from './DuckDBType';
+import { typeForValue } from './typeForValue';
+import { DuckDBValue } from './values';
+
+/**
+ * Called while a query is bound, with the name of each table the catalog does
+ * not have. To replace the table with a table function call, set the function
+ * name and add its parameters; to leave the table unresolved, do nothing.
+ *
+ * The info is only valid until the call returns, or its promise settles.
+ */
+export type DuckDBReplacementScanFunction = (
+  info: DuckDBReplacementScanInfo,
+  tableName: string,
+) => void | Promise<void>;
+
+export class DuckDBReplacementScanInfo {
+  private readonly info: duckdb.ReplacementScanInfo;
+  constructor(info: duckdb.ReplacementScanInfo) {
+    this.info = info;
+  }
+  public setFunctionName(functionName: string) {
+    duckdb.replacement_scan_set_function_name(this.info, functionName);
+  }
+  public addParameter(value: DuckDBValue, type?: DuckDBType) {
+    duckdb.replacement_scan_add_parameter(
+      this.info,
+      createValue(type ? type : typeForValue(value), value),
+    );
+  }
+  public setError(error: string) {
+    duckdb.replacement_scan_set_error(this.info, error);
+  }
+}
@@ -1,17 +1,57 @@
 import duckdb from '@duckdb/node-bindings';
 import { DuckDBDataChunk } from './DuckDBDataChunk';
+import { DuckDBNativeLibrary } from './DuckDBNativeLibrary';
 import { DuckDBScalarFunctionInfo } from './DuckDBScalarFunctionInfo';
+import { DuckDBScalarFunctionWorkerPool } from './DuckDBScalarFunctionWorkerPool';
 import { DuckDBType } from './DuckDBType';
 import { DuckDBVector } from './DuckDBVector';
 import { DuckDBScalarFunctionBindInfo } from './DuckDBScalarFunctionBindInfo';
+import { DuckDBScalarFunctionInitInfo } from './DuckDBScalarFunctionInitInfo';
+import {
+  DuckDBColumnarColumn,
+  DuckDBColumnarValues,
+  readColumnarColumn,
+  writeColumnarColumn,
+} from './vectors/columnarData';
 
-export type DuckDBScalarBindFunction = (bindInfo: DuckDBScalarFunctionBindInfo) => void;
+export type DuckDBScalarBindFunction = (
+  bindInfo: DuckDBScalarFunctionBindInfo,
+) => void | Promise<void>;
 
+/**
+ * Called once per DuckDB thread executing the function, before that thread's
+ * first chunk. State set here is returned by `DuckDBScalarFunctionInfo.state`
+ * in the main function calls made for that thread.
+ */
+export type DuckDBScalarInitFunction = (
+  initInfo: DuckDBScalarFunctionInitInfo,
+) => void | Promise<void>;
+
+/**
+ * May return a promise, such as for a lookup that needs I/O. The query waits
+ * for it to settle, without blocking the event loop, and a rejection fails the
+ * query. Chunks being processed by other DuckDB threads can be in flight at the
+ * same time.
+ */
 export type DuckDBScalarMainFunction = (
   functionInfo: DuckDBScalarFunctionInfo,
   inputDataChunk: DuckDBDataChunk,
   outputVector: DuckDBVector,
-) => void;
+) => void | Promise<void>;
+
+/**
+ * A main function that is called once per input chunk with whole columns, and
+ * returns the whole output column. Returning just values (with no null mask)
+ * makes every row valid, except for null strings.
+ */
+export type DuckDBScalarColumnarMainFunction = (
+  functionInfo: DuckDBScalarFunctionInfo,
+  inputColumns: readonly DuckDBColumnarColumn[],
+  rowCount: number,
+) =>
+  | DuckDBColumnarValues
+  | DuckDBColumnarColumn
+  | Promise<DuckDBColumnarValues | DuckDBColumnarColumn>;
 
 export class DuckDBScalarFunction {
   readonly scalar_function: duckdb.ScalarFunction;
@@ -23,22 +63,33 @@ export class DuckDBScalarFunction {
   public static create({
     name,
     bindFunction,
+    initFunction,
     mainFunction,
+    columnarMainFunction,
+    workerPool,
     returnType,
     parameterTypes,
     varArgsType,
     specialHandling,
     volatile,
+    deduplicateInputs,
     extraInfo,
   }: {
     name: string;
     bindFunction?: DuckDBScalarBindFunction;
-    mainFunction: DuckDBScalarMainFunction;
+    initFunction?: DuckDBScalarInitFunction;
+    mainFunction?: DuckDBScalarMainFunction;
+    /** Alternative to `mainFunction`, for numeric and VARCHAR columns. */
+    columnarMainFunction?: DuckDBScalarColumnarMainFunction;
+    /** Alternative to `mainFunction`, run by the pool's workers. */
+    workerPool?: DuckDBScalarFunctionWorkerPool;
     returnType: DuckDBType;
     parameterTypes?: readonly DuckDBType[];
     varArgsType?: DuckDBType;
     specialHandling?: boolean;
     volatile?: boolean;
+    /** See `setDeduplicateInputs`. */
+    deduplicateInputs?: boolean;
     extraInfo?: object;
   }): DuckDBScalarFunction {
     const scalarFunction = new DuckDBScalarFunction();
@@ -46,7 +97,20 @@ export class DuckDBScalarFunction {
     if (bindFunction) {
       scalarFunction.setBindFunction(bindFunction);
     }
-    scalarFunction.setMainFunction(mainFunction);
+    if (initFunction) {
+      scalarFunction.setInitFunction(initFunction);
+    }
+    if (mainFunction) {
+      scalarFunction.setMainFunction(mainFunction);
+    } else if (columnarMainFunction) {
+      scalarFunction.setColumnarMainFunction(columnarMainFunction);
+    } else if (workerPool) {
+      scalarFunction.setWorkerPool(workerPool);
+    } else {
+      throw new Error(
+        'One of mainFunction, columnarMainFunction, or workerPool is required',
+      );
+    }
     scalarFunction.setReturnType(returnType);
     if (parameterTypes) {
       for (const parameterType of parameterTypes) {
@@ -62,6 +126,9 @@ export class DuckDBScalarFunction {
     if (volatile) {
       scalarFunction.setVolatile();
     }
+    if (deduplicateInputs) {
+      scalarFunction.setDeduplicateInputs();
+    }
     if (extraInfo) {
       scalarFunction.setExtraInfo(extraInfo);
     }
@@ -79,7 +146,19 @@ export class DuckDBScalarFunction {
   public setBindFunction(bindFunction: DuckDBScalarBindFunction) {
     duckdb.scalar_function_set_bind(this.scalar_function, (info) => {
       const bindInfo = new DuckDBScalarFunctionBindInfo(info);
-      bindFunction(bindInfo);
+      return bindFunction(bindInfo);
+    });
+  }
+
+  /**
+   * Sets a function to create per-thread state, such as a buffer or a parsed
+   * pattern that chunks on the same thread can reuse. Main functions run by a
+   * worker pool do not see this state.
+   */
+  public setInitFunction(initFunction: DuckDBScalarInitFunction) {
+    duckdb.scalar_function_set_init(this.scalar_function, (info) => {
+      const initInfo = new DuckDBScalarFunctionInitInfo(info);
+      return initFunction(initInfo);
     });
   }
 
@@ -93,11 +172,95 @@ export class DuckDBScalarFunction {
           output,
           inputDataChunk.rowCount,
         );
-        mainFunction(functionInfo, inputDataChunk, outputVector);
+        return mainFunction(functionInfo, inputDataChunk, outputVector);
+      },
+    );
+  }
+
+  /**
+   * Sets a main function that receives its input as typed arrays (or arrays
+   * of strings) and returns its output the same way, instead of reading and
+   * writing vectors item by item.
+   *
+   * Supported types are BOOLEAN, the integer types up to 64 bits, FLOAT,
+   * DOUBLE, DATE, TIME, TIMESTAMP (all variants), and VARCHAR.
+   */
+  public setColumnarMainFunction(
+    columnarMainFunction: DuckDBScalarColumnarMainFunction,
+  ) {
+    duckdb.scalar_function_set_function(
+      this.scalar_function,
+      (info, input, output) => {
+        const functionInfo = new DuckDBScalarFunctionInfo(info);
+        const rowCount = duckdb.data_chunk_get_size(input);
+        const columnCount = duckdb.data_chunk_get_column_count(input);
+        const inputColumns: DuckDBColumnarColumn[] = [];
+        for (let columnIndex = 0; columnIndex < columnCount; columnIndex++) {
+          inputColumns.push(
+            readColumnarColumn(
+              duckdb.data_chunk_get_vector(input, columnIndex),
+              rowCount,
+            ),
+          );
+        }
+        const write = (result: DuckDBColumnarValues | DuckDBColumnarColumn) =>
+          writeColumnarColumn(
+            output,
+            rowCount,
+            'nullMask' in result ? result : { values: result, nullMask: null },
+          );
+        const result = columnarMainFunction(
+          functionInfo,
+          inputColumns,
+          rowCount,
+        );
+        if (result instanceof Promise) {
+          return result.then(write);
+        }
+        write(result);
       },
     );
   }
 
+  /**
+   * Runs the main function on the workers of `workerPool`, replacing any main
+   * function set before. Setting a main function afterwards replaces the pool.
+   */
+  public setWorkerPool(workerPool: DuckDBScalarFunctionWorkerPool) {
+    duckdb.scalar_function_set_worker_pool(
+      this.scalar_function,
+      workerPool.pool,
+    );
+  }
+
+  /**
+   * Sets the bind function to the `duckdb_scalar_function_bind_t` exported
+   * from `library` as `symbol`.
+   */
+  public setNativeBindFunction(library: DuckDBNativeLibrary, symbol: string) {
+    duckdb.scalar_function_set_native_bind(
+      this.scalar_function,
+      library.library,
+      symbol,
+    );
+  }
+
+  /**
+   * Sets the main function to the `duckdb_scalar_function_t` exported from
+   * `library` as `symbol`, which DuckDB calls directly on its own threads.
+   *
+   * Native functions must not call `duckdb_scalar_function_get_extra_info`:
+   * it returns the bindings' internal state, not the object given to
+   * `setExtraInfo`. Nor may they read bind data set from JS.
+   */
+  public setNativeMainFunction(library: DuckDBNativeLibrary, symbol: string) {
+    duckdb.scalar_function_set_native_function(
+      this.scalar_function,
+      library.library,
+      symbol,
+    );
+  }
+
   public setReturnType(returnType: DuckDBType) {
     duckdb.scalar_function_set_return_type(
       this.scalar_function,
@@ -127,6 +290,24 @@ export class DuckDBScalarFunction {
     duckdb.scalar_function_set_volatile(this.scalar_function);
   }
 
+  /**
+   * Calls the main function with only the distinct rows of each input chunk,
+   * and copies each result back out to every row with the same input. This
+   * saves most of the work for low-cardinality inputs, such as constants, enums,
+   * or status strings.
+   *
+   * Applies to JS main functions and worker pools. Chunks with parameter types
+   * other than numeric, temporal, UUID, VARCHAR, and BLOB, or with mostly
+   * distinct rows, are passed through as they are. Do not use with volatile
+   * functions, whose results can differ between rows with the same input.
+   */
+  public setDeduplicateInputs(enabled: boolean = true) {
+    duckdb.scalar_function_set_deduplicate_inputs(
+      this.scalar_function,
+      enabled,
+    );
+  }
+
   public setExtraInfo(extraInfo: object) {
     duckdb.scalar_function_set_extra_info(this.scalar_function, extraInfo);
   }
@@ -1,11 +1,29 @@
 import duckdb from '@duckdb/node-bindings';
 import { DuckDBClientContext } from './DuckDBClientContext';
+import { DuckDBExpression } from './DuckDBExpression';
 
 export class DuckDBScalarFunctionBindInfo {
   private readonly bind_info: duckdb.ScalarFunctionBindInfo;
   constructor(bind_info: duckdb.ScalarFunctionBindInfo) {
     this.bind_info = bind_info;
   }
+  public get argumentCount(): number {
+    return this.getArgumentCount();
+  }
+  public getArgumentCount(): number {
+    return duckdb.scalar_function_bind_get_argument_count(this.bind_info);
+  }
+  /**
+   * Returns the expression passed as the argument at `index`. If it is
+   * foldable, such as a literal, its value can be computed here, once per
+   * query, and kept in bind data.
+   */
+  public getArgument(index: number): DuckDBExpression {
+    return new DuckDBExpression(
+      duckdb.scalar_function_bind_get_argument(this.bind_info, index),
+      duckdb.scalar_function_get_client_context(this.bind_info),
+    );
+  }
   public get clientContext(): DuckDBClientContext {
     return this.getClientContext();
   }
@@ -17,6 +17,13 @@ export class DuckDBScalarFunctionInfo {
   public getExtraInfo(): object | undefined {
     return duckdb.scalar_function_get_extra_info(this.function_info);
   }
+  /** The state set by the init function for the calling thread, if any. */
+  public get state(): object | undefined {
+    return this.getState();
+  }
+  public getState(): object | undefined {
+    return duckdb.scalar_function_get_state(this.function_info);
+  }
   public setError(error: string) {
     duckdb.scalar_function_set_error(this.function_info, error);
   }
@@ -0,0 +1,41 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBScalarFunction } from './DuckDBScalarFunction';
+
+/**
+ * Overloads of one scalar function, registered together under one name. DuckDB
+ * picks the overload matching the argument types when binding, so each can have
+ * its own type-specialized implementation.
+ */
+export class DuckDBScalarFunctionSet {
+  readonly scalar_function_set: duckdb.ScalarFunctionSet;
+
+  public constructor(name: string) {
+    this.scalar_function_set = duckdb.create_scalar_function_set(name);
+  }
+
+  public static create(
+    name: string,
+    scalarFunctions: readonly DuckDBScalarFunction[],
+  ): DuckDBScalarFunctionSet {
+    const scalarFunctionSet = new DuckDBScalarFunctionSet(name);
+    for (const scalarFunction of scalarFunctions) {
+      scalarFunctionSet.add(scalarFunction);
+    }
+    return scalarFunctionSet;
+  }
+
+  /**
+   * Adds a copy of the function, whose name must match the set's. The copy
+   * keeps the function's parameter and return types as they are now, but
+   * shares its callbacks and extra info: setting those on the function
+   * afterwards changes the set's copy too, unless the function had none of
+   * them when added. So set the function up fully first, and do not change it
+   * afterwards.
+   */
+  public add(scalarFunction: DuckDBScalarFunction) {
+    duckdb.add_scalar_function_to_set(
+      this.scalar_function_set,
+      scalarFunction.scalar_function,
+    );
+  }
+}
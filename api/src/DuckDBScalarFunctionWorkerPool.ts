@@ -0,0 +1,97 @@
+import duckdb from '@duckdb/node-bindings';
+import { Worker } from 'node:worker_threads';
+import { DuckDBDataChunk } from './DuckDBDataChunk';
+import { DuckDBVector } from './DuckDBVector';
+import {
+  closePoolWorkers,
+  servePool,
+  startPoolWorkers,
+  WorkerPoolKeys,
+  WorkerPoolOptions,
+} from './workerPoolWorkers';
+
+export type DuckDBScalarWorkerMainFunction = (
+  inputDataChunk: DuckDBDataChunk,
+  outputVector: DuckDBVector,
+) => void | Promise<void>;
+
+const keys: WorkerPoolKeys = {
+  className: 'DuckDBScalarFunctionWorkerPool',
+  poolIdKey: 'duckdbScalarFunctionWorkerPoolId',
+  messageKey: 'duckdbScalarFunctionWorkerPool',
+};
+
+/**
+ * Runs the main function of scalar functions in worker threads.
+ *
+ * A scalar function's main function normally runs on the main thread, one
+ * input chunk at a time, however many threads DuckDB is using. A scalar
+ * function given a worker pool (with `workerPool` or `setWorkerPool`) instead
+ * runs each chunk on one of the pool's workers, so CPU-heavy functions use as
+ * many cores as there are workers.
+ *
+ * Each worker runs a module that calls `DuckDBScalarFunctionWorkerPool.serve`
+ * with the main function. Worker main functions receive only the input chunk
+ * and output vector: extra info and bind data belong to the main thread.
+ */
+export class DuckDBScalarFunctionWorkerPool {
+  readonly pool: duckdb.ScalarFunctionWorkerPool;
+  readonly id: number;
+  private readonly workers: Worker[] = [];
+
+  public constructor() {
+    this.pool = duckdb.create_scalar_function_worker_pool();
+    this.id = duckdb.scalar_function_worker_pool_get_id(this.pool);
+  }
+
+  /**
+   * Starts `workerCount` workers running `filename`, and resolves once all of
+   * them are serving.
+   */
+  public static async create(
+    filename: string | URL,
+    options?: WorkerPoolOptions,
+  ): Promise<DuckDBScalarFunctionWorkerPool> {
+    const workerPool = new DuckDBScalarFunctionWorkerPool();
+    await startPoolWorkers(
+      keys,
+      workerPool.id,
+      workerPool.workers,
+      filename,
+      options,
+    );
+    return workerPool;
+  }
+
+  /**
+   * Serves calls from the pool that started this worker. Call once, from the
+   * worker's module.
+   */
+  public static serve(mainFunction: DuckDBScalarWorkerMainFunction) {
+    servePool(
+      keys,
+      (poolId) =>
+        duckdb.scalar_function_worker_pool_attach(poolId, (input, output) => {
+          const inputDataChunk = new DuckDBDataChunk(input);
+          const outputVector = DuckDBVector.create(
+            output,
+            inputDataChunk.rowCount,
+          );
+          return mainFunction(inputDataChunk, outputVector);
+        }),
+      (poolId) => duckdb.scalar_function_worker_pool_detach(poolId),
+    );
+  }
+
+  public get workerCount(): number {
+    return this.workers.length;
+  }
+
+  /**
+   * Detaches and terminates all workers. Call once queries using the pool
+   * have finished; calls made afterwards fail.
+   */
+  public async close(): Promise<void> {
+    await closePoolWorkers(keys, this.workers);
+  }
+}
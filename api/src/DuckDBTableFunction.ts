@@ -1,17 +1,28 @@
 import duckdb from '@duckdb/node-bindings';
 import { DuckDBDataChunk } from './DuckDBDataChunk';
-import { DuckDBTableFunctionBindInfo } from './DuckDBTableFunctionBindInfo';
+import { DuckDBNativeLibrary } from './DuckDBNativeLibrary';
+import {
+  comparisonParameterSuffixes,
+  DuckDBTableFunctionBindInfo,
+} from './DuckDBTableFunctionBindInfo';
 import { DuckDBTableFunctionInfo } from './DuckDBTableFunctionInfo';
 import { DuckDBTableFunctionInitInfo } from './DuckDBTableFunctionInitInfo';
+import { DuckDBTableFunctionWorkerPool } from './DuckDBTableFunctionWorkerPool';
 import { DuckDBType } from './DuckDBType';
+import {
+  createColumnarColumn,
+  DuckDBColumnarOutputColumn,
+  writeColumnarColumn,
+} from './vectors/columnarData';
+import { encodeStrings } from './vectors/dataAccessors';
 
 export type DuckDBTableBindFunction = (
   bindInfo: DuckDBTableFunctionBindInfo,
-) => void;
+) => void | Promise<void>;
 
 export type DuckDBTableInitFunction = (
   initInfo: DuckDBTableFunctionInitInfo,
-) => void;
+) => void | Promise<void>;
 
 /**
  * Produces one chunk of the scan per call.
@@ -19,14 +30,93 @@ export type DuckDBTableInitFunction = (
  * Set `outputDataChunk.rowCount` before writing, then write that many rows to
  * each column vector. A row count of zero reports that the scan is finished, so
  * a function that never sets zero never terminates.
+ *
+ * Like the other callbacks, may return a promise, which the scan waits for.
  */
 export type DuckDBTableMainFunction = (
   functionInfo: DuckDBTableFunctionInfo,
   outputDataChunk: DuckDBDataChunk,
-) => void;
+) => void | Promise<void>;
+
+/**
+ * Produces one chunk of the scan per call by filling column buffers in place,
+ * instead of writing vectors item by item, and returns the number of rows
+ * filled, at most `capacity`. Returning zero reports that the scan is
+ * finished.
+ *
+ * Each output column has room for `capacity` rows: a typed array (or an array
+ * of strings for VARCHAR) and a null mask, which is all zero at the start of
+ * each call. Every returned row must be written; values are left over from
+ * earlier calls. The buffers are only valid until the call returns, or its
+ * promise settles.
+ */
+export type DuckDBTableColumnarMainFunction = (
+  functionInfo: DuckDBTableFunctionInfo,
+  outputColumns: readonly DuckDBColumnarOutputColumn[],
+  capacity: number,
+) => number | Promise<number>;
+
+/** What a batches function can read about the scan it produces chunks for. */
+export interface DuckDBTableScan {
+  readonly bindData: object | undefined;
+  readonly extraInfo: object | undefined;
+  /** See `DuckDBTableFunctionInitInfo.getColumnIndexes`. */
+  readonly columnIndexes: readonly number[];
+}
+
+/**
+ * Produces the chunks of one scan, as an alternative to an init function and a
+ * main function.
+ *
+ * Each yielded chunk must have the scan's output columns (only the projected
+ * ones, with projection pushdown), and must not be modified once yielded.
+ * Chunks are produced ahead of DuckDB, up to the prefetch limit, and DuckDB
+ * takes them without waiting on JS unless none are ready. Throwing fails the
+ * query. If the scan ends early, such as for a `LIMIT`, iteration is stopped.
+ */
+export type DuckDBTableBatchesFunction = (
+  scan: DuckDBTableScan,
+) => AsyncIterable<DuckDBDataChunk> | Iterable<DuckDBDataChunk>;
+
+/**
+ * The typed arrays a typed array table can reference. Each gives its column's
+ * type: TINYINT for Int8Array, UTINYINT for Uint8Array, and so on up to DOUBLE
+ * for Float64Array and UBIGINT for BigUint64Array.
+ */
+export type DuckDBTypedArray =
+  | Int8Array
+  | Uint8Array
+  | Uint8ClampedArray
+  | Int16Array
+  | Uint16Array
+  | Int32Array
+  | Uint32Array
+  | BigInt64Array
+  | BigUint64Array
+  | Float32Array
+  | Float64Array;
+
+/**
+ * A column of a typed array table, optionally with a null mask of one byte per
+ * row, nonzero for NULL.
+ *
+ * A VARCHAR column is either UTF-8 bytes with one more offset than there are
+ * rows, as for `vector_assign_strings`, which are referenced like typed arrays,
+ * or an array of strings, which is encoded once, when the column is set.
+ */
+export type DuckDBTypedArrayColumn =
+  | DuckDBTypedArray
+  | { readonly values: DuckDBTypedArray; readonly nullMask?: Uint8Array }
+  | {
+      readonly utf8: Uint8Array;
+      readonly offsets: Uint32Array;
+      readonly nullMask?: Uint8Array;
+    }
+  | readonly (string | null)[];
 
 export class DuckDBTableFunction {
   readonly table_function: duckdb.TableFunction;
+  private readonly comparisonColumnNames: string[] = [];
 
   public constructor() {
     this.table_function = duckdb.create_table_function();
@@ -38,29 +128,61 @@ export class DuckDBTableFunction {
     initFunction,
     localInitFunction,
     mainFunction,
+    columnarMainFunction,
+    batchesFunction,
+    prefetchChunks,
+    workerPool,
     parameterTypes,
     namedParameterTypes,
+    comparisonParameterTypes,
     supportsProjectionPushdown,
     extraInfo,
   }: {
     name: string;
     bindFunction: DuckDBTableBindFunction;
-    initFunction: DuckDBTableInitFunction;
+    initFunction?: DuckDBTableInitFunction;
     localInitFunction?: DuckDBTableInitFunction;
-    mainFunction: DuckDBTableMainFunction;
+    mainFunction?: DuckDBTableMainFunction;
+    /** Alternative to `mainFunction`. */
+    columnarMainFunction?: DuckDBTableColumnarMainFunction;
+    /** Alternative to `initFunction` and `mainFunction`. */
+    batchesFunction?: DuckDBTableBatchesFunction;
+    /** See `setBatchesFunction`. */
+    prefetchChunks?: number;
+    /** Alternative to `mainFunction`, run by the pool's workers. */
+    workerPool?: DuckDBTableFunctionWorkerPool;
     parameterTypes?: readonly DuckDBType[];
     namedParameterTypes?: Readonly<Record<string, DuckDBType>>;
+    /** See `addComparisonParameters`. */
+    comparisonParameterTypes?: Readonly<Record<string, DuckDBType>>;
     supportsProjectionPushdown?: boolean;
     extraInfo?: object;
   }): DuckDBTableFunction {
     const tableFunction = new DuckDBTableFunction();
     tableFunction.setName(name);
     tableFunction.setBindFunction(bindFunction);
-    tableFunction.setInitFunction(initFunction);
+    if (batchesFunction) {
+      tableFunction.setBatchesFunction(batchesFunction, prefetchChunks);
+    } else if (initFunction && mainFunction) {
+      tableFunction.setInitFunction(initFunction);
+      tableFunction.setMainFunction(mainFunction);
+    } else if (initFunction && columnarMainFunction) {
+      tableFunction.setInitFunction(initFunction);
+      tableFunction.setColumnarMainFunction(columnarMainFunction);
+    } else if (initFunction && workerPool) {
+      if (localInitFunction) {
+        throw new Error('localInitFunction cannot be used with workerPool');
+      }
+      tableFunction.setInitFunction(initFunction);
+      tableFunction.setWorkerPool(workerPool);
+    } else {
+      throw new Error(
+        'Either batchesFunction, or initFunction and one of mainFunction, columnarMainFunction, or workerPool, are required',
+      );
+    }
     if (localInitFunction) {
       tableFunction.setLocalInitFunction(localInitFunction);
     }
-    tableFunction.setMainFunction(mainFunction);
     if (parameterTypes) {
       for (const parameterType of parameterTypes) {
         tableFunction.addParameter(parameterType);
@@ -74,6 +196,13 @@ export class DuckDBTableFunction {
         tableFunction.addNamedParameter(parameterName, parameterType);
       }
     }
+    if (comparisonParameterTypes) {
+      for (const [columnName, columnType] of Object.entries(
+        comparisonParameterTypes,
+      )) {
+        tableFunction.addComparisonParameters(columnName, columnType);
+      }
+    }
     if (supportsProjectionPushdown) {
       tableFunction.setSupportsProjectionPushdown(true);
     }
@@ -83,6 +212,20 @@ export class DuckDBTableFunction {
     return tableFunction;
   }
 
+  /**
+   * Creates a table function named `name` that scans `columns`; see
+   * `setTypedArrayColumns`.
+   */
+  public static createForTypedArrays(
+    name: string,
+    columns: Readonly<Record<string, DuckDBTypedArrayColumn>>,
+  ): DuckDBTableFunction {
+    const tableFunction = new DuckDBTableFunction();
+    tableFunction.setName(name);
+    tableFunction.setTypedArrayColumns(columns);
+    return tableFunction;
+  }
+
   public destroySync() {
     duckdb.destroy_table_function_sync(this.table_function);
   }
@@ -93,19 +236,21 @@ export class DuckDBTableFunction {
 
   public setBindFunction(bindFunction: DuckDBTableBindFunction) {
     duckdb.table_function_set_bind(this.table_function, (info) => {
-      bindFunction(new DuckDBTableFunctionBindInfo(info));
+      return bindFunction(
+        new DuckDBTableFunctionBindInfo(info, this.comparisonColumnNames),
+      );
     });
   }
 
   public setInitFunction(initFunction: DuckDBTableInitFunction) {
     duckdb.table_function_set_init(this.table_function, (info) => {
-      initFunction(new DuckDBTableFunctionInitInfo(info));
+      return initFunction(new DuckDBTableFunctionInitInfo(info));
     });
   }
 
   public setLocalInitFunction(localInitFunction: DuckDBTableInitFunction) {
     duckdb.table_function_set_local_init(this.table_function, (info) => {
-      localInitFunction(new DuckDBTableFunctionInitInfo(info));
+      return localInitFunction(new DuckDBTableFunctionInitInfo(info));
     });
   }
 
@@ -113,7 +258,7 @@ export class DuckDBTableFunction {
     duckdb.table_function_set_function(
       this.table_function,
       (info, output) => {
-        mainFunction(
+        return mainFunction(
           new DuckDBTableFunctionInfo(info),
           new DuckDBDataChunk(output),
         );
@@ -121,6 +266,172 @@ export class DuckDBTableFunction {
     );
   }
 
+  /**
+   * Sets a main function that fills typed arrays, which are then copied into
+   * the output chunk with one copy per column.
+   *
+   * Supported types are BOOLEAN, the integer types up to 64 bits, FLOAT,
+   * DOUBLE, DATE, TIME, TIMESTAMP (all variants), and VARCHAR.
+   */
+  public setColumnarMainFunction(
+    columnarMainFunction: DuckDBTableColumnarMainFunction,
+  ) {
+    // Buffers are reused across calls, keyed by the column types, which vary
+    // with projection pushdown. Calls overlap when the main function is async,
+    // so each call takes a set of buffers of its own.
+    const freeColumnSets = new Map<string, DuckDBColumnarOutputColumn[][]>();
+    duckdb.table_function_set_function(
+      this.table_function,
+      (info, output) => {
+        const columnCount = duckdb.data_chunk_get_column_count(output);
+        const vectors: duckdb.Vector[] = [];
+        for (let columnIndex = 0; columnIndex < columnCount; columnIndex++) {
+          vectors.push(duckdb.data_chunk_get_vector(output, columnIndex));
+        }
+        const key = vectors
+          .map((vector) =>
+            duckdb.get_type_id(duckdb.vector_get_column_type(vector)),
+          )
+          .join(',');
+        const free = freeColumnSets.get(key) ?? [];
+        freeColumnSets.set(key, free);
+        const capacity = duckdb.vector_size();
+        const columns =
+          free.pop() ??
+          vectors.map((vector) => createColumnarColumn(vector, capacity));
+        const write = (rowCount: number) => {
+          if (rowCount > capacity) {
+            throw new Error(
+              `Expected at most ${capacity} rows, but got ${rowCount}`,
+            );
+          }
+          duckdb.data_chunk_set_size(output, rowCount);
+          for (let columnIndex = 0; columnIndex < columnCount; columnIndex++) {
+            writeColumnarColumn(
+              vectors[columnIndex],
+              rowCount,
+              columns[columnIndex],
+            );
+          }
+          for (const column of columns) {
+            column.nullMask.fill(0);
+          }
+          free.push(columns);
+        };
+        const result = columnarMainFunction(
+          new DuckDBTableFunctionInfo(info),
+          columns,
+          capacity,
+        );
+        if (result instanceof Promise) {
+          return result.then(write);
+        }
+        write(result);
+      },
+    );
+  }
+
+  /**
+   * Sets the init and main functions to ones that scan the chunks produced by
+   * `batchesFunction`, keeping up to `prefetchChunks` of them ready ahead of
+   * DuckDB. This replaces any init data, so use bind data to pass state.
+   */
+  public setBatchesFunction(
+    batchesFunction: DuckDBTableBatchesFunction,
+    prefetchChunks: number = 4,
+  ) {
+    duckdb.table_function_set_init(this.table_function, (info) => {
+      const queue = duckdb.create_table_function_chunk_queue(prefetchChunks);
+      duckdb.init_set_chunk_queue(info, queue);
+      const initInfo = new DuckDBTableFunctionInitInfo(info);
+      // The init info is only valid during this call, so read what the
+      // batches function can see now, before iteration starts.
+      const scan: DuckDBTableScan = {
+        bindData: initInfo.bindData,
+        extraInfo: initInfo.extraInfo,
+        columnIndexes: initInfo.getColumnIndexes(),
+      };
+      void fillChunkQueue(queue, () => batchesFunction(scan));
+    });
+    duckdb.table_function_set_chunk_queue_function(this.table_function);
+  }
+
+  /**
+   * Makes the table function scan `columns`, keyed by column name, replacing
+   * its bind, init, and main functions. The scan runs natively on DuckDB's own
+   * threads, in parallel, without calling into JS, and supports projection
+   * pushdown. All columns must have the same number of rows.
+   *
+   * The arrays are referenced rather than copied, for as long as the table
+   * function is registered, so they must not be written to, resized, or
+   * transferred meanwhile.
+   */
+  public setTypedArrayColumns(
+    columns: Readonly<Record<string, DuckDBTypedArrayColumn>>,
+  ) {
+    duckdb.table_function_set_typed_array_columns(
+      this.table_function,
+      Object.entries(columns).map(([name, column]) =>
+        typedArrayTableColumn(name, column),
+      ),
+    );
+  }
+
+  /**
+   * Runs the scan on the workers of `workerPool`, each of DuckDB's scan
+   * threads on one worker, replacing any local init and main functions. Do not
+   * set either afterwards. The init function still runs here; see
+   * `DuckDBTableFunctionWorkerPool`.
+   */
+  public setWorkerPool(workerPool: DuckDBTableFunctionWorkerPool) {
+    duckdb.table_function_set_worker_pool(this.table_function, workerPool.pool);
+  }
+
+  /**
+   * The native equivalents of the setters above, each taking the C API
+   * callback exported from `library` as `symbol`. DuckDB calls them directly
+   * on its own threads.
+   *
+   * Native callbacks must not call the C API's extra info getters: they return
+   * the bindings' internal state, not the object given to `setExtraInfo`. Nor
+   * may they read bind data set from JS, and JS callbacks must not read bind
+   * data set by native ones.
+   */
+  public setNativeBindFunction(library: DuckDBNativeLibrary, symbol: string) {
+    duckdb.table_function_set_native_bind(
+      this.table_function,
+      library.library,
+      symbol,
+    );
+  }
+
+  public setNativeInitFunction(library: DuckDBNativeLibrary, symbol: string) {
+    duckdb.table_function_set_native_init(
+      this.table_function,
+      library.library,
+      symbol,
+    );
+  }
+
+  public setNativeLocalInitFunction(
+    library: DuckDBNativeLibrary,
+    symbol: string,
+  ) {
+    duckdb.table_function_set_native_local_init(
+      this.table_function,
+      library.library,
+      symbol,
+    );
+  }
+
+  public setNativeMainFunction(library: DuckDBNativeLibrary, symbol: string) {
+    duckdb.table_function_set_native_function(
+      this.table_function,
+      library.library,
+      symbol,
+    );
+  }
+
   public addParameter(parameterType: DuckDBType) {
     duckdb.table_function_add_parameter(
       this.table_function,
@@ -136,6 +447,23 @@ export class DuckDBTableFunction {
     );
   }
 
+  /**
+   * Adds named parameters for comparisons on `columnName`, which the scan
+   * reads in bind with `getComparisonParameters`: `columnName` followed by
+   * `_eq`, `_lt`, `_lte`, `_gt` or `_gte`, each of type `columnType`. For
+   * example, `from events(ts_gte => '2024-01-01')`.
+   *
+   * This is not filter pushdown. DuckDB's C API does not push a query's WHERE
+   * clause down into table functions, so `where ts >= ...` never reaches the
+   * scan; queries must pass the comparisons as parameters.
+   */
+  public addComparisonParameters(columnName: string, columnType: DuckDBType) {
+    this.comparisonColumnNames.push(columnName);
+    for (const suffix of Object.keys(comparisonParameterSuffixes)) {
+      this.addNamedParameter(`${columnName}_${suffix}`, columnType);
+    }
+  }
+
   public setSupportsProjectionPushdown(pushdown: boolean) {
     duckdb.table_function_supports_projection_pushdown(
       this.table_function,
@@ -147,3 +475,66 @@ export class DuckDBTableFunction {
     duckdb.table_function_set_extra_info(this.table_function, extraInfo);
   }
 }
+
+async function fillChunkQueue(
+  queue: duckdb.TableFunctionChunkQueue,
+  batches: () => AsyncIterable<DuckDBDataChunk> | Iterable<DuckDBDataChunk>,
+) {
+  try {
+    for await (const dataChunk of batches()) {
+      // An empty chunk would end the scan early.
+      if (dataChunk.rowCount === 0) {
+        continue;
+      }
+      const wanted = await duckdb.table_function_chunk_queue_push(
+        queue,
+        dataChunk.chunk,
+      );
+      if (!wanted) {
+        // The scan has ended. Leaving the loop stops the iterator.
+        return;
+      }
+    }
+    duckdb.table_function_chunk_queue_close(queue);
+  } catch (err) {
+    duckdb.table_function_chunk_queue_close(
+      queue,
+      err instanceof Error ? err.message : String(err),
+    );
+  }
+}
+
+function typedArrayTableColumn(
+  name: string,
+  column: DuckDBTypedArrayColumn,
+): duckdb.TypedArrayTableColumn {
+  if (ArrayBuffer.isView(column)) {
+    return { name, data: column as DuckDBTypedArray };
+  }
+  if (Array.isArray(column)) {
+    const values = column as readonly (string | null)[];
+    const { data, offsets } = encodeStrings(values, 0, values.length);
+    const hasNull = values.some((value) => value === null);
+    return {
+      name,
+      data,
+      offsets,
+      null_mask: hasNull
+        ? Uint8Array.from(values, (value) => (value === null ? 1 : 0))
+        : undefined,
+    };
+  }
+  if ('utf8' in column) {
+    return {
+      name,
+      data: column.utf8,
+      offsets: column.offsets,
+      null_mask: column.nullMask,
+    };
+  }
+  const { values, nullMask } = column as {
+    readonly values: DuckDBTypedArray;
+    readonly nullMask?: Uint8Array;
+  };
+  return { name, data: values, null_mask: nullMask };
+}
@@ -1,13 +1,45 @@
 import duckdb from '@duckdb/node-bindings';
 import { DuckDBClientContext } from './DuckDBClientContext';
+import { DuckDBLogicalType } from './DuckDBLogicalType';
 import { DuckDBType } from './DuckDBType';
 import { readValue } from './readValue';
 import { DuckDBValue } from './values';
 
+export type DuckDBComparisonOperator = '=' | '<' | '<=' | '>' | '>=';
+
+/**
+ * A comparison of a column with a constant, passed to a table function as a
+ * named parameter; see `getComparisonParameters`.
+ */
+export interface DuckDBComparisonParameter {
+  readonly columnName: string;
+  readonly comparison: DuckDBComparisonOperator;
+  readonly value: DuckDBValue;
+}
+
+/**
+ * The named parameters added for each comparison column, by suffix. A column
+ * `ts` gets `ts_eq`, `ts_lt`, `ts_lte`, `ts_gt` and `ts_gte`.
+ */
+export const comparisonParameterSuffixes: Readonly<
+  Record<string, DuckDBComparisonOperator>
+> = {
+  eq: '=',
+  lt: '<',
+  lte: '<=',
+  gt: '>',
+  gte: '>=',
+};
+
 export class DuckDBTableFunctionBindInfo {
   private readonly bind_info: duckdb.TableFunctionBindInfo;
-  constructor(bind_info: duckdb.TableFunctionBindInfo) {
+  private readonly comparisonColumnNames: readonly string[];
+  constructor(
+    bind_info: duckdb.TableFunctionBindInfo,
+    comparisonColumnNames: readonly string[] = [],
+  ) {
     this.bind_info = bind_info;
+    this.comparisonColumnNames = comparisonColumnNames;
   }
   public get clientContext(): DuckDBClientContext {
     return this.getClientContext();
@@ -37,6 +69,66 @@ export class DuckDBTableFunctionBindInfo {
     const value = duckdb.bind_get_named_parameter(this.bind_info, name);
     return value === null ? null : readValue(value);
   }
+  /**
+   * The comparisons the query passed explicitly as named parameters (see
+   * `DuckDBTableFunction.addComparisonParameters`), so the scan can skip data
+   * at its source. These never come from the query's WHERE clause, and DuckDB
+   * does not apply them itself: rows the scan returns are not filtered again.
+   *
+   * Throws if a comparison parameter is NULL, since a comparison with NULL
+   * matches no rows, which a scan ignoring it would not honor.
+   */
+  public get comparisonParameters(): DuckDBComparisonParameter[] {
+    return this.getComparisonParameters();
+  }
+  public getComparisonParameters(): DuckDBComparisonParameter[] {
+    const comparisonParameters: DuckDBComparisonParameter[] = [];
+    for (const columnName of this.comparisonColumnNames) {
+      for (const [suffix, comparison] of Object.entries(
+        comparisonParameterSuffixes,
+      )) {
+        const name = `${columnName}_${suffix}`;
+        const value = duckdb.bind_get_named_parameter(this.bind_info, name);
+        if (value === null) {
+          continue;
+        }
+        if (duckdb.is_null_value(value)) {
+          throw new Error(`Comparison parameter ${name} must not be NULL`);
+        }
+        comparisonParameters.push({
+          columnName,
+          comparison,
+          value: readValue(value),
+        });
+      }
+    }
+    return comparisonParameters;
+  }
+  /**
+   * The number of columns the function is expected to produce when it reads
+   * `COPY ... FROM` (see `DuckDBCopyFunction.setCopyFromFunction`), otherwise
+   * 0. These are the columns of the table being copied into.
+   */
+  public get expectedResultColumnCount(): number {
+    return this.getExpectedResultColumnCount();
+  }
+  public getExpectedResultColumnCount(): number {
+    return duckdb.table_function_bind_get_result_column_count(this.bind_info);
+  }
+  public getExpectedResultColumnName(columnIndex: number): string {
+    return duckdb.table_function_bind_get_result_column_name(
+      this.bind_info,
+      columnIndex,
+    );
+  }
+  public getExpectedResultColumnType(columnIndex: number): DuckDBType {
+    return DuckDBLogicalType.create(
+      duckdb.table_function_bind_get_result_column_type(
+        this.bind_info,
+        columnIndex,
+      ),
+    ).asType();
+  }
   public addResultColumn(name: string, type: DuckDBType) {
     duckdb.bind_add_result_column(
       this.bind_info,
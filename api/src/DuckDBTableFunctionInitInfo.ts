@@ -1,4 +1,5 @@
 import duckdb from '@duckdb/node-bindings';
+import { Json } from './Json';
 
 export class DuckDBTableFunctionInitInfo {
   private readonly init_info: duckdb.TableFunctionInitInfo;
@@ -43,6 +44,13 @@ export class DuckDBTableFunctionInitInfo {
   public setInitData(initData: object) {
     duckdb.init_set_init_data(this.init_info, initData);
   }
+  /**
+   * For a table function run by a worker pool, passes `data` to the workers,
+   * which read it as `scan.data`. Replaces any init data.
+   */
+  public setWorkerScanData(data: Json) {
+    duckdb.init_set_worker_scan_data(this.init_info, JSON.stringify(data));
+  }
   public setMaxThreads(maxThreads: number) {
     duckdb.init_set_max_threads(this.init_info, maxThreads);
   }
@@ -0,0 +1,105 @@
+import duckdb from '@duckdb/node-bindings';
+import { Worker } from 'node:worker_threads';
+import { DuckDBDataChunk } from './DuckDBDataChunk';
+import { DuckDBTableFunctionWorkerScan } from './DuckDBTableFunctionWorkerScan';
+import {
+  closePoolWorkers,
+  servePool,
+  startPoolWorkers,
+  WorkerPoolKeys,
+  WorkerPoolOptions,
+} from './workerPoolWorkers';
+
+/**
+ * Produces one chunk of one scan thread's part of the scan per call, like a
+ * `DuckDBTableMainFunction`. A row count of zero ends that thread's part.
+ */
+export type DuckDBTableWorkerMainFunction = (
+  scan: DuckDBTableFunctionWorkerScan,
+  outputDataChunk: DuckDBDataChunk,
+) => void | Promise<void>;
+
+const keys: WorkerPoolKeys = {
+  className: 'DuckDBTableFunctionWorkerPool',
+  poolIdKey: 'duckdbTableFunctionWorkerPoolId',
+  messageKey: 'duckdbTableFunctionWorkerPool',
+};
+
+/**
+ * Runs the scans of table functions in worker threads.
+ *
+ * A table function's main function normally runs on the main thread, however
+ * many threads DuckDB scans with. A table function given a worker pool (with
+ * `workerPool` or `setWorkerPool`) instead assigns each of DuckDB's scan
+ * threads to one of the pool's workers, which produces all of that thread's
+ * chunks, so a partitioned source is read on as many cores as there are
+ * workers.
+ *
+ * The init function still runs on the main thread. It sets how many threads
+ * may scan with `setMaxThreads`, and describes the scan to the workers with
+ * `setWorkerScanData`. Workers share no state, so they divide the source by
+ * claiming partitions with `scan.nextPartition()`, and keep their progress
+ * with `scan.setState`.
+ *
+ * Each worker runs a module that calls `DuckDBTableFunctionWorkerPool.serve`
+ * with the main function.
+ */
+export class DuckDBTableFunctionWorkerPool {
+  readonly pool: duckdb.TableFunctionWorkerPool;
+  readonly id: number;
+  private readonly workers: Worker[] = [];
+
+  public constructor() {
+    this.pool = duckdb.create_table_function_worker_pool();
+    this.id = duckdb.table_function_worker_pool_get_id(this.pool);
+  }
+
+  /**
+   * Starts `workerCount` workers running `filename`, and resolves once all of
+   * them are serving.
+   */
+  public static async create(
+    filename: string | URL,
+    options?: WorkerPoolOptions,
+  ): Promise<DuckDBTableFunctionWorkerPool> {
+    const workerPool = new DuckDBTableFunctionWorkerPool();
+    await startPoolWorkers(
+      keys,
+      workerPool.id,
+      workerPool.workers,
+      filename,
+      options,
+    );
+    return workerPool;
+  }
+
+  /**
+   * Serves scans from the pool that started this worker. Call once, from the
+   * worker's module.
+   */
+  public static serve(mainFunction: DuckDBTableWorkerMainFunction) {
+    servePool(
+      keys,
+      (poolId) =>
+        duckdb.table_function_worker_pool_attach(poolId, (scan, output) =>
+          mainFunction(
+            new DuckDBTableFunctionWorkerScan(scan),
+            new DuckDBDataChunk(output),
+          ),
+        ),
+      (poolId) => duckdb.table_function_worker_pool_detach(poolId),
+    );
+  }
+
+  public get workerCount(): number {
+    return this.workers.length;
+  }
+
+  /**
+   * Detaches and terminates all workers. Call once queries using the pool
+   * have finished; scans started afterwards fail.
+   */
+  public async close(): Promise<void> {
+    await closePoolWorkers(keys, this.workers);
+  }
+}
@@ -0,0 +1,38 @@
+import duckdb from '@duckdb/node-bindings';
+import { Json } from './Json';
+
+/**
+ * One DuckDB thread's part of a scan run by a table function worker pool, as
+ * seen from the worker serving it. Only valid during the main call it is passed
+ * to, but state set on it is kept for the thread's later calls.
+ */
+export class DuckDBTableFunctionWorkerScan {
+  private readonly scan: duckdb.TableFunctionWorkerScan;
+  constructor(scan: duckdb.TableFunctionWorkerScan) {
+    this.scan = scan;
+  }
+  /** The data the init function set with `setWorkerScanData`. */
+  public get data(): Json | undefined {
+    return this.getData();
+  }
+  public getData(): Json | undefined {
+    const data = duckdb.table_function_worker_scan_get_data(this.scan);
+    return data === undefined ? undefined : JSON.parse(data);
+  }
+  /**
+   * Claims the next partition number, counting up from 0 across every thread
+   * of the scan, so each partition is claimed by exactly one of them.
+   */
+  public nextPartition(): number {
+    return duckdb.table_function_worker_scan_next_partition(this.scan);
+  }
+  public get state(): object | undefined {
+    return this.getState();
+  }
+  public getState(): object | undefined {
+    return duckdb.table_function_worker_scan_get_state(this.scan);
+  }
+  public setState(state: object) {
+    duckdb.table_function_worker_scan_set_state(this.scan, state);
+  }
+}
@@ -6,27 +6,48 @@ export {
 } from '@duckdb/node-bindings';
 export * from './configurationOptionDescriptions';
 export * from './createDuckDBValueConverter';
+export * from './DuckDBAggregateFunction';
+export * from './DuckDBAggregateFunctionInfo';
+export * from './DuckDBAggregateFunctionSet';
 export * from './DuckDBAppender';
+export * from './DuckDBCastFunction';
+export * from './DuckDBCastFunctionInfo';
 export * from './DuckDBClientContext';
 export * from './DuckDBConnection';
+export * from './DuckDBCopyFunction';
+export * from './DuckDBCopyFunctionBindInfo';
+export * from './DuckDBCopyFunctionFinalizeInfo';
+export * from './DuckDBCopyFunctionGlobalInitInfo';
+export * from './DuckDBCopyFunctionSinkInfo';
 export * from './DuckDBDataChunk';
+export * from './DuckDBDataChunkPool';
+export * from './DuckDBExpression';
 export * from './DuckDBExtractedStatements';
+export * from './DuckDBFileSource';
+export * from './DuckDBFileSystem';
 export * from './DuckDBInstance';
 export * from './DuckDBInstanceCache';
 export * from './DuckDBLogicalType';
 export * from './DuckDBMaterializedResult';
+export * from './DuckDBNativeLibrary';
 export * from './DuckDBPendingResult';
 export * from './DuckDBPreparedStatement';
 export * from './DuckDBPreparedStatementCollection';
+export * from './DuckDBReplacementScanInfo';
 export * from './DuckDBResult';
 export * from './DuckDBResultReader';
 export * from './DuckDBScalarFunction';
 export * from './DuckDBScalarFunctionBindInfo';
 export * from './DuckDBScalarFunctionInfo';
+export * from './DuckDBScalarFunctionInitInfo';
+export * from './DuckDBScalarFunctionSet';
+export * from './DuckDBScalarFunctionWorkerPool';
 export * from './DuckDBTableFunction';
 export * from './DuckDBTableFunctionBindInfo';
 export * from './DuckDBTableFunctionInfo';
 export * from './DuckDBTableFunctionInitInfo';
+export * from './DuckDBTableFunctionWorkerPool';
+export * from './DuckDBTableFunctionWorkerScan';
 export * from './DuckDBType';
 export * from './DuckDBTypeId';
 export * from './DuckDBValueConverter';
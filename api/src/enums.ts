@@ -1,5 +1,14 @@
 import duckdb from '@duckdb/node-bindings';
 
+export type CastMode = duckdb.CastMode;
+export const CastMode = duckdb.CastMode;
+
+export type ErrorType = duckdb.ErrorType;
+export const ErrorType = duckdb.ErrorType;
+
+export type FileFlag = duckdb.FileFlag;
+export const FileFlag = duckdb.FileFlag;
+
 export type ResultReturnType = duckdb.ResultType;
 export const ResultReturnType = duckdb.ResultType;
 
@@ -0,0 +1,363 @@
+import crypto from 'node:crypto';
+import http from 'node:http';
+import { AddressInfo } from 'node:net';
+import path from 'node:path';
+import {
+  DuckDBByteRange,
+  DuckDBFileSource,
+  DuckDBFileSourceReadOptions,
+} from './DuckDBFileSource';
+
+interface QueuedRead extends DuckDBByteRange {
+  resolve: (data: Uint8Array) => void;
+  reject: (reason: unknown) => void;
+}
+
+interface MergedRange extends DuckDBByteRange {
+  reads: QueuedRead[];
+}
+
+/**
+ * Merges reads, sorted by offset, into ranges: a read that overlaps or
+ * adjoins the previous range joins it, unless that would make the range
+ * longer than `maxRangeLength`.
+ */
+function mergeReads(
+  reads: readonly QueuedRead[],
+  maxRangeLength: number,
+): MergedRange[] {
+  const ranges: MergedRange[] = [];
+  let current: MergedRange | undefined;
+  for (const read of reads) {
+    const end = Math.max(
+      current ? current.offset + current.length : 0,
+      read.offset + read.length,
+    );
+    if (
+      current &&
+      read.offset <= current.offset + current.length &&
+      end - current.offset <= maxRangeLength
+    ) {
+      current.length = end - current.offset;
+      current.reads.push(read);
+    } else {
+      current = { offset: read.offset, length: read.length, reads: [read] };
+      ranges.push(current);
+    }
+  }
+  return ranges;
+}
+
+/**
+ * Batches the reads of one file source. Reads are queued, and the queue is
+ * flushed on the next turn of the event loop, or once a pending call to
+ * `read` completes if `maxPendingReads` are already pending, so reads made
+ * close together, such as by several DuckDB threads, share calls. A flush
+ * merges the queued reads into ranges, and passes up to `maxRangesPerRead`
+ * ranges to each call.
+ */
+export class FileSourceReader {
+  private readonly source: DuckDBFileSource;
+  private readonly maxRangeLength: number;
+  private readonly maxRangesPerRead: number;
+  private readonly maxPendingReads: number;
+  private queue: QueuedRead[] = [];
+  private pendingReadCount = 0;
+  private flushScheduled = false;
+
+  constructor(
+    source: DuckDBFileSource,
+    {
+      maxRangeLength = 8 * 1024 * 1024,
+      maxRangesPerRead = 16,
+      maxPendingReads = 4,
+    }: DuckDBFileSourceReadOptions = {},
+  ) {
+    if (maxRangeLength < 1 || maxRangesPerRead < 1 || maxPendingReads < 1) {
+      throw new Error('File source read options must be at least 1');
+    }
+    this.source = source;
+    this.maxRangeLength = maxRangeLength;
+    this.maxRangesPerRead = maxRangesPerRead;
+    this.maxPendingReads = maxPendingReads;
+  }
+
+  /**
+   * Reads `length` bytes at `offset`, in pieces of at most `maxRangeLength`,
+   * returning one promise per piece, in order.
+   */
+  public read(offset: number, length: number): Promise<Uint8Array>[] {
+    const pieces: Promise<Uint8Array>[] = [];
+    const end = offset + length;
+    for (let start = offset; start < end; start += this.maxRangeLength) {
+      pieces.push(
+        new Promise<Uint8Array>((resolve, reject) => {
+          this.queue.push({
+            offset: start,
+            length: Math.min(this.maxRangeLength, end - start),
+            resolve,
+            reject,
+          });
+        }),
+      );
+    }
+    this.scheduleFlush();
+    return pieces;
+  }
+
+  private scheduleFlush() {
+    if (this.flushScheduled || this.queue.length === 0) {
+      return;
+    }
+    this.flushScheduled = true;
+    setImmediate(() => {
+      this.flushScheduled = false;
+      this.flush();
+    });
+  }
+
+  private flush() {
+    if (this.pendingReadCount >= this.maxPendingReads) {
+      return;
+    }
+    const reads = this.queue.sort((a, b) => a.offset - b.offset);
+    this.queue = [];
+    const ranges = mergeReads(reads, this.maxRangeLength);
+    let rangeIndex = 0;
+    while (
+      rangeIndex < ranges.length &&
+      this.pendingReadCount < this.maxPendingReads
+    ) {
+      this.startRead(
+        ranges.slice(rangeIndex, rangeIndex + this.maxRangesPerRead),
+      );
+      rangeIndex += this.maxRangesPerRead;
+    }
+    // Ranges left over wait for a pending call, and may merge with new reads.
+    for (const range of ranges.slice(rangeIndex)) {
+      this.queue.push(...range.reads);
+    }
+  }
+
+  private startRead(ranges: readonly MergedRange[]) {
+    this.pendingReadCount++;
+    void (async () => {
+      try {
+        const buffers = await this.source.read(
+          ranges.map(({ offset, length }) => ({ offset, length })),
+        );
+        if (buffers.length !== ranges.length) {
+          throw new Error(
+            `File source returned ${buffers.length} buffers for ${ranges.length} ranges`,
+          );
+        }
+        for (let i = 0; i < ranges.length; i++) {
+          const { offset, length } = ranges[i];
+          if (buffers[i].length !== length) {
+            throw new Error(
+              `File source returned ${buffers[i].length} bytes for the ${length}-byte range at offset ${offset}`,
+            );
+          }
+        }
+        for (let i = 0; i < ranges.length; i++) {
+          for (const read of ranges[i].reads) {
+            const start = read.offset - ranges[i].offset;
+            read.resolve(buffers[i].subarray(start, start + read.length));
+          }
+        }
+      } catch (error) {
+        for (const range of ranges) {
+          for (const read of range.reads) {
+            read.reject(error);
+          }
+        }
+      } finally {
+        this.pendingReadCount--;
+        this.scheduleFlush();
+      }
+    })();
+  }
+}
+
+/**
+ * Parses a `Range` header of one range: `bytes=a-b`, `bytes=a-` or `bytes=-n`.
+ * Returns undefined if there is no header, and null if the range cannot be
+ * served.
+ */
+function parseRange(
+  header: string | undefined,
+  size: number,
+): DuckDBByteRange | null | undefined {
+  if (header === undefined) {
+    return undefined;
+  }
+  const match = /^bytes=(\d*)-(\d*)$/.exec(header.trim());
+  if (!match || (match[1] === '' && match[2] === '')) {
+    return null;
+  }
+  let start: number;
+  let end: number;
+  if (match[1] === '') {
+    start = Math.max(0, size - Number(match[2]));
+    end = size - 1;
+  } else {
+    start = Number(match[1]);
+    end = match[2] === '' ? size - 1 : Math.min(Number(match[2]), size - 1);
+  }
+  if (start >= size || end < start) {
+    return null;
+  }
+  return { offset: start, length: end - start + 1 };
+}
+
+/** Waits until `response` can be written to again, or has closed. */
+function waitForDrain(response: http.ServerResponse): Promise<void> {
+  return new Promise((resolve) => {
+    const done = () => {
+      response.off('drain', done);
+      response.off('close', done);
+      resolve();
+    };
+    response.on('drain', done);
+    response.on('close', done);
+  });
+}
+
+interface ServedFileSource {
+  reader: FileSourceReader;
+  size: number;
+}
+
+/**
+ * Serves file sources over HTTP on the loopback interface, so DuckDB can read
+ * them through the httpfs extension, which asks for only the byte ranges it
+ * needs. Each source is served at a random path, so its URL can neither be
+ * guessed by another process nor reused by a later registration.
+ */
+export class FileSourceServer {
+  private readonly server: http.Server;
+  private readonly baseUrl: string;
+  private readonly sources = new Map<string, ServedFileSource>();
+
+  private constructor(server: http.Server, baseUrl: string) {
+    this.server = server;
+    this.baseUrl = baseUrl;
+  }
+
+  public static async start(): Promise<FileSourceServer> {
+    const server = http.createServer();
+    await new Promise<void>((resolve, reject) => {
+      server.once('error', reject);
+      server.listen(0, '127.0.0.1', () => {
+        server.off('error', reject);
+        resolve();
+      });
+    });
+    // A running query keeps the process alive; the server alone should not.
+    server.unref();
+    const { port } = server.address() as AddressInfo;
+    const fileSourceServer = new FileSourceServer(
+      server,
+      `http://127.0.0.1:${port}`,
+    );
+    server.on('request', (request, response) =>
+      fileSourceServer.handle(request, response),
+    );
+    return fileSourceServer;
+  }
+
+  /**
+   * Serves `source` at a new URL, which ends in the base name of `name`, so
+   * readers can detect the file's format from its extension.
+   */
+  public add(
+    name: string,
+    source: DuckDBFileSource,
+    size: number,
+    options?: DuckDBFileSourceReadOptions,
+  ): string {
+    const reader = new FileSourceReader(source, options);
+    const urlPath = `/${crypto.randomUUID()}/${encodeURIComponent(path.basename(name))}`;
+    this.sources.set(urlPath, { reader, size });
+    return this.baseUrl + urlPath;
+  }
+
+  public remove(url: string) {
+    this.sources.delete(url.slice(this.baseUrl.length));
+  }
+
+  public close() {
+    this.server.close();
+    this.server.closeAllConnections();
+  }
+
+  private handle(
+    request: http.IncomingMessage,
+    response: http.ServerResponse,
+  ) {
+    const served = this.sources.get((request.url ?? '').split('?')[0]);
+    if (!served) {
+      response.writeHead(404).end();
+      return;
+    }
+    if (request.method !== 'GET' && request.method !== 'HEAD') {
+      response.writeHead(405, { Allow: 'GET, HEAD' }).end();
+      return;
+    }
+    const { reader, size } = served;
+    const range = parseRange(request.headers.range, size);
+    if (range === null) {
+      response.writeHead(416, { 'Content-Range': `bytes */${size}` }).end();
+      return;
+    }
+    const { offset, length } = range ?? { offset: 0, length: size };
+    const status = range ? 206 : 200;
+    const headers: http.OutgoingHttpHeaders = {
+      'Accept-Ranges': 'bytes',
+      'Content-Length': length,
+      'Content-Type': 'application/octet-stream',
+    };
+    if (range) {
+      headers['Content-Range'] = `bytes ${offset}-${offset + length - 1}/${size}`;
+    }
+    if (request.method === 'HEAD') {
+      response.writeHead(status, headers).end();
+      return;
+    }
+    const pieces = reader.read(offset, length);
+    // Pieces after a failed one are not awaited, but reject too.
+    for (const piece of pieces) {
+      piece.catch(() => {});
+    }
+    void (async () => {
+      try {
+        for (const piece of pieces) {
+          const data = await piece;
+          // Headers wait for the first piece, so a failed read can still
+          // be answered with an error status.
+          if (!response.headersSent) {
+            response.writeHead(status, headers);
+          }
+          if (!response.write(data)) {
+            await waitForDrain(response);
+          }
+          if (response.destroyed) {
+            return;
+          }
+        }
+        if (!response.headersSent) {
+          response.writeHead(status, headers);
+        }
+        response.end();
+      } catch (error) {
+        if (response.headersSent) {
+          response.destroy();
+        } else {
+          response
+            .writeHead(500, { 'Content-Type': 'text/plain' })
+            .end(error instanceof Error ? error.message : String(error));
+        }
+      }
+    })();
+  }
+}
@@ -6,8 +6,8 @@ import { DuckDBValue } from './values';
  * Converts a `duckdb.Value` into a `DuckDBValue`.
  *
  * Results normally arrive as vectors rather than values, so this is for the
- * places that hand back a value instead: table function parameters, and
- * `duckdb_get_table_names`.
+ * places that hand back a value instead: table function parameters, folded
+ * expressions, and `duckdb_get_table_names`.
  *
  * It works by referencing the value into a vector of its own and reading the one
  * element back, which reuses the vector reading path rather than duplicating it.
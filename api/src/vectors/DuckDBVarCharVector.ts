@@ -5,6 +5,7 @@ import {
 import { DuckDBVector } from './DuckDBVector';
 import { DuckDBValidity } from './DuckDBValidity';
 import {
+  encodeStrings,
   getString,
   vectorData,
 } from './dataAccessors';
@@ -69,21 +70,33 @@ export class DuckDBVarCharVector extends DuckDBVector<string> {
     this.itemCacheDirty[itemIndex] = true;
   }
   public flush() {
-    for (let itemIndex = 0; itemIndex < this._itemCount; itemIndex++) {
-      if (this.itemCacheDirty[itemIndex]) {
-        const cachedItem = this.itemCache[itemIndex];
-        if (cachedItem !== undefined && cachedItem !== null) {
-          duckdb.vector_assign_string_element(
-            this.vector,
-            this.itemOffset + itemIndex,
-            cachedItem
-          );
+    // Assign each run of consecutive dirty items with a single native call.
+    let runStart = -1;
+    for (let itemIndex = 0; itemIndex <= this._itemCount; itemIndex++) {
+      if (itemIndex < this._itemCount && this.itemCacheDirty[itemIndex]) {
+        if (runStart < 0) {
+          runStart = itemIndex;
         }
-        this.itemCacheDirty[itemIndex] = false;
+      } else if (runStart >= 0) {
+        this.flushRun(runStart, itemIndex);
+        runStart = -1;
       }
     }
     this.validity.flush(this.vector);
   }
+  private flushRun(start: number, end: number) {
+    const { data, offsets } = encodeStrings(this.itemCache, start, end);
+    // TextEncoder always produces valid UTF-8, so validation can be skipped.
+    duckdb.unsafe_vector_assign_strings(
+      this.vector,
+      this.itemOffset + start,
+      data,
+      offsets
+    );
+    for (let itemIndex = start; itemIndex < end; itemIndex++) {
+      this.itemCacheDirty[itemIndex] = false;
+    }
+  }
   public override slice(offset: number, length: number): DuckDBVarCharVector {
     return new DuckDBVarCharVector(
       new DataView(
@@ -0,0 +1,258 @@
+import duckdb from '@duckdb/node-bindings';
+import { DuckDBTypeId } from '../DuckDBTypeId';
+import { encodeStrings, getString, vectorData } from './dataAccessors';
+
+/**
+ * The values of one column, as a typed array for fixed-width types or as an
+ * array of strings for VARCHAR.
+ *
+ * Typed arrays hold the raw values as stored by DuckDB: BOOLEAN as one byte
+ * per value, DATE as days since the epoch, TIME and TIMESTAMP as microseconds
+ * (or the unit of the TIMESTAMP variant), and so on. Entries for NULL rows are
+ * unspecified.
+ */
+export type DuckDBColumnarValues =
+  | Int8Array
+  | Uint8Array
+  | Int16Array
+  | Uint16Array
+  | Int32Array
+  | Uint32Array
+  | BigInt64Array
+  | BigUint64Array
+  | Float32Array
+  | Float64Array
+  | readonly (string | null)[];
+
+export interface DuckDBColumnarColumn {
+  values: DuckDBColumnarValues;
+  /**
+   * One byte per row, nonzero where the row is NULL. Null when no row is
+   * NULL.
+   */
+  nullMask: Uint8Array | null;
+}
+
+type DuckDBColumnarTypedArray = Exclude<
+  DuckDBColumnarValues,
+  readonly (string | null)[]
+>;
+
+/**
+ * A column to be filled in place: a typed array, or an array of strings for
+ * VARCHAR, and a null mask with one byte per row, nonzero where the row is
+ * NULL.
+ */
+export interface DuckDBColumnarOutputColumn {
+  readonly values: DuckDBColumnarTypedArray | (string | null)[];
+  readonly nullMask: Uint8Array;
+}
+
+interface TypedArrayConstructor {
+  readonly BYTES_PER_ELEMENT: number;
+  readonly name: string;
+  new (
+    buffer: ArrayBuffer,
+    byteOffset: number,
+    length: number
+  ): DuckDBColumnarTypedArray;
+}
+
+function typedArrayConstructorForTypeId(
+  typeId: DuckDBTypeId
+): TypedArrayConstructor | null {
+  switch (typeId) {
+    case DuckDBTypeId.BOOLEAN:
+    case DuckDBTypeId.UTINYINT:
+      return Uint8Array;
+    case DuckDBTypeId.TINYINT:
+      return Int8Array;
+    case DuckDBTypeId.SMALLINT:
+      return Int16Array;
+    case DuckDBTypeId.USMALLINT:
+      return Uint16Array;
+    case DuckDBTypeId.INTEGER:
+    case DuckDBTypeId.DATE:
+      return Int32Array;
+    case DuckDBTypeId.UINTEGER:
+      return Uint32Array;
+    case DuckDBTypeId.BIGINT:
+    case DuckDBTypeId.TIME:
+    case DuckDBTypeId.TIMESTAMP:
+    case DuckDBTypeId.TIMESTAMP_S:
+    case DuckDBTypeId.TIMESTAMP_MS:
+    case DuckDBTypeId.TIMESTAMP_NS:
+    case DuckDBTypeId.TIMESTAMP_TZ:
+      return BigInt64Array;
+    case DuckDBTypeId.UBIGINT:
+      return BigUint64Array;
+    case DuckDBTypeId.FLOAT:
+      return Float32Array;
+    case DuckDBTypeId.DOUBLE:
+      return Float64Array;
+    default:
+      return null;
+  }
+}
+
+function vectorTypeId(vector: duckdb.Vector): DuckDBTypeId {
+  return duckdb.get_type_id(
+    duckdb.vector_get_column_type(vector)
+  ) as number as DuckDBTypeId;
+}
+
+function unsupportedTypeError(typeId: DuckDBTypeId): Error {
+  return new Error(
+    `Columnar values are not supported for type ${DuckDBTypeId[typeId]}`
+  );
+}
+
+function readNullMask(
+  vector: duckdb.Vector,
+  rowCount: number
+): Uint8Array | null {
+  const validity = duckdb.vector_get_validity(
+    vector,
+    Math.ceil(rowCount / 64) * 8
+  );
+  if (!validity) {
+    return null;
+  }
+  let nullMask: Uint8Array | null = null;
+  for (let row = 0; row < rowCount; row++) {
+    if ((validity[row >> 3] & (1 << (row & 7))) === 0) {
+      if (!nullMask) {
+        nullMask = new Uint8Array(rowCount);
+      }
+      nullMask[row] = 1;
+    }
+  }
+  return nullMask;
+}
+
+/** Reads the first `rowCount` values of a flat vector into columnar form. */
+export function readColumnarColumn(
+  vector: duckdb.Vector,
+  rowCount: number
+): DuckDBColumnarColumn {
+  const typeId = vectorTypeId(vector);
+  const nullMask = readNullMask(vector, rowCount);
+  if (typeId === DuckDBTypeId.VARCHAR) {
+    const data = vectorData(vector, rowCount * 16);
+    const dataView = new DataView(
+      data.buffer,
+      data.byteOffset,
+      data.byteLength
+    );
+    const values: (string | null)[] = new Array(rowCount);
+    for (let row = 0; row < rowCount; row++) {
+      values[row] =
+        nullMask && nullMask[row] ? null : getString(dataView, row * 16);
+    }
+    return { values, nullMask };
+  }
+  const ArrayType = typedArrayConstructorForTypeId(typeId);
+  if (!ArrayType) {
+    throw unsupportedTypeError(typeId);
+  }
+  let data = vectorData(vector, rowCount * ArrayType.BYTES_PER_ELEMENT);
+  if (data.byteOffset % ArrayType.BYTES_PER_ELEMENT !== 0) {
+    data = data.slice();
+  }
+  return {
+    values: new ArrayType(data.buffer as ArrayBuffer, data.byteOffset, rowCount),
+    nullMask,
+  };
+}
+
+/**
+ * Writes the first `rowCount` values of a column into a flat vector. Strings
+ * that are null, and rows set in `nullMask`, become NULL.
+ */
+export function writeColumnarColumn(
+  vector: duckdb.Vector,
+  rowCount: number,
+  column: DuckDBColumnarColumn
+) {
+  const { values } = column;
+  let { nullMask } = column;
+  if (values.length < rowCount) {
+    throw new Error(
+      `Expected at least ${rowCount} columnar values, but got ${values.length}`
+    );
+  }
+  const typeId = vectorTypeId(vector);
+  if (Array.isArray(values)) {
+    if (typeId !== DuckDBTypeId.VARCHAR) {
+      throw new Error(
+        `Expected a typed array for type ${DuckDBTypeId[typeId]}, but got an array`
+      );
+    }
+    const { data, offsets } = encodeStrings(values, 0, rowCount);
+    // TextEncoder always produces valid UTF-8, so validation can be skipped.
+    duckdb.unsafe_vector_assign_strings(vector, 0, data, offsets);
+    let stringNullMask: Uint8Array | null = null;
+    for (let row = 0; row < rowCount; row++) {
+      if (values[row] == null) {
+        if (!stringNullMask) {
+          stringNullMask = nullMask
+            ? nullMask.slice(0, rowCount)
+            : new Uint8Array(rowCount);
+        }
+        stringNullMask[row] = 1;
+      }
+    }
+    if (stringNullMask) {
+      nullMask = stringNullMask;
+    }
+  } else {
+    const ArrayType = typedArrayConstructorForTypeId(typeId);
+    if (!ArrayType) {
+      throw unsupportedTypeError(typeId);
+    }
+    const typedValues = values as DuckDBColumnarTypedArray;
+    if (!(typedValues instanceof ArrayType)) {
+      throw new Error(
+        `Expected ${ArrayType.name} for type ${DuckDBTypeId[typeId]}, but got ${typedValues.constructor.name}`
+      );
+    }
+    duckdb.copy_data_to_vector(
+      vector,
+      0,
+      typedValues.buffer as ArrayBuffer,
+      typedValues.byteOffset,
+      rowCount * ArrayType.BYTES_PER_ELEMENT
+    );
+  }
+  if (nullMask) {
+    duckdb.vector_set_null_mask(vector, nullMask, rowCount);
+  }
+}
+
+/**
+ * Creates an empty column with room for `capacity` values of the type of
+ * `vector`, to be filled and then written with `writeColumnarColumn`. Its null
+ * mask is allocated, with no row NULL.
+ */
+export function createColumnarColumn(
+  vector: duckdb.Vector,
+  capacity: number
+): DuckDBColumnarOutputColumn {
+  const typeId = vectorTypeId(vector);
+  const nullMask = new Uint8Array(capacity);
+  if (typeId === DuckDBTypeId.VARCHAR) {
+    return { values: new Array<string | null>(capacity).fill(null), nullMask };
+  }
+  const ArrayType = typedArrayConstructorForTypeId(typeId);
+  if (!ArrayType) {
+    throw unsupportedTypeError(typeId);
+  }
+  return {
+    values: new ArrayType(
+      new ArrayBuffer(capacity * ArrayType.BYTES_PER_ELEMENT),
+      0,
+      capacity
+    ),
+    nullMask,
+  };
+}
@@ -81,6 +81,38 @@ export function getString(dataView: DataView, offset: number): string {
   return textDecoder.decode(stringBytes);
 }
 
+export const textEncoder = new TextEncoder();
+
+/**
+ * Encodes `values[start]` through `values[end - 1]` into one contiguous UTF-8
+ * buffer, along with `end - start + 1` offsets delimiting each string, in the
+ * form expected by `vector_assign_strings`. Null and undefined values encode
+ * as empty strings.
+ */
+export function encodeStrings(
+  values: readonly (string | null | undefined)[],
+  start: number,
+  end: number
+): { data: Uint8Array; offsets: Uint32Array } {
+  // A UTF-16 code unit never takes more than 3 bytes in UTF-8.
+  let maxByteCount = 0;
+  for (let i = start; i < end; i++) {
+    maxByteCount += (values[i]?.length ?? 0) * 3;
+  }
+  const data = new Uint8Array(maxByteCount);
+  const offsets = new Uint32Array(end - start + 1);
+  let byteOffset = 0;
+  for (let i = start; i < end; i++) {
+    const value = values[i];
+    if (value) {
+      byteOffset += textEncoder.encodeInto(value, data.subarray(byteOffset))
+        .written;
+    }
+    offsets[i - start + 1] = byteOffset;
+  }
+  return { data: data.subarray(0, byteOffset), offsets };
+}
+
 export function getBuffer(dataView: DataView, offset: number): Buffer {
   const stringBytes = getStringBytes(dataView, offset);
   return Buffer.from(stringBytes);
@@ -1,3 +1,4 @@
+export * from './columnarData';
 export * from './DuckDBArrayVector';
 export * from './DuckDBBigIntVector';
 export * from './DuckDBBigNumVector';
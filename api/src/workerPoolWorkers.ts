@@ -0,0 +1,151 @@
+import os from 'node:os';
+import {
+  isMainThread,
+  parentPort,
+  Worker,
+  WorkerOptions,
+  workerData,
+} from 'node:worker_threads';
+
+/**
+ * How a worker pool class and the workers it starts find each other: the pool
+ * id is passed in `workerData` under `poolIdKey`, and the attach and detach
+ * handshake is posted under `messageKey`.
+ */
+export interface WorkerPoolKeys {
+  readonly className: string;
+  readonly poolIdKey: string;
+  readonly messageKey: string;
+}
+
+export interface WorkerPoolOptions {
+  /** Defaults to the available parallelism. */
+  workerCount?: number;
+  workerOptions?: WorkerOptions;
+}
+
+/**
+ * Starts `workerCount` workers running `filename`, adding them to `workers`,
+ * and resolves once all of them are serving. If any fails to start, closes
+ * all of them and rejects.
+ */
+export async function startPoolWorkers(
+  keys: WorkerPoolKeys,
+  poolId: number,
+  workers: Worker[],
+  filename: string | URL,
+  {
+    workerCount = os.availableParallelism(),
+    workerOptions,
+  }: WorkerPoolOptions = {},
+): Promise<void> {
+  try {
+    await Promise.all(
+      Array.from({ length: workerCount }, () =>
+        startPoolWorker(keys, poolId, workers, filename, workerOptions),
+      ),
+    );
+  } catch (err) {
+    await closePoolWorkers(keys, workers);
+    throw err;
+  }
+}
+
+/**
+ * Starts a worker running `filename` and adds it to `workers`. Resolves once it
+ * is serving.
+ */
+function startPoolWorker(
+  keys: WorkerPoolKeys,
+  poolId: number,
+  workers: Worker[],
+  filename: string | URL,
+  workerOptions: WorkerOptions | undefined,
+): Promise<void> {
+  const worker = new Worker(filename, {
+    ...workerOptions,
+    workerData: { ...workerOptions?.workerData, [keys.poolIdKey]: poolId },
+  });
+  workers.push(worker);
+  return new Promise<void>((resolve, reject) => {
+    const onMessage = (message: unknown) => {
+      if (isPoolMessage(keys, message, 'attached')) {
+        worker.off('message', onMessage);
+        worker.off('error', reject);
+        resolve();
+      }
+    };
+    worker.on('message', onMessage);
+    worker.once('error', reject);
+    worker.once('exit', (code) =>
+      reject(new Error(`Worker exited with code ${code} before serving`)),
+    );
+  });
+}
+
+/**
+ * Called from a worker's module. Attaches with `attach`, then detaches with
+ * `detach` when the pool asks.
+ */
+export function servePool(
+  keys: WorkerPoolKeys,
+  attach: (poolId: number) => void,
+  detach: (poolId: number) => void,
+) {
+  if (
+    isMainThread ||
+    !parentPort ||
+    workerData?.[keys.poolIdKey] === undefined
+  ) {
+    throw new Error(
+      `serve must be called from a worker started by ${keys.className}`,
+    );
+  }
+  const poolId: number = workerData[keys.poolIdKey];
+  const port = parentPort;
+  attach(poolId);
+  const onMessage = (message: unknown) => {
+    if (isPoolMessage(keys, message, 'detach')) {
+      detach(poolId);
+      port.off('message', onMessage);
+      port.postMessage({ [keys.messageKey]: 'detached' });
+    }
+  };
+  port.on('message', onMessage);
+  port.postMessage({ [keys.messageKey]: 'attached' });
+}
+
+/** Detaches and terminates all of `workers`, removing them. */
+export async function closePoolWorkers(
+  keys: WorkerPoolKeys,
+  workers: Worker[],
+): Promise<void> {
+  await Promise.all(
+    workers.splice(0).map(async (worker) => {
+      await new Promise<void>((resolve) => {
+        const onMessage = (message: unknown) => {
+          if (isPoolMessage(keys, message, 'detached')) {
+            worker.off('message', onMessage);
+            resolve();
+          }
+        };
+        worker.on('message', onMessage);
+        worker.once('exit', () => resolve());
+        worker.postMessage({ [keys.messageKey]: 'detach' });
+      });
+      await worker.terminate();
+    }),
+  );
+}
+
+function isPoolMessage(
+  keys: WorkerPoolKeys,
+  message: unknown,
+  kind: string,
+): boolean {
+  return (
+    typeof message === 'object' &&
+    message !== null &&
+    (message as Record<string, unknown>)[keys.messageKey] === kind
+  );
+}
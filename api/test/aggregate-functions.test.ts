@@ -0,0 +1,179 @@
+import { assert, describe, test } from 'vitest';
+import { DOUBLE, INTEGER, VARCHAR } from '../src';
+import { DuckDBAggregateFunction } from '../src/DuckDBAggregateFunction';
+import { DuckDBAggregateFunctionSet } from '../src/DuckDBAggregateFunctionSet';
+import { sleep } from '../src/sleep';
+import { withConnection } from './util/testHelpers';
+
+function createSum(name = 'my_sum') {
+  return DuckDBAggregateFunction.create<number>({
+    name,
+    parameterTypes: [INTEGER],
+    returnType: INTEGER,
+    initState: () => 0,
+    update: (_info, input, states) => {
+      input.visitColumnValues(0, (value, rowIndex) => {
+        states.set(rowIndex, states.get(rowIndex) + (value as number));
+      });
+    },
+    combine: (_info, source, target) => source + target,
+    finalize: (_info, state) => state,
+  });
+}
+
+describe('aggregate functions', () => {
+  test('aggregate function (grouped)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerAggregateFunction(createSum());
+      const reader = await connection.runAndReadAll(
+        'select v % 3 as k, my_sum(v::integer) as s from range(10) t(v) group by k order by k',
+      );
+      assert.deepEqual(reader.getColumnsObject(), {
+        k: [0n, 1n, 2n],
+        s: [18, 12, 15],
+      });
+    });
+  });
+
+  test('aggregate function (parallel combine)', async () => {
+    await withConnection(async (connection) => {
+      await connection.run('set threads = 4');
+      connection.registerAggregateFunction(createSum());
+      const reader = await connection.runAndReadAll(
+        'select my_sum((v % 7)::integer) as s from range(1000000) t(v)',
+      );
+      const expected = Number(
+        (
+          await connection.runAndReadAll(
+            'select sum(v % 7)::integer as s from range(1000000) t(v)',
+          )
+        ).getColumnsObject().s[0],
+      );
+      assert.deepEqual(reader.getColumnsObject(), { s: [expected] });
+    });
+  });
+
+  test('aggregate function (object states)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerAggregateFunction(
+        DuckDBAggregateFunction.create<{ sum: number; count: number }>({
+          name: 'my_avg',
+          parameterTypes: [INTEGER],
+          returnType: DOUBLE,
+          initState: () => ({ sum: 0, count: 0 }),
+          update: (_info, input, states) => {
+            input.visitColumnValues(0, (value, rowIndex) => {
+              const state = states.get(rowIndex);
+              state.sum += value as number;
+              state.count++;
+            });
+          },
+          combine: (_info, source, target) => ({
+            sum: source.sum + target.sum,
+            count: source.count + target.count,
+          }),
+          finalize: (_info, { sum, count }) => (count ? sum / count : null),
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select my_avg(v::integer) as a from range(4) t(v)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { a: [1.5] });
+    });
+  });
+
+  test('aggregate function (extra info)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerAggregateFunction(
+        DuckDBAggregateFunction.create<string>({
+          name: 'my_label',
+          parameterTypes: [INTEGER],
+          returnType: VARCHAR,
+          initState: () => '',
+          update: () => {},
+          combine: (_info, _source, target) => target,
+          finalize: (info) => JSON.stringify(info.extraInfo),
+          extraInfo: { 'my_extra_info_key': 'my_extra_info_value' },
+        }),
+      );
+      const reader = await connection.runAndReadAll('select my_label(1) as l');
+      assert.deepEqual(reader.getColumnsObject(), {
+        l: ['{"my_extra_info_key":"my_extra_info_value"}'],
+      });
+    });
+  });
+
+  test('aggregate function (async update)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerAggregateFunction(
+        DuckDBAggregateFunction.create<number>({
+          name: 'my_count',
+          parameterTypes: [INTEGER],
+          returnType: INTEGER,
+          initState: () => 0,
+          update: async (_info, input, states) => {
+            await sleep(1);
+            for (let rowIndex = 0; rowIndex < input.rowCount; rowIndex++) {
+              states.set(rowIndex, states.get(rowIndex) + 1);
+            }
+          },
+          combine: (_info, source, target) => source + target,
+          finalize: (_info, state) => state,
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select my_count(1) as c from range(5000)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { c: [5000] });
+    });
+  });
+
+  test('aggregate function set', async () => {
+    await withConnection(async (connection) => {
+      const concat = DuckDBAggregateFunction.create<string>({
+        name: 'my_sum',
+        parameterTypes: [VARCHAR],
+        returnType: VARCHAR,
+        initState: () => '',
+        update: (_info, input, states) => {
+          input.visitColumnValues(0, (value, rowIndex) => {
+            states.set(rowIndex, states.get(rowIndex) + String(value));
+          });
+        },
+        combine: (_info, source, target) => target + source,
+        finalize: (_info, state) => state,
+      });
+      connection.registerAggregateFunctionSet(
+        DuckDBAggregateFunctionSet.create('my_sum', [createSum(), concat]),
+      );
+      const reader = await connection.runAndReadAll(
+        `select my_sum(v::integer) as i, my_sum('x') as s from range(3) t(v)`,
+      );
+      assert.deepEqual(reader.getColumnsObject(), { i: [3], s: ['xxx'] });
+    });
+  });
+
+  test('aggregate function (error handling)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerAggregateFunction(
+        DuckDBAggregateFunction.create<number>({
+          name: 'my_fail',
+          parameterTypes: [INTEGER],
+          returnType: INTEGER,
+          initState: () => 0,
+          update: () => {
+            throw new Error('my_error');
+          },
+          combine: (_info, source, target) => source + target,
+          finalize: (_info, state) => state,
+        }),
+      );
+      try {
+        await connection.run('select my_fail(1)');
+        assert.fail('should throw');
+      } catch (err) {
+        assert.deepEqual(err, new Error('Invalid Input Error: my_error'));
+      }
+    });
+  });
+});
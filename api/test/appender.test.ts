@@ -10,6 +10,7 @@ import {
   DuckDBBlobVector,
   DuckDBBooleanVector,
   DuckDBDataChunk,
+  DuckDBDataChunkPool,
   DuckDBDateVector,
   DuckDBDecimal128Vector,
   DuckDBDecimal16Vector,
@@ -47,6 +48,7 @@ import {
   DuckDBUnionVector,
   DuckDBValue,
   DuckDBVarCharVector,
+  ErrorType,
   INTEGER,
   LIST,
   MAP,
@@ -702,6 +704,109 @@ describe('appender', () => {
       }
     });
   });
+  test('append to column subset', async () => {
+    await withConnection(async (connection) => {
+      await connection.run(
+        'create table target(a int, b int default 42, c varchar default \'x\', d int)',
+      );
+      const appender = await connection.createAppender('target');
+      appender.addColumns(['d', 'a']);
+      assert.equal(appender.columnCount, 2);
+      appender.appendInteger(4);
+      appender.appendInteger(1);
+      appender.endRow();
+      appender.clearColumns();
+      assert.equal(appender.columnCount, 4);
+      appender.appendInteger(10);
+      appender.appendInteger(20);
+      appender.appendVarchar('y');
+      appender.appendInteger(40);
+      appender.endRow();
+      appender.flushSync();
+
+      const reader = await connection.runAndReadAll('from target');
+      assert.deepEqual(reader.getRows(), [
+        [1, 42, 'x', 4],
+        [10, 20, 'y', 40],
+      ]);
+    });
+  });
+  test('append defaults to data chunk', async () => {
+    await withConnection(async (connection) => {
+      await connection.run('create table target(a int, b int default 42)');
+      const appender = await connection.createAppender('target');
+      const chunk = DuckDBDataChunk.create([INTEGER, INTEGER], 2);
+      chunk.setColumnValues(0, [1, 2]);
+      appender.appendDefaultToChunk(chunk, 1, 0);
+      appender.appendDefaultToChunk(chunk, 1, 1);
+      appender.appendDataChunk(chunk);
+      appender.flushSync();
+
+      const reader = await connection.runAndReadAll('from target');
+      assert.deepEqual(reader.getRows(), [
+        [1, 42],
+        [2, 42],
+      ]);
+    });
+  });
+  test('clear after failed flush', async () => {
+    await withConnection(async (connection) => {
+      await connection.run('create table target(a int primary key)');
+      const appender = await connection.createAppender('target');
+      assert.isNull(appender.errorData);
+      appender.appendInteger(1);
+      appender.endRow();
+      appender.appendInteger(1);
+      appender.endRow();
+      assert.throws(() => appender.flushSync());
+      assert.equal(appender.errorData?.errorType, ErrorType.CONSTRAINT);
+
+      appender.clear();
+      appender.appendInteger(2);
+      appender.endRow();
+      appender.flushSync();
+
+      const reader = await connection.runAndReadAll('from target');
+      assert.deepEqual(reader.getRows(), [[2]]);
+    });
+  });
+  test('append data chunks from pool', async () => {
+    await withConnection(async (connection) => {
+      await connection.run('create table target(a int, b varchar)');
+      const appender = await connection.createAppender('target');
+      const pool = new DuckDBDataChunkPool();
+
+      const chunk1 = pool.acquire([INTEGER, VARCHAR], 2);
+      chunk1.setColumns([
+        [1, 2],
+        ['one', 'two'],
+      ]);
+      appender.appendDataChunk(chunk1);
+      pool.release(chunk1);
+      assert.equal(chunk1.rowCount, 0);
+      assert.throws(
+        () => pool.release(chunk1),
+        'Data chunk was not acquired from this pool',
+      );
+
+      const chunk2 = pool.acquire([INTEGER, VARCHAR], 1);
+      assert.strictEqual(chunk2, chunk1);
+      chunk2.setColumns([[3], ['three']]);
+      appender.appendDataChunk(chunk2);
+      pool.release(chunk2);
+
+      const chunk3 = pool.acquire([INTEGER]);
+      assert.notStrictEqual(chunk3, chunk1);
+      appender.flushSync();
+
+      const reader = await connection.runAndReadAll('from target');
+      assert.deepEqual(reader.getRows(), [
+        [1, 'one'],
+        [2, 'two'],
+        [3, 'three'],
+      ]);
+    });
+  });
   test('append all types row-by-row', async () => {
     await withConnection(async (connection) => {
       const types = createTestAllTypesColumnTypes();
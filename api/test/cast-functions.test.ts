@@ -0,0 +1,79 @@
+import { assert, describe, test } from 'vitest';
+import { CastMode, UTINYINT, VARCHAR } from '../src';
+import { DuckDBCastFunction } from '../src/DuckDBCastFunction';
+import { withConnection } from './util/testHelpers';
+
+describe('cast functions', () => {
+  test('cast function', async () => {
+    await withConnection(async (connection) => {
+      connection.registerCastFunction(
+        DuckDBCastFunction.create({
+          sourceType: UTINYINT,
+          targetType: VARCHAR,
+          mainFunction: (_info, input, output) => {
+            for (let rowIndex = 0; rowIndex < input.itemCount; rowIndex++) {
+              output.setItem(rowIndex, `u${input.getItem(rowIndex)}`);
+            }
+            output.flush();
+          },
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select v::utinyint::varchar as s from range(3) t(v)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { s: ['u0', 'u1', 'u2'] });
+    });
+  });
+
+  test('cast function (implicit)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerCastFunction(
+        DuckDBCastFunction.create({
+          sourceType: UTINYINT,
+          targetType: VARCHAR,
+          mainFunction: (info, input, output) => {
+            const { prefix } = info.extraInfo as { prefix: string };
+            for (let rowIndex = 0; rowIndex < input.itemCount; rowIndex++) {
+              output.setItem(rowIndex, `${prefix}${input.getItem(rowIndex)}`);
+            }
+            output.flush();
+          },
+          implicitCastCost: 1,
+          extraInfo: { prefix: 'x' },
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select upper(7::utinyint) as s',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { s: ['X7'] });
+    });
+  });
+
+  test('cast function (try cast)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerCastFunction(
+        DuckDBCastFunction.create({
+          sourceType: UTINYINT,
+          targetType: VARCHAR,
+          mainFunction: (info, input, output) => {
+            output.flush();
+            for (let rowIndex = 0; rowIndex < input.itemCount; rowIndex++) {
+              info.setRowError('my_error', rowIndex);
+            }
+            return info.castMode === CastMode.TRY;
+          },
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select try_cast(7::utinyint as varchar) as s',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { s: [null] });
+      try {
+        await connection.run('select 7::utinyint::varchar');
+        assert.fail('should throw');
+      } catch (err) {
+        assert.include((err as Error).message, 'my_error');
+      }
+    });
+  });
+});
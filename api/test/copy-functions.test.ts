@@ -0,0 +1,139 @@
+import { assert, describe, test } from 'vitest';
+import {
+  DuckDBDataChunk,
+  DuckDBListValue,
+  DuckDBType,
+  DuckDBValue,
+  INTEGER,
+  VARCHAR,
+} from '../src';
+import { DuckDBCopyFunction } from '../src/DuckDBCopyFunction';
+import { DuckDBTableFunction } from '../src/DuckDBTableFunction';
+import { sleep, withConnection } from './util/testHelpers';
+
+const copySql = `copy (select range::integer as i, range::varchar as s from range(3)) to 'my_file.my' (format my_format, my_option 7)`;
+
+describe('copy functions', () => {
+  test('copy function', async () => {
+    await withConnection(async (connection) => {
+      const rows: DuckDBValue[][] = [];
+      let options: Record<string, DuckDBValue> = {};
+      let filePath = '';
+      let finalized = false;
+      connection.registerCopyFunction(
+        DuckDBCopyFunction.create({
+          name: 'my_format',
+          bindFunction: (info) => {
+            assert.equal(info.columnCount, 2);
+            assert.deepEqual(info.getColumnType(0), INTEGER);
+            options = info.options;
+            info.setBindData({ rows });
+          },
+          globalInitFunction: (info) => {
+            filePath = info.filePath;
+          },
+          sinkFunction: (info, chunk) => {
+            const { rows } = info.bindData as { rows: DuckDBValue[][] };
+            rows.push(...chunk.getRows());
+          },
+          finalizeFunction: () => {
+            finalized = true;
+          },
+        }),
+      );
+      await connection.run(copySql);
+      assert.deepEqual(rows, [
+        [0, '0'],
+        [1, '1'],
+        [2, '2'],
+      ]);
+      assert.equal(filePath, 'my_file.my');
+      assert.instanceOf(options.my_option, DuckDBListValue);
+      assert.isTrue(finalized);
+    });
+  });
+
+  test('copy function (async sink)', async () => {
+    await withConnection(async (connection) => {
+      const written: DuckDBValue[][] = [];
+      let writtenAtFinalize = 0;
+      connection.registerCopyFunction(
+        DuckDBCopyFunction.create({
+          name: 'my_format',
+          asyncSinkFunction: async (chunks) => {
+            await sleep(1);
+            for (const chunk of chunks) {
+              written.push(...chunk.getRows());
+            }
+          },
+          maxPendingChunks: 2,
+          finalizeFunction: () => {
+            writtenAtFinalize = written.length;
+          },
+        }),
+      );
+      await connection.run(copySql);
+      assert.equal(written.length, 3);
+      assert.equal(writtenAtFinalize, 3);
+    });
+  });
+
+  test('copy function (error)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerCopyFunction(
+        DuckDBCopyFunction.create({
+          name: 'my_format',
+          bindFunction: (info) => info.setError('my_error'),
+        }),
+      );
+      try {
+        await connection.run(copySql);
+        assert.fail('should throw');
+      } catch (err) {
+        assert.include((err as Error).message, 'my_error');
+      }
+    });
+  });
+
+  test('copy function (copy from)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerCopyFunction(
+        DuckDBCopyFunction.create({
+          name: 'my_format',
+          copyFromFunction: DuckDBTableFunction.create({
+            name: 'my_format_reader',
+            parameterTypes: [VARCHAR],
+            bindFunction: (info) => {
+              const types: DuckDBType[] = [];
+              for (let i = 0; i < info.expectedResultColumnCount; i++) {
+                const type = info.getExpectedResultColumnType(i);
+                info.addResultColumn(info.getExpectedResultColumnName(i), type);
+                types.push(type);
+              }
+              info.setBindData({ path: info.getParameter(0), types });
+            },
+            batchesFunction: function* ({ bindData }) {
+              const { path, types } = bindData as {
+                path: string;
+                types: DuckDBType[];
+              };
+              const chunk = DuckDBDataChunk.create(types);
+              chunk.setColumns([
+                [1, 2],
+                [`${path}_1`, `${path}_2`],
+              ]);
+              yield chunk;
+            },
+          }),
+        }),
+      );
+      await connection.run('create table t (i integer, s varchar)');
+      await connection.run(`copy t from 'my_file.my' (format my_format)`);
+      const reader = await connection.runAndReadAll('select * from t');
+      assert.deepEqual(reader.getColumnsObject(), {
+        i: [1, 2],
+        s: ['my_file.my_1', 'my_file.my_2'],
+      });
+    });
+  });
+});
@@ -1,5 +1,6 @@
 import { assert, beforeAll, describe, test } from 'vitest';
 import {
+  ErrorType,
   ResultReturnType,
   StatementType,
 } from '../src';
@@ -10,6 +11,13 @@ import {
 describe('enums', () => {
   beforeAll(setDefaultTimezone);
 
+  test('ErrorType enum', () => {
+    assert.equal(ErrorType.INVALID, 0);
+    assert.equal(ErrorType.CONSTRAINT, 18);
+    assert.equal(ErrorType.INVALID_CONFIGURATION, 42);
+    assert.equal(ErrorType[ErrorType.CONSTRAINT], 'CONSTRAINT');
+  });
+
   test('ReturnResultType enum', () => {
     assert.equal(ResultReturnType.INVALID, 0);
     assert.equal(ResultReturnType.CHANGED_ROWS, 1);
@@ -0,0 +1,254 @@
+import fs from 'node:fs';
+import os from 'node:os';
+import path from 'node:path';
+import { assert, describe, test } from 'vitest';
+import { DuckDBByteRange, DuckDBInstance } from '../src';
+import { FileSourceReader } from '../src/fileSourceServer';
+
+describe('file system', () => {
+  test('write and read a file', async () => {
+    const instance = await DuckDBInstance.create();
+    const connection = await instance.connect();
+    const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'duckdb-fs-'));
+    try {
+      const filePath = path.join(dir, 'my_file.txt');
+      const fileSystem = connection.clientContext.fileSystem;
+      fileSystem.writeFile(filePath, new TextEncoder().encode('hello file'));
+      const handle = fileSystem.open(filePath, { read: true });
+      assert.equal(handle.size, 10);
+      handle.seek(6);
+      const buffer = new Uint8Array(4);
+      assert.equal(handle.read(buffer), 4);
+      assert.equal(new TextDecoder().decode(buffer), 'file');
+      handle.close();
+      assert.equal(
+        new TextDecoder().decode(fileSystem.readFile(filePath)),
+        'hello file',
+      );
+    } finally {
+      fs.rmSync(dir, { recursive: true, force: true });
+    }
+  });
+
+  test('register file buffer', async () => {
+    const instance = await DuckDBInstance.create();
+    const connection = await instance.connect();
+    const filePath = instance.registerFileBuffer(
+      'people.csv',
+      new TextEncoder().encode('id,name\n1,Alice\n2,Bob\n'),
+    );
+    assert.equal(instance.getFileBufferPath('people.csv'), filePath);
+    const reader = await connection.runAndReadAll(
+      `select * from read_csv('${filePath}') order by id`,
+    );
+    assert.deepEqual(reader.getColumnsObject(), {
+      id: [1n, 2n],
+      name: ['Alice', 'Bob'],
+    });
+    instance.unregisterFileBuffer('people.csv');
+    assert.isUndefined(instance.getFileBufferPath('people.csv'));
+    // The old path fails to open rather than reaching another file.
+    try {
+      await connection.run(`select * from read_csv('${filePath}')`);
+      assert.fail('should throw');
+    } catch (err) {
+      assert.notEqual((err as Error).message, 'should throw');
+    }
+  });
+
+  test('register file buffers past the fd limit', async () => {
+    // Registered buffers hold no fds, so registering and unregistering more
+    // buffers than the soft fd limit must not run out. A very high limit is
+    // capped, and checked instead by counting open fds.
+    const softFdLimit =
+      process.platform === 'linux'
+        ? Number(
+            /^Max open files\s+(\d+)/m.exec(
+              fs.readFileSync('/proc/self/limits', 'utf8'),
+            )?.[1] ?? 1024,
+          )
+        : 1024;
+    const count = Math.min(softFdLimit, 65536) + 1;
+    const openFdCount = () =>
+      process.platform === 'linux'
+        ? fs.readdirSync('/proc/self/fd').length
+        : undefined;
+    const instance = await DuckDBInstance.create();
+    const fdCountBefore = openFdCount();
+    const data = new TextEncoder().encode('n\n1\n');
+    const paths = new Set<string>();
+    for (let i = 0; i < count; i++) {
+      paths.add(instance.registerFileBuffer('upload.csv', data));
+      instance.unregisterFileBuffer('upload.csv');
+    }
+    assert.equal(paths.size, count);
+    assert.equal(openFdCount(), fdCountBefore);
+    instance.closeSync();
+  }, 60000);
+
+  test('file source reader', async () => {
+    const data = new Uint8Array(100).map((_, i) => i);
+    const calls: DuckDBByteRange[][] = [];
+    const reader = new FileSourceReader(
+      {
+        size: () => data.length,
+        read: (ranges) => {
+          calls.push([...ranges]);
+          return ranges.map(({ offset, length }) =>
+            data.slice(offset, offset + length),
+          );
+        },
+      },
+      { maxRangeLength: 16, maxRangesPerRead: 2, maxPendingReads: 1 },
+    );
+    const reads: [number, number][] = [
+      [8, 8],
+      [0, 8],
+      [12, 8],
+      [40, 4],
+      [60, 20],
+    ];
+    const pieces = reads.map(([offset, length]) =>
+      reader.read(offset, length),
+    );
+    for (let i = 0; i < reads.length; i++) {
+      const [offset, length] = reads[i];
+      const buffers = await Promise.all(pieces[i]);
+      assert.deepEqual(
+        buffers.flatMap((buffer) => [...buffer]),
+        [...data.slice(offset, offset + length)],
+      );
+    }
+    // Reads are merged by byte range, split at 16 bytes, and batched two
+    // ranges to a call, one call at a time.
+    assert.deepEqual(calls, [
+      [
+        { offset: 0, length: 16 },
+        { offset: 12, length: 8 },
+      ],
+      [
+        { offset: 40, length: 4 },
+        { offset: 60, length: 16 },
+      ],
+      [{ offset: 76, length: 4 }],
+    ]);
+  });
+
+  test('file source reader error', async () => {
+    const reader = new FileSourceReader({
+      size: () => 1024,
+      read: async () => {
+        throw new Error('my_read_error');
+      },
+    });
+    const results = await Promise.allSettled([
+      ...reader.read(0, 16),
+      ...reader.read(512, 16),
+    ]);
+    assert.deepEqual(results, [
+      { status: 'rejected', reason: new Error('my_read_error') },
+      { status: 'rejected', reason: new Error('my_read_error') },
+    ]);
+  });
+
+  test('register file source', async () => {
+    const instance = await DuckDBInstance.create();
+    const data = new TextEncoder().encode('id,name\n1,Alice\n2,Bob\n');
+    const url = await instance.registerFileSource('people.csv', {
+      size: () => data.length,
+      read: (ranges) =>
+        ranges.map(({ offset, length }) =>
+          data.slice(offset, offset + length),
+        ),
+    });
+    try {
+      assert.equal(instance.getFileSourceUrl('people.csv'), url);
+      assert.isTrue(url.endsWith('/people.csv'));
+      const head = await fetch(url, { method: 'HEAD' });
+      assert.equal(head.status, 200);
+      assert.equal(head.headers.get('content-length'), String(data.length));
+      assert.equal(head.headers.get('accept-ranges'), 'bytes');
+      const range = await fetch(url, { headers: { Range: 'bytes=8-15' } });
+      assert.equal(range.status, 206);
+      assert.equal(
+        range.headers.get('content-range'),
+        `bytes 8-15/${data.length}`,
+      );
+      assert.equal(await range.text(), '1,Alice\n');
+      const all = await fetch(url);
+      assert.equal(all.status, 200);
+      assert.equal(await all.text(), 'id,name\n1,Alice\n2,Bob\n');
+      const unsatisfiable = await fetch(url, {
+        headers: { Range: 'bytes=100-' },
+      });
+      assert.equal(unsatisfiable.status, 416);
+      await unsatisfiable.arrayBuffer();
+      instance.unregisterFileSource('people.csv');
+      assert.isUndefined(instance.getFileSourceUrl('people.csv'));
+      const unregistered = await fetch(url);
+      assert.equal(unregistered.status, 404);
+      await unregistered.arrayBuffer();
+    } finally {
+      instance.closeSync();
+    }
+  });
+
+  test('register file source (httpfs)', async ({ skip }) => {
+    const instance = await DuckDBInstance.create();
+    const connection = await instance.connect();
+    try {
+      try {
+        await connection.run('load httpfs');
+      } catch {
+        try {
+          await connection.run('install httpfs; load httpfs');
+        } catch {
+          skip('httpfs is not available');
+        }
+      }
+      const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'duckdb-fs-'));
+      let data = new Uint8Array();
+      try {
+        const filePath = path.join(dir, 'numbers.parquet');
+        await connection.run(
+          `copy (select range as a, md5(range::varchar) as b from range(100000)) to '${filePath}'`,
+        );
+        data = fs.readFileSync(filePath);
+      } finally {
+        fs.rmSync(dir, { recursive: true, force: true });
+      }
+      let bytesRead = 0;
+      const url = await instance.registerFileSource('numbers.parquet', {
+        size: () => data.length,
+        read: async (ranges) =>
+          ranges.map(({ offset, length }) => {
+            bytesRead += length;
+            return data.slice(offset, offset + length);
+          }),
+      });
+      const reader = await connection.runAndReadAll(
+        `select sum(a)::bigint as s from read_parquet('${url}')`,
+      );
+      assert.deepEqual(reader.getColumnsObject(), { s: [4999950000n] });
+      // Only the footer and the chunks of column a are read.
+      assert.isAbove(bytesRead, 0);
+      assert.isBelow(bytesRead, data.length / 2);
+
+      const failingUrl = await instance.registerFileSource('failing.parquet', {
+        size: () => data.length,
+        read: async () => {
+          throw new Error('my_read_error');
+        },
+      });
+      try {
+        await connection.run(`from read_parquet('${failingUrl}')`);
+        assert.fail('should throw');
+      } catch (err) {
+        assert.notEqual((err as Error).message, 'should throw');
+      }
+    } finally {
+      connection.closeSync();
+      instance.closeSync();
+    }
+  });
+});
@@ -0,0 +1,64 @@
+import { assert, beforeAll, describe, expect, test } from 'vitest';
+import {
+  DuckDBDataChunk,
+  DuckDBInstance,
+  DuckDBTableFunction,
+  INTEGER,
+  VARCHAR,
+} from '../src';
+import { setDefaultTimezone } from './util/testHelpers';
+
+describe('replacement scans', () => {
+  beforeAll(setDefaultTimezone);
+
+  test('replacement scan (registered sources)', async () => {
+    const instance = await DuckDBInstance.create();
+    const connection = await instance.connect();
+    type Source = { id: number[]; name: string[] };
+    const sources = new Map<string, Source>([
+      ['people', { id: [1, 2], name: ['Alice', 'Bob'] }],
+    ]);
+    connection.registerTableFunction(
+      DuckDBTableFunction.create({
+        name: 'js_source',
+        parameterTypes: [VARCHAR],
+        bindFunction: (info) => {
+          info.addResultColumn('id', INTEGER);
+          info.addResultColumn('name', VARCHAR);
+          const sourceName = info.getParameter(0) as string;
+          info.setBindData({ source: sources.get(sourceName) });
+        },
+        batchesFunction: function* ({ bindData }) {
+          const { source } = bindData as { source: Source };
+          const chunk = DuckDBDataChunk.create([INTEGER, VARCHAR]);
+          chunk.setColumns([source.id, source.name]);
+          yield chunk;
+        },
+      }),
+    );
+    instance.addReplacementScan((info, tableName) => {
+      if (sources.has(tableName)) {
+        info.setFunctionName('js_source');
+        info.addParameter(tableName);
+      }
+    });
+    const reader = await connection.runAndReadAll(
+      'select name from people where id = 2',
+    );
+    assert.deepEqual(reader.getColumnsObject(), { name: ['Bob'] });
+    await expect(
+      connection.runAndReadAll('select * from not_a_source'),
+    ).rejects.toThrow('not_a_source');
+  });
+
+  test('replacement scan (error)', async () => {
+    const instance = await DuckDBInstance.create();
+    const connection = await instance.connect();
+    instance.addReplacementScan((info, tableName) => {
+      info.setError(`no source named ${tableName}`);
+    });
+    await expect(
+      connection.runAndReadAll('select * from my_table'),
+    ).rejects.toThrow('no source named my_table');
+  });
+});
@@ -1,15 +1,53 @@
+import { createRequire } from 'node:module';
 import { assert, beforeAll, describe, test } from 'vitest';
 import {
+  BOOLEAN,
+  DOUBLE,
   DuckDBValue,
   INTEGER,
   VARCHAR,
 } from '../src';
+import { DuckDBNativeLibrary } from '../src/DuckDBNativeLibrary';
 import { DuckDBScalarFunction } from '../src/DuckDBScalarFunction';
+import { DuckDBScalarFunctionSet } from '../src/DuckDBScalarFunctionSet';
+import { DuckDBScalarFunctionWorkerPool } from '../src/DuckDBScalarFunctionWorkerPool';
+import { sleep } from '../src/sleep';
 import {
+  nativeFunctionsFixturePath,
   setDefaultTimezone,
   withConnection,
 } from './util/testHelpers';
 
+const bindingsPath = createRequire(import.meta.url).resolve(
+  '@duckdb/node-bindings',
+);
+
+// Workers cannot load the TypeScript sources, so instead of calling serve, this
+// does what serve does using the bindings directly.
+const doubleItWorkerSource = `
+  const { parentPort, workerData } = require('node:worker_threads');
+  const duckdb = require(workerData.bindingsPath);
+  const poolId = workerData.duckdbScalarFunctionWorkerPoolId;
+  duckdb.scalar_function_worker_pool_attach(poolId, (input, output) => {
+    const rowCount = duckdb.data_chunk_get_size(input);
+    const inputData = duckdb.vector_get_data(
+      duckdb.data_chunk_get_vector(input, 0),
+      rowCount * 4,
+    );
+    const inputValues = new Int32Array(inputData.buffer, inputData.byteOffset, rowCount);
+    const outputValues = inputValues.map((value) => value * 2);
+    duckdb.copy_data_to_vector(output, 0, outputValues.buffer, 0, outputValues.byteLength);
+  });
+  parentPort.on('message', (message) => {
+    if (message.duckdbScalarFunctionWorkerPool === 'detach') {
+      duckdb.scalar_function_worker_pool_detach(poolId);
+      parentPort.postMessage({ duckdbScalarFunctionWorkerPool: 'detached' });
+      parentPort.close();
+    }
+  });
+  parentPort.postMessage({ duckdbScalarFunctionWorkerPool: 'attached' });
+`;
+
 describe('scalar functions', () => {
   beforeAll(setDefaultTimezone);
 
@@ -64,6 +102,110 @@ describe('scalar functions', () => {
     });
   });
 
+  test('scalar function (deduplicate inputs)', async () => {
+    await withConnection(async (connection) => {
+      const rowCounts: number[] = [];
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_func',
+          mainFunction: (_info, input, output) => {
+            rowCounts.push(input.rowCount);
+            const v0 = input.getColumnVector(0);
+            for (let rowIndex = 0; rowIndex < input.rowCount; rowIndex++) {
+              output.setItem(rowIndex, `${v0.getItem(rowIndex)}!`);
+            }
+            output.flush();
+          },
+          returnType: VARCHAR,
+          parameterTypes: [VARCHAR],
+          deduplicateInputs: true,
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        `select my_func(s) as r, count(*)::integer as n from (
+          select ['a', 'b', 'c'][(i % 3)::integer + 1] as s from range(3000) t(i)
+        ) group by r order by r`,
+      );
+      const columns = reader.getColumnsObject();
+      assert.deepEqual(columns, {
+        r: ['a!', 'b!', 'c!'],
+        n: [1000, 1000, 1000],
+      });
+      assert.isAbove(rowCounts.length, 0);
+      for (const rowCount of rowCounts) {
+        assert.isAtMost(rowCount, 3);
+      }
+    });
+  });
+
+  test('scalar function (folded argument)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_func',
+          bindFunction: (info) => {
+            assert.equal(info.argumentCount, 2);
+            assert.isFalse(info.getArgument(0).isFoldable);
+            const pattern = info.getArgument(1);
+            assert.isTrue(pattern.isFoldable);
+            assert.deepEqual(pattern.returnType, VARCHAR);
+            info.setBindData({ regex: new RegExp(pattern.fold() as string) });
+          },
+          mainFunction: (info, input, output) => {
+            const { regex } = info.bindData as { regex: RegExp };
+            const v0 = input.getColumnVector(0);
+            for (let rowIndex = 0; rowIndex < input.rowCount; rowIndex++) {
+              output.setItem(
+                rowIndex,
+                regex.test(v0.getItem(rowIndex) as string),
+              );
+            }
+            output.flush();
+          },
+          returnType: BOOLEAN,
+          parameterTypes: [VARCHAR, VARCHAR],
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        "select my_func(s, '^a') as r from (values ('abc'), ('bcd')) t(s)",
+      );
+      const columns = reader.getColumnsObject();
+      assert.deepEqual(columns, { r: [true, false] });
+    });
+  });
+
+  test('scalar function (init state)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_func',
+          bindFunction: (info) => {
+            info.setBindData({ separator: '-' });
+          },
+          initFunction: (info) => {
+            const { separator } = info.bindData as { separator: string };
+            info.setState({ separator, calls: 0 });
+          },
+          mainFunction: (info, input, output) => {
+            const state = info.state as { separator: string; calls: number };
+            state.calls++;
+            for (let rowIndex = 0; rowIndex < input.rowCount; rowIndex++) {
+              output.setItem(
+                rowIndex,
+                `my_output${state.separator}${state.calls}`,
+              );
+            }
+            output.flush();
+          },
+          returnType: VARCHAR,
+        }),
+      );
+      const reader = await connection.runAndReadAll('select my_func()');
+      const columns = reader.getColumnsObject();
+      assert.deepEqual(columns, { 'my_func()': ['my_output-1'] });
+    });
+  });
+
   test('scalar function (extra info)', async () => {
     await withConnection(async (connection) => {
       connection.registerScalarFunction(
@@ -325,4 +467,244 @@ describe('scalar functions', () => {
       });
     });
   });
+
+  test('scalar function (columnar, numeric)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_add',
+          columnarMainFunction: (_info, [a, b], rowCount) => {
+            const av = a.values as Float64Array;
+            const bv = b.values as Int32Array;
+            const result = new Float64Array(rowCount);
+            for (let i = 0; i < rowCount; i++) {
+              result[i] = av[i] + bv[i];
+            }
+            const nullMask = new Uint8Array(rowCount);
+            for (let i = 0; i < rowCount; i++) {
+              nullMask[i] = (a.nullMask?.[i] ?? 0) | (b.nullMask?.[i] ?? 0);
+            }
+            return { values: result, nullMask };
+          },
+          returnType: DOUBLE,
+          parameterTypes: [DOUBLE, INTEGER],
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        `select my_add(x / 2, x::int) as r from (values (1), (2), (null), (4)) t(x)`,
+      );
+      assert.deepEqual(reader.getColumnsObject(), {
+        r: [1.5, 3, null, 6],
+      });
+    });
+  });
+
+  test('scalar function (columnar, varchar)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_upper',
+          columnarMainFunction: (_info, [s]) =>
+            (s.values as readonly (string | null)[]).map((v) =>
+              v === 'skip' ? null : v?.toUpperCase() ?? null,
+            ),
+          returnType: VARCHAR,
+          parameterTypes: [VARCHAR],
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        `select my_upper(s) as r from (values ('duck'), ('skip'), (null), ('longer than twelve characters')) t(s)`,
+      );
+      assert.deepEqual(reader.getColumnsObject(), {
+        r: ['DUCK', null, null, 'LONGER THAN TWELVE CHARACTERS'],
+      });
+    });
+  });
+
+  test('scalar function (columnar, wrong result type)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_func',
+          columnarMainFunction: (_info, _columns, rowCount) =>
+            new Int32Array(rowCount),
+          returnType: DOUBLE,
+        }),
+      );
+      try {
+        await connection.run('select my_func()');
+        assert.fail('should throw');
+      } catch (err) {
+        assert.match(
+          (err as Error).message,
+          /Expected Float64Array for type DOUBLE, but got Int32Array/,
+        );
+      }
+    });
+  });
+
+  test('scalar function (async)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_lookup',
+          mainFunction: async (_info, input, output) => {
+            const keys = input.getColumnVector(0);
+            await sleep(5);
+            for (let rowIndex = 0; rowIndex < input.rowCount; rowIndex++) {
+              output.setItem(rowIndex, `value_${keys.getItem(rowIndex)}`);
+            }
+            output.flush();
+          },
+          returnType: VARCHAR,
+          parameterTypes: [INTEGER],
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select count(*)::integer as n, max(my_lookup(i::integer)) as m from range(10000) t(i)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), {
+        n: [10000],
+        m: ['value_9999'],
+      });
+    });
+  });
+
+  test('scalar function (async, columnar)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_scale',
+          columnarMainFunction: async (_info, [x], rowCount) => {
+            await sleep(1);
+            const xv = x.values as Float64Array;
+            const result = new Float64Array(rowCount);
+            for (let i = 0; i < rowCount; i++) {
+              result[i] = xv[i] * 10;
+            }
+            return result;
+          },
+          returnType: DOUBLE,
+          parameterTypes: [DOUBLE],
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select my_scale(x) as r from (values (1.5), (2.0)) t(x)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { r: [15, 20] });
+    });
+  });
+
+  test('scalar function (error handling: rejection in async main func)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerScalarFunction(
+        DuckDBScalarFunction.create({
+          name: 'my_func',
+          mainFunction: async () => {
+            await sleep(1);
+            throw new Error('my_async_error');
+          },
+          returnType: VARCHAR,
+        }),
+      );
+      try {
+        await connection.run('select my_func()');
+        assert.fail('should throw');
+      } catch (err) {
+        assert.match((err as Error).message, /my_async_error/);
+      }
+    });
+  });
+
+  test('scalar function (worker pool)', async () => {
+    const workerPool = await DuckDBScalarFunctionWorkerPool.create(
+      doubleItWorkerSource,
+      {
+        workerCount: 2,
+        workerOptions: { eval: true, workerData: { bindingsPath } },
+      },
+    );
+    try {
+      assert.equal(workerPool.workerCount, 2);
+      await withConnection(async (connection) => {
+        connection.registerScalarFunction(
+          DuckDBScalarFunction.create({
+            name: 'double_it',
+            workerPool,
+            returnType: INTEGER,
+            parameterTypes: [INTEGER],
+          }),
+        );
+        const reader = await connection.runAndReadAll(
+          'select sum(double_it(i::integer))::bigint as total from range(10000) t(i)',
+        );
+        assert.deepEqual(reader.getColumnsObject(), { total: [99990000n] });
+
+        await workerPool.close();
+        try {
+          await connection.run('select double_it(1)');
+          assert.fail('should throw');
+        } catch (err) {
+          assert.match(
+            (err as Error).message,
+            /No workers attached to scalar function worker pool/,
+          );
+        }
+      });
+    } finally {
+      await workerPool.close();
+    }
+  });
+
+  test('scalar function set', async () => {
+    await withConnection(async (connection) => {
+      const twice = (type: typeof INTEGER | typeof DOUBLE, label: string) =>
+        DuckDBScalarFunction.create({
+          name: 'my_twice',
+          mainFunction: (_info, input, output) => {
+            input.visitColumnValues(0, (value, rowIndex) => {
+              output.setItem(rowIndex, (value as number) * 2);
+            });
+            output.flush();
+          },
+          returnType: type,
+          parameterTypes: [type],
+          extraInfo: { label },
+        });
+      connection.registerScalarFunctionSet(
+        DuckDBScalarFunctionSet.create('my_twice', [
+          twice(INTEGER, 'integer'),
+          twice(DOUBLE, 'double'),
+        ]),
+      );
+      const reader = await connection.runAndReadAll(
+        'select my_twice(21) as i, my_twice(1.25::double) as d',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { i: [42], d: [2.5] });
+    });
+  });
+
+  test('scalar function (native main function)', async () => {
+    await withConnection(async (connection) => {
+      const library = DuckDBNativeLibrary.load(nativeFunctionsFixturePath);
+      const scalarFunction = new DuckDBScalarFunction();
+      scalarFunction.setName('my_native_add');
+      scalarFunction.setNativeMainFunction(library, 'my_native_add');
+      scalarFunction.setReturnType(INTEGER);
+      scalarFunction.addParameter(INTEGER);
+      scalarFunction.addParameter(INTEGER);
+      connection.registerScalarFunction(scalarFunction);
+      const reader = await connection.runAndReadAll(
+        'select my_native_add(a, b) as s from (values (1, 2), (40, null), (20, 22)) t(a, b)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { s: [3, null, 42] });
+    });
+  });
+
+  test('scalar function (native library not found)', () => {
+    assert.throws(
+      () => DuckDBNativeLibrary.load('/nonexistent/libmy_udfs.so'),
+      /Failed to load native library/,
+    );
+  });
 });
@@ -1,14 +1,61 @@
+import { createRequire } from 'node:module';
 import { assert, beforeAll, describe, expect, test } from 'vitest';
 import {
+  BIGINT,
   DuckDBConnection,
+  DuckDBDataChunk,
   DuckDBTableFunction,
   DuckDBTableFunctionBindInfo,
   DuckDBTableFunctionInfo,
   DuckDBTableFunctionInitInfo,
+  DuckDBTableFunctionWorkerPool,
   INTEGER,
   VARCHAR,
 } from '../src';
-import { setDefaultTimezone, withConnection } from './util/testHelpers';
+import { DuckDBNativeLibrary } from '../src/DuckDBNativeLibrary';
+import { sleep } from '../src/sleep';
+import {
+  nativeFunctionsFixturePath,
+  setDefaultTimezone,
+  withConnection,
+} from './util/testHelpers';
+
+const bindingsPath = createRequire(import.meta.url).resolve(
+  '@duckdb/node-bindings',
+);
+
+// Workers cannot load the TypeScript sources, so instead of calling serve, this
+// does what serve does using the bindings directly. Each scan thread claims
+// partitions of the integers below 10 * partitions, one chunk per partition.
+const partitionsWorkerSource = `
+  const { parentPort, workerData } = require('node:worker_threads');
+  const duckdb = require(workerData.bindingsPath);
+  const poolId = workerData.duckdbTableFunctionWorkerPoolId;
+  duckdb.table_function_worker_pool_attach(poolId, (scan, output) => {
+    const { partitions } = JSON.parse(duckdb.table_function_worker_scan_get_data(scan));
+    const partition = duckdb.table_function_worker_scan_next_partition(scan);
+    if (partition >= partitions) {
+      duckdb.data_chunk_set_size(output, 0);
+      return;
+    }
+    const state = duckdb.table_function_worker_scan_get_state(scan) ?? { partitions: 0 };
+    state.partitions++;
+    duckdb.table_function_worker_scan_set_state(scan, state);
+    const values = Int32Array.from({ length: 10 }, (_, i) => partition * 10 + i);
+    duckdb.copy_data_to_vector(
+      duckdb.data_chunk_get_vector(output, 0), 0, values.buffer, 0, values.byteLength,
+    );
+    duckdb.data_chunk_set_size(output, 10);
+  });
+  parentPort.on('message', (message) => {
+    if (message.duckdbTableFunctionWorkerPool === 'detach') {
+      duckdb.table_function_worker_pool_detach(poolId);
+      parentPort.postMessage({ duckdbTableFunctionWorkerPool: 'detached' });
+      parentPort.close();
+    }
+  });
+  parentPort.postMessage({ duckdbTableFunctionWorkerPool: 'attached' });
+`;
 
 // A counter-driven scan, which most tests below vary one part of.
 function counterFunction({
@@ -126,6 +173,158 @@ describe('table functions', () => {
     });
   });
 
+  test('table function (comparison parameters)', async () => {
+    await withConnection(async (connection) => {
+      const seenComparisons: unknown[] = [];
+      connection.registerTableFunction(
+        DuckDBTableFunction.create({
+          name: 'my_range_scan',
+          comparisonParameterTypes: { n: INTEGER },
+          bindFunction: (info) => {
+            seenComparisons.push(info.comparisonParameters);
+            let from = 0;
+            let to = 100;
+            for (const { comparison, value } of info.comparisonParameters) {
+              const n = value as number;
+              if (comparison === '>=') from = Math.max(from, n);
+              if (comparison === '>') from = Math.max(from, n + 1);
+              if (comparison === '<') to = Math.min(to, n);
+              if (comparison === '<=') to = Math.min(to, n + 1);
+            }
+            info.addResultColumn('n', INTEGER);
+            info.setBindData({ from, to });
+          },
+          initFunction: (info) => {
+            info.setInitData({ done: false });
+          },
+          mainFunction: (info, output) => {
+            const { from, to } = info.bindData as { from: number; to: number };
+            const initData = info.initData as { done: boolean };
+            if (initData.done) {
+              output.rowCount = 0;
+              return;
+            }
+            output.setColumns([
+              Array.from({ length: Math.max(to - from, 0) }, (_, i) => from + i),
+            ]);
+            initData.done = true;
+          },
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select count(*)::integer as count, min(n) as lo, max(n) as hi from my_range_scan(n_gte => 10, n_lt => 20)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), {
+        count: [10],
+        lo: [10],
+        hi: [19],
+      });
+      assert.deepEqual(seenComparisons[0], [
+        { columnName: 'n', comparison: '<', value: 20 },
+        { columnName: 'n', comparison: '>=', value: 10 },
+      ]);
+    });
+  });
+
+  test('table function (NULL comparison parameter)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerTableFunction(
+        DuckDBTableFunction.create({
+          name: 'my_range_scan',
+          comparisonParameterTypes: { n: INTEGER },
+          bindFunction: (info) => {
+            info.addResultColumn('n', INTEGER);
+            info.setBindData({ comparisons: info.comparisonParameters });
+          },
+          initFunction: () => {},
+          mainFunction: (_info, output) => {
+            output.rowCount = 0;
+          },
+        }),
+      );
+      await expect(
+        connection.runAndReadAll('from my_range_scan(n_eq => NULL)'),
+      ).rejects.toThrow('Comparison parameter n_eq must not be NULL');
+    });
+  });
+
+  test('table function (columnar main function)', async () => {
+    await withConnection(async (connection) => {
+      const total = 3000;
+      connection.registerTableFunction(
+        DuckDBTableFunction.create({
+          name: 'my_columnar',
+          bindFunction: (info) => {
+            info.addResultColumn('n', INTEGER);
+            info.addResultColumn('s', VARCHAR);
+          },
+          initFunction: (info) => {
+            info.setInitData({ nextRow: 0 });
+          },
+          columnarMainFunction: (info, [n, s], capacity) => {
+            const initData = info.initData as { nextRow: number };
+            const rowCount = Math.min(total - initData.nextRow, capacity);
+            const values = n.values as Int32Array;
+            const strings = s.values as (string | null)[];
+            for (let row = 0; row < rowCount; row++) {
+              const i = initData.nextRow + row;
+              values[row] = i;
+              strings[row] = `s${i}`;
+              if (i % 10 === 0) {
+                n.nullMask[row] = 1;
+              }
+            }
+            initData.nextRow += rowCount;
+            return rowCount;
+          },
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        `select count(*)::integer as rows, count(n)::integer as non_null,
+          sum(n)::integer as total, max(s) as max_s from my_columnar()`,
+      );
+      assert.deepEqual(reader.getColumnsObject(), {
+        rows: [3000],
+        non_null: [2700],
+        total: [(2999 * 3000) / 2 - (2990 * 300) / 2],
+        max_s: ['s999'],
+      });
+    });
+  });
+
+  test('table function (typed arrays)', async () => {
+    await withConnection(async (connection) => {
+      const total = 3000;
+      const id = Int32Array.from({ length: total }, (_, i) => i);
+      const score = Float64Array.from(id, (i) => i / 4);
+      const scoreNullMask = Uint8Array.from(id, (i) => (i % 10 === 0 ? 1 : 0));
+      const name = Array.from(id, (i) => (i % 2 === 0 ? `n${i}` : null));
+      connection.registerTableFunction(
+        DuckDBTableFunction.createForTypedArrays('my_arrays', {
+          id,
+          score: { values: score, nullMask: scoreNullMask },
+          name,
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        `select count(*)::integer as rows, count(score)::integer as scores,
+          sum(id)::integer as total, count(name)::integer as names,
+          max(name) as max_name from my_arrays()`,
+      );
+      assert.deepEqual(reader.getColumnsObject(), {
+        rows: [3000],
+        scores: [2700],
+        total: [(2999 * 3000) / 2],
+        names: [1500],
+        max_name: ['n998'],
+      });
+      const projected = await connection.runAndReadAll(
+        'select score from my_arrays() where id = 42',
+      );
+      assert.deepEqual(projected.getColumnsObject(), { score: [10.5] });
+    });
+  });
+
   test('table function (extra info, bind data and init data)', async () => {
     await withConnection(async (connection) => {
       const seen: string[] = [];
@@ -253,6 +452,138 @@ describe('table functions', () => {
     });
   });
 
+  test('table function (batches)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerTableFunction(
+        DuckDBTableFunction.create({
+          name: 'my_batches',
+          bindFunction: (info) => {
+            info.addResultColumn('n', INTEGER);
+            info.setBindData({ batchCount: 3 });
+          },
+          batchesFunction: async function* ({ bindData }) {
+            const { batchCount } = bindData as { batchCount: number };
+            for (let batch = 0; batch < batchCount; batch++) {
+              await sleep(1);
+              const chunk = DuckDBDataChunk.create([INTEGER]);
+              chunk.setColumns([[batch * 2, batch * 2 + 1]]);
+              yield chunk;
+            }
+          },
+          prefetchChunks: 2,
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select n from my_batches() order by n',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { n: [0, 1, 2, 3, 4, 5] });
+    });
+  });
+
+  test('table function (batches: error)', async () => {
+    await withConnection(async (connection) => {
+      connection.registerTableFunction(
+        DuckDBTableFunction.create({
+          name: 'my_batches',
+          bindFunction: (info) => {
+            info.addResultColumn('n', INTEGER);
+          },
+          batchesFunction: async function* () {
+            const chunk = DuckDBDataChunk.create([INTEGER]);
+            chunk.setColumns([[1]]);
+            yield chunk;
+            throw new Error('my_batches_error');
+          },
+        }),
+      );
+      await expect(
+        connection.runAndReadAll('select * from my_batches()'),
+      ).rejects.toThrow('my_batches_error');
+    });
+  });
+
+  test('table function (batches: scan ends early)', async () => {
+    await withConnection(async (connection) => {
+      let resolveFinished: () => void;
+      const finished = new Promise<void>((resolve) => {
+        resolveFinished = resolve;
+      });
+      connection.registerTableFunction(
+        DuckDBTableFunction.create({
+          name: 'my_batches',
+          bindFunction: (info) => {
+            info.addResultColumn('n', INTEGER);
+          },
+          batchesFunction: async function* () {
+            try {
+              for (let n = 0; ; n++) {
+                const chunk = DuckDBDataChunk.create([INTEGER]);
+                chunk.setColumns([[n]]);
+                yield chunk;
+              }
+            } finally {
+              // Runs when the scan stops iteration.
+              resolveFinished();
+            }
+          },
+        }),
+      );
+      const reader = await connection.runAndReadAll(
+        'select * from my_batches() limit 1',
+      );
+      assert.equal(reader.currentRowCount, 1);
+      await finished;
+    });
+  });
+
+  test('table function (worker pool)', async () => {
+    const workerPool = await DuckDBTableFunctionWorkerPool.create(
+      partitionsWorkerSource,
+      {
+        workerCount: 2,
+        workerOptions: { eval: true, workerData: { bindingsPath } },
+      },
+    );
+    try {
+      assert.equal(workerPool.workerCount, 2);
+      await withConnection(async (connection) => {
+        connection.registerTableFunction(
+          DuckDBTableFunction.create({
+            name: 'my_partitions',
+            bindFunction: (info) => {
+              info.addResultColumn('i', INTEGER);
+            },
+            initFunction: (info) => {
+              info.setMaxThreads(2);
+              info.setWorkerScanData({ partitions: 8 });
+            },
+            workerPool,
+          }),
+        );
+        const reader = await connection.runAndReadAll(
+          'select count(*)::integer as n, sum(i)::integer as total from my_partitions()',
+        );
+        assert.deepEqual(reader.getColumnsObject(), {
+          n: [80],
+          total: [3160],
+        });
+
+        await workerPool.close();
+        try {
+          await connection.run('select * from my_partitions()');
+          assert.fail('should throw');
+        } catch (err) {
+          assert.match(
+            (err as Error).message,
+            /No workers attached to table function worker pool/,
+          );
+        }
+      });
+    } finally {
+      await workerPool.close();
+    }
+  });
+
   test('DuckDBConnection.create registers on its own connection', async () => {
     const connection = await DuckDBConnection.create();
     try {
@@ -263,4 +594,21 @@ describe('table functions', () => {
       connection.closeSync();
     }
   });
+
+  test('table function (native callbacks)', async () => {
+    await withConnection(async (connection) => {
+      const library = DuckDBNativeLibrary.load(nativeFunctionsFixturePath);
+      const tableFunction = new DuckDBTableFunction();
+      tableFunction.setName('my_native_range');
+      tableFunction.addParameter(BIGINT);
+      tableFunction.setNativeBindFunction(library, 'my_native_range_bind');
+      tableFunction.setNativeInitFunction(library, 'my_native_range_init');
+      tableFunction.setNativeMainFunction(library, 'my_native_range');
+      connection.registerTableFunction(tableFunction);
+      const reader = await connection.runAndReadAll(
+        'select * from my_native_range(3)',
+      );
+      assert.deepEqual(reader.getColumnsObject(), { i: [0n, 1n, 2n] });
+    });
+  });
 });
@@ -1,3 +1,5 @@
+import { createRequire } from 'node:module';
+import path from 'node:path';
 import { assert } from 'vitest';
 import {
   DuckDBConnection,
@@ -10,6 +12,16 @@ import {
 } from '../../src';
 import { ColumnNameAndType } from './testAllTypes';
 
+/**
+ * The shared library of native function callbacks built with the bindings,
+ * from bindings/test/fixtures/native_functions.c.
+ */
+export const nativeFunctionsFixturePath = path.resolve(
+  path.dirname(createRequire(import.meta.url).resolve('@duckdb/node-bindings')),
+  '../../../build/Release',
+  `native_functions_fixture.${process.platform === 'win32' ? 'dll' : 'so'}`,
+);
+
 /**
  * Pin the TIMESTAMPTZ display offset to a constant so tests don't depend on the
  * local timezone. Call from a `beforeAll` in each test file.
@@ -244,5 +244,68 @@
         }],
       ],
     },
+    # A shared library of native function callbacks, loaded by the native
+    # library tests. It is not copied into any package. It links against the
+    # libduckdb copied next to duckdb.node, so both use the same copy.
+    {
+      'target_name': 'native_functions_fixture',
+      'type': 'loadable_module',
+      'dependencies': ['copy_duckdb_node'],
+      'sources': ['test/fixtures/native_functions.c'],
+      'include_dirs': ['<(module_root_dir)/libduckdb'],
+      'variables': {
+        'win_delay_load_hook': 'false',
+      },
+      'conditions': [
+        ['OS=="linux" and target_arch=="x64"', {
+          'product_extension': 'so',
+          'link_settings': {
+            'libraries': [
+              '-lduckdb',
+              '-L<(module_root_dir)/libduckdb',
+              '-Wl,-rpath,<(module_root_dir)/pkgs/@duckdb/node-bindings-linux-x64<(libc_pkg_suffix)',
+            ],
+          },
+        }],
+        ['OS=="linux" and target_arch=="arm64"', {
+          'product_extension': 'so',
+          'link_settings': {
+            'libraries': [
+              '-lduckdb',
+              '-L<(module_root_dir)/libduckdb',
+              '-Wl,-rpath,<(module_root_dir)/pkgs/@duckdb/node-bindings-linux-arm64<(libc_pkg_suffix)',
+            ],
+          },
+        }],
+        ['OS=="mac" and target_arch=="arm64"', {
+          'product_extension': 'so',
+          'link_settings': {
+            'libraries': [
+              '-lduckdb',
+              '-L<(module_root_dir)/libduckdb',
+              '-Wl,-rpath,<(module_root_dir)/pkgs/@duckdb/node-bindings-darwin-arm64',
+            ],
+          },
+        }],
+        ['OS=="mac" and target_arch=="x64"', {
+          'product_extension': 'so',
+          'link_settings': {
+            'libraries': [
+              '-lduckdb',
+              '-L<(module_root_dir)/libduckdb',
+              '-Wl,-rpath,<(module_root_dir)/pkgs/@duckdb/node-bindings-darwin-x64',
+            ],
+          },
+        }],
+        ['OS=="win"', {
+          'product_extension': 'dll',
+          'link_settings': {
+            'libraries': [
+              '<(module_root_dir)/libduckdb/duckdb.lib',
+            ],
+          },
+        }],
+      ],
+    },
   ],
 }
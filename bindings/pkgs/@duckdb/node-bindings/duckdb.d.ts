@@ -2,6 +2,67 @@
 
 export const sizeof_bool: number;
 
+export enum CastMode {
+  NORMAL = 0,
+  TRY = 1,
+}
+
+export enum ErrorType {
+  INVALID = 0,
+  OUT_OF_RANGE = 1,
+  CONVERSION = 2,
+  UNKNOWN_TYPE = 3,
+  DECIMAL = 4,
+  MISMATCH_TYPE = 5,
+  DIVIDE_BY_ZERO = 6,
+  OBJECT_SIZE = 7,
+  INVALID_TYPE = 8,
+  SERIALIZATION = 9,
+  TRANSACTION = 10,
+  NOT_IMPLEMENTED = 11,
+  EXPRESSION = 12,
+  CATALOG = 13,
+  PARSER = 14,
+  PLANNER = 15,
+  SCHEDULER = 16,
+  EXECUTOR = 17,
+  CONSTRAINT = 18,
+  INDEX = 19,
+  STAT = 20,
+  CONNECTION = 21,
+  SYNTAX = 22,
+  SETTINGS = 23,
+  BINDER = 24,
+  NETWORK = 25,
+  OPTIMIZER = 26,
+  NULL_POINTER = 27,
+  IO = 28,
+  INTERRUPT = 29,
+  FATAL = 30,
+  INTERNAL = 31,
+  INVALID_INPUT = 32,
+  OUT_OF_MEMORY = 33,
+  PERMISSION = 34,
+  PARAMETER_NOT_RESOLVED = 35,
+  PARAMETER_NOT_ALLOWED = 36,
+  DEPENDENCY = 37,
+  HTTP = 38,
+  MISSING_EXTENSION = 39,
+  AUTOLOAD = 40,
+  SEQUENCE = 41,
+  INVALID_CONFIGURATION = 42,
+}
+
+export enum FileFlag {
+  INVALID = 0,
+  READ = 1,
+  WRITE = 2,
+  DIRECT_IO = 3,
+  CREATE = 4,
+  CREATE_NEW = 5,
+  APPEND = 6,
+}
+
 export enum PendingState {
   RESULT_READY = 0,
   RESULT_NOT_READY = 1,
@@ -191,11 +252,46 @@ export interface TimestampParts {
 // __duckdb_type records the underlying C type; __duckdb_function_kind is what
 // keeps the families from being assignable to one another.
 
+export interface AggregateFunctionInfo {
+  __duckdb_type: 'duckdb_function_info';
+  __duckdb_function_kind: 'aggregate_function';
+}
+
+export interface CastFunctionInfo {
+  __duckdb_type: 'duckdb_function_info';
+  __duckdb_function_kind: 'cast_function';
+}
+
+export interface CopyFunctionBindInfo {
+  __duckdb_type: 'duckdb_copy_function_bind_info';
+  __duckdb_function_kind: 'copy_function';
+}
+
+export interface CopyFunctionGlobalInitInfo {
+  __duckdb_type: 'duckdb_copy_function_global_init_info';
+  __duckdb_function_kind: 'copy_function';
+}
+
+export interface CopyFunctionSinkInfo {
+  __duckdb_type: 'duckdb_copy_function_sink_info';
+  __duckdb_function_kind: 'copy_function';
+}
+
+export interface CopyFunctionFinalizeInfo {
+  __duckdb_type: 'duckdb_copy_function_finalize_info';
+  __duckdb_function_kind: 'copy_function';
+}
+
 export interface ScalarFunctionBindInfo {
   __duckdb_type: 'duckdb_bind_info';
   __duckdb_function_kind: 'scalar_function';
 }
 
+export interface ScalarFunctionInitInfo {
+  __duckdb_type: 'duckdb_init_info';
+  __duckdb_function_kind: 'scalar_function';
+}
+
 export interface ScalarFunctionInfo {
   __duckdb_type: 'duckdb_function_info';
   __duckdb_function_kind: 'scalar_function';
@@ -222,16 +318,32 @@ export type BindInfo = ScalarFunctionBindInfo;
 /** @deprecated Renamed to ScalarFunctionInfo. */
 export type FunctionInfo = ScalarFunctionInfo;
 
+export interface ReplacementScanInfo {
+  __duckdb_type: 'duckdb_replacement_scan_info';
+}
+
 export interface Vector {
   __duckdb_type: 'duckdb_vector';
 }
 
 // Types (explicit destroy)
 
+export interface AggregateFunction {
+  __duckdb_type: 'duckdb_aggregate_function';
+}
+
+export interface AggregateFunctionSet {
+  __duckdb_type: 'duckdb_aggregate_function_set';
+}
+
 export interface Appender {
   __duckdb_type: 'duckdb_appender';
 }
 
+export interface CastFunction {
+  __duckdb_type: 'duckdb_cast_function';
+}
+
 export interface ClientContext {
   __duckdb_type: 'duckdb_client_context';
 }
@@ -244,6 +356,10 @@ export interface Connection {
   __duckdb_type: 'duckdb_connection';
 }
 
+export interface CopyFunction {
+  __duckdb_type: 'duckdb_copy_function';
+}
+
 // export interface CreateTypeInfo {
 //   __duckdb_type: 'duckdb_create_type_info';
 // }
@@ -256,10 +372,30 @@ export interface DataChunk {
   __duckdb_type: 'duckdb_data_chunk';
 }
 
+export interface ErrorData {
+  __duckdb_type: 'duckdb_error_data';
+}
+
+export interface Expression {
+  __duckdb_type: 'duckdb_expression';
+}
+
 export interface ExtractedStatements {
   __duckdb_type: 'duckdb_extracted_statements';
 }
 
+export interface FileHandle {
+  __duckdb_type: 'duckdb_file_handle';
+}
+
+export interface FileOpenOptions {
+  __duckdb_type: 'duckdb_file_open_options';
+}
+
+export interface FileSystem {
+  __duckdb_type: 'duckdb_file_system';
+}
+
 export interface InstanceCache {
   __duckdb_type: 'duckdb_instance_cache';
 }
@@ -268,6 +404,11 @@ export interface LogicalType {
   __duckdb_type: 'duckdb_logical_type';
 }
 
+/** Not a DuckDB type; see `load_native_library`. */
+export interface NativeLibrary {
+  __duckdb_type: 'duckdb_node_native_library';
+}
+
 export interface PendingResult {
   __duckdb_type: 'duckdb_pending_result';
 }
@@ -284,10 +425,34 @@ export interface ScalarFunction {
   __duckdb_type: 'duckdb_scalar_function';
 }
 
+export interface ScalarFunctionSet {
+  __duckdb_type: 'duckdb_scalar_function_set';
+}
+
+/** Not a DuckDB type; see `create_scalar_function_worker_pool`. */
+export interface ScalarFunctionWorkerPool {
+  __duckdb_type: 'duckdb_node_scalar_function_worker_pool';
+}
+
 export interface TableFunction {
   __duckdb_type: 'duckdb_table_function';
 }
 
+/** Not a DuckDB type; see `create_table_function_chunk_queue`. */
+export interface TableFunctionChunkQueue {
+  __duckdb_type: 'duckdb_node_table_function_chunk_queue';
+}
+
+/** Not a DuckDB type; see `create_table_function_worker_pool`. */
+export interface TableFunctionWorkerPool {
+  __duckdb_type: 'duckdb_node_table_function_worker_pool';
+}
+
+/** Not a DuckDB type; see `table_function_set_worker_pool`. */
+export interface TableFunctionWorkerScan {
+  __duckdb_type: 'duckdb_node_table_function_worker_scan';
+}
+
 // export interface SelectionVector {
 //   __duckdb_type: 'duckdb_selection_vector';
 // }
@@ -308,12 +473,73 @@ export interface ExtractedStatementsAndCount {
   statement_count: number;
 }
 
-export type ScalarFunctionBindFunction = (info: ScalarFunctionBindInfo) => void;
-export type ScalarFunctionMainFunction = (info: ScalarFunctionInfo, input: DataChunk, output: Vector) => void;
+/**
+ * A column of `table_function_set_typed_array_columns`. Numeric columns take their type from `data`: TINYINT for
+ * Int8Array, UTINYINT for Uint8Array, through DOUBLE for Float64Array and UBIGINT for BigUint64Array. A VARCHAR column
+ * is UTF-8 bytes in `data`, a Uint8Array, with `offsets` as for `vector_assign_strings`. If given, `null_mask` has a
+ * byte per row, nonzero for NULL.
+ */
+export interface TypedArrayTableColumn {
+  name: string;
+  data:
+    | Int8Array
+    | Uint8Array
+    | Uint8ClampedArray
+    | Int16Array
+    | Uint16Array
+    | Int32Array
+    | Uint32Array
+    | BigInt64Array
+    | BigUint64Array
+    | Float32Array
+    | Float64Array;
+  offsets?: Uint32Array;
+  null_mask?: Uint8Array;
+}
+
+// Function callbacks may return a promise; the calling DuckDB thread waits until it settles, and a rejection fails the
+// call.
+/** `state_ids` holds the id of the state for each input row. */
+export type AggregateFunctionUpdateFunction = (info: AggregateFunctionInfo, input: DataChunk, state_ids: Float64Array) => void | Promise<void>;
+/** Combines the state with each source id into the state with the target id at the same index. */
+export type AggregateFunctionCombineFunction = (info: AggregateFunctionInfo, source_state_ids: Float64Array, target_state_ids: Float64Array) => void | Promise<void>;
+/** Writes the result for each state id to the output vector, starting at `offset`. */
+export type AggregateFunctionFinalizeFunction = (info: AggregateFunctionInfo, state_ids: Float64Array, output: Vector, offset: number) => void | Promise<void>;
+/** Not awaited, and cannot fail a query; it runs after the query may already have finished. */
+export type AggregateFunctionDestroyFunction = (state_ids: Float64Array) => void;
+
+/**
+ * Casts the first `count` rows of `input` into `output`. Returning false (or a promise of false) fails the cast; in
+ * TRY mode, use `cast_function_set_row_error` to make individual rows NULL instead.
+ */
+export type CastFunctionMainFunction = (info: CastFunctionInfo, count: number, input: Vector, output: Vector) => boolean | void | Promise<boolean | void>;
+
+export type CopyFunctionBindFunction = (info: CopyFunctionBindInfo) => void | Promise<void>;
+export type CopyFunctionGlobalInitFunction = (info: CopyFunctionGlobalInitInfo) => void | Promise<void>;
+/** `input` is only valid until the function returns or its promise settles. */
+export type CopyFunctionSinkFunction = (info: CopyFunctionSinkInfo, input: DataChunk) => void | Promise<void>;
+export type CopyFunctionFinalizeFunction = (info: CopyFunctionFinalizeInfo) => void | Promise<void>;
+/**
+ * Writes `chunks`, copies of every chunk sunk since the previous call, in order. Calls never overlap: the next starts
+ * once this one returns or its promise settles. `global_state` is the state set by the global init function, if any.
+ */
+export type CopyFunctionAsyncSinkFunction = (chunks: DataChunk[], global_state: object | undefined) => void | Promise<void>;
+
+export type ScalarFunctionBindFunction = (info: ScalarFunctionBindInfo) => void | Promise<void>;
+export type ScalarFunctionInitFunction = (info: ScalarFunctionInitInfo) => void | Promise<void>;
+export type ScalarFunctionMainFunction = (info: ScalarFunctionInfo, input: DataChunk, output: Vector) => void | Promise<void>;
+export type ScalarFunctionWorkerMainFunction = (input: DataChunk, output: Vector) => void | Promise<void>;
 
-export type TableFunctionBindFunction = (info: TableFunctionBindInfo) => void;
-export type TableFunctionInitFunction = (info: TableFunctionInitInfo) => void;
-export type TableFunctionMainFunction = (info: TableFunctionInfo, output: DataChunk) => void;
+export type TableFunctionBindFunction = (info: TableFunctionBindInfo) => void | Promise<void>;
+export type TableFunctionInitFunction = (info: TableFunctionInitInfo) => void | Promise<void>;
+export type TableFunctionMainFunction = (info: TableFunctionInfo, output: DataChunk) => void | Promise<void>;
+
+/**
+ * Called while a query is bound, with the name of a table the catalog does not have. To replace the table, set a
+ * table function name; to leave it unresolved, do nothing.
+ */
+export type ReplacementScanFunction = (info: ReplacementScanInfo, table_name: string) => void | Promise<void>;
+export type TableFunctionWorkerMainFunction = (scan: TableFunctionWorkerScan, output: DataChunk) => void | Promise<void>;
 
 // Functions
 
@@ -382,10 +608,19 @@ export function set_config(config: Config, name: string, option: string): void;
 // not exposed: destroyed in finalizer
 
 // DUCKDB_C_API duckdb_error_data duckdb_create_error_data(duckdb_error_type type, const char *message);
+export function create_error_data(error_type: ErrorType, message: string): ErrorData;
+
 // DUCKDB_C_API void duckdb_destroy_error_data(duckdb_error_data *error_data);
+// not exposed: destroyed in finalizer
+
 // DUCKDB_C_API duckdb_error_type duckdb_error_data_error_type(duckdb_error_data error_data);
+export function error_data_error_type(error_data: ErrorData): ErrorType;
+
 // DUCKDB_C_API const char *duckdb_error_data_message(duckdb_error_data error_data);
+export function error_data_message(error_data: ErrorData): string;
+
 // DUCKDB_C_API bool duckdb_error_data_has_error(duckdb_error_data error_data);
+export function error_data_has_error(error_data: ErrorData): boolean;
 
 // DUCKDB_C_API duckdb_state duckdb_query(duckdb_connection connection, const char *query, duckdb_result *out_result);
 export function query(connection: Connection, query: string): Promise<Result>;
@@ -1081,6 +1316,7 @@ export function vector_assign_string_element(vector: Vector, index: number, str:
 export function vector_assign_string_element_len(vector: Vector, index: number, data: Uint8Array): void;
 
 // DUCKDB_C_API void duckdb_unsafe_vector_assign_string_element_len(duckdb_vector vector, idx_t index, const char *str, idx_t str_len);
+export function unsafe_vector_assign_string_element_len(vector: Vector, index: number, data: Uint8Array): void;
 
 // DUCKDB_C_API duckdb_vector duckdb_list_vector_get_child(duckdb_vector vector);
 export function list_vector_get_child(vector: Vector): Vector;
@@ -1182,42 +1418,108 @@ export function scalar_function_get_client_context(bind_info: ScalarFunctionBind
 export function scalar_function_set_error(function_info: ScalarFunctionInfo, error: string): void;
 
 // DUCKDB_C_API duckdb_scalar_function_set duckdb_create_scalar_function_set(const char *name);
+export function create_scalar_function_set(name: string): ScalarFunctionSet;
+
 // DUCKDB_C_API void duckdb_destroy_scalar_function_set(duckdb_scalar_function_set *scalar_function_set);
+// not exposed: destroyed in finalizer
+
 // DUCKDB_C_API duckdb_state duckdb_add_scalar_function_to_set(duckdb_scalar_function_set set, duckdb_scalar_function function);
+/**
+ * Adds a copy of `scalar_function`. The copy keeps the name, parameters and return type as they are now, but shares
+ * the JS callbacks and extra info: setting those on `scalar_function` afterwards changes the set's copy too, unless
+ * `scalar_function` had none of them when added. So set it up fully first, and do not change it afterwards.
+ */
+export function add_scalar_function_to_set(scalar_function_set: ScalarFunctionSet, scalar_function: ScalarFunction): void;
+
 // DUCKDB_C_API duckdb_state duckdb_register_scalar_function_set(duckdb_connection con, duckdb_scalar_function_set set);
+export function register_scalar_function_set(connection: Connection, scalar_function_set: ScalarFunctionSet): void;
 
 // DUCKDB_C_API idx_t duckdb_scalar_function_bind_get_argument_count(duckdb_bind_info info);
+export function scalar_function_bind_get_argument_count(bind_info: ScalarFunctionBindInfo): number;
+
 // DUCKDB_C_API duckdb_expression duckdb_scalar_function_bind_get_argument(duckdb_bind_info info, idx_t index);
+/** The expression is only valid during the bind function it was obtained in. */
+export function scalar_function_bind_get_argument(bind_info: ScalarFunctionBindInfo, index: number): Expression;
 
 // DUCKDB_C_API void *duckdb_scalar_function_get_state(duckdb_function_info info);
+/** Returns the state set by the init function for the calling thread. */
+export function scalar_function_get_state(function_info: ScalarFunctionInfo): object | undefined;
+
 // DUCKDB_C_API void duckdb_scalar_function_set_init(duckdb_scalar_function scalar_function, duckdb_scalar_function_init_t init);
+/** The init function is called once per thread executing the function, before its first chunk. */
+export function scalar_function_set_init(scalar_function: ScalarFunction, func: ScalarFunctionInitFunction): void;
+
 // DUCKDB_C_API void duckdb_scalar_function_init_set_error(duckdb_init_info info, const char *error);
+export function scalar_function_init_set_error(init_info: ScalarFunctionInitInfo, error: string): void;
+
 // DUCKDB_C_API void duckdb_scalar_function_init_set_state(duckdb_init_info info, void *state, duckdb_delete_callback_t destroy);
+export function scalar_function_init_set_state(init_info: ScalarFunctionInitInfo, state: object): void;
+
 // DUCKDB_C_API void duckdb_scalar_function_init_get_client_context(duckdb_init_info info, duckdb_client_context *out_context);
+export function scalar_function_init_get_client_context(init_info: ScalarFunctionInitInfo): ClientContext;
+
 // DUCKDB_C_API void *duckdb_scalar_function_init_get_bind_data(duckdb_init_info info);
+export function scalar_function_init_get_bind_data(init_info: ScalarFunctionInitInfo): object | undefined;
+
 // DUCKDB_C_API void *duckdb_scalar_function_init_get_extra_info(duckdb_init_info info);
+export function scalar_function_init_get_extra_info(init_info: ScalarFunctionInitInfo): object | undefined;
 
 // DUCKDB_C_API duckdb_selection_vector duckdb_create_selection_vector(idx_t size);
 // DUCKDB_C_API void duckdb_destroy_selection_vector(duckdb_selection_vector sel);
 // DUCKDB_C_API sel_t *duckdb_selection_vector_get_data_ptr(duckdb_selection_vector sel);
 
 // DUCKDB_C_API duckdb_aggregate_function duckdb_create_aggregate_function();
+export function create_aggregate_function(): AggregateFunction;
+
 // DUCKDB_C_API void duckdb_destroy_aggregate_function(duckdb_aggregate_function *aggregate_function);
+export function destroy_aggregate_function_sync(aggregate_function: AggregateFunction): void;
+
 // DUCKDB_C_API void duckdb_aggregate_function_set_name(duckdb_aggregate_function aggregate_function, const char *name);
+export function aggregate_function_set_name(aggregate_function: AggregateFunction, name: string): void;
+
 // DUCKDB_C_API void duckdb_aggregate_function_add_parameter(duckdb_aggregate_function aggregate_function, duckdb_logical_type type);
+export function aggregate_function_add_parameter(aggregate_function: AggregateFunction, logical_type: LogicalType): void;
+
 // DUCKDB_C_API void duckdb_aggregate_function_set_return_type(duckdb_aggregate_function aggregate_function, duckdb_logical_type type);
+export function aggregate_function_set_return_type(aggregate_function: AggregateFunction, logical_type: LogicalType): void;
+
 // DUCKDB_C_API void duckdb_aggregate_function_set_functions(duckdb_aggregate_function aggregate_function, duckdb_aggregate_state_size state_size, duckdb_aggregate_init_t state_init, duckdb_aggregate_update_t update, duckdb_aggregate_combine_t combine, duckdb_aggregate_finalize_t finalize);
+/**
+ * State size and init are handled natively: each state is identified by a number, unique per function, and JS keeps
+ * whatever it needs for a state keyed by that id.
+ */
+export function aggregate_function_set_functions(aggregate_function: AggregateFunction, update: AggregateFunctionUpdateFunction, combine: AggregateFunctionCombineFunction, finalize: AggregateFunctionFinalizeFunction): void;
+
 // DUCKDB_C_API void duckdb_aggregate_function_set_destructor(duckdb_aggregate_function aggregate_function, duckdb_aggregate_destroy_t destroy);
+/** The destroy function is called asynchronously, some time after DuckDB destroys the states. */
+export function aggregate_function_set_destructor(aggregate_function: AggregateFunction, destroy: AggregateFunctionDestroyFunction): void;
+
 // DUCKDB_C_API duckdb_state duckdb_register_aggregate_function(duckdb_connection con, duckdb_aggregate_function aggregate_function);
+export function register_aggregate_function(connection: Connection, aggregate_function: AggregateFunction): void;
+
 // DUCKDB_C_API void duckdb_aggregate_function_set_special_handling(duckdb_aggregate_function aggregate_function);
+export function aggregate_function_set_special_handling(aggregate_function: AggregateFunction): void;
+
 // DUCKDB_C_API void duckdb_aggregate_function_set_extra_info(duckdb_aggregate_function aggregate_function, void *extra_info, duckdb_delete_callback_t destroy);
+export function aggregate_function_set_extra_info(aggregate_function: AggregateFunction, extra_info: object): void;
+
 // DUCKDB_C_API void *duckdb_aggregate_function_get_extra_info(duckdb_function_info info);
+export function aggregate_function_get_extra_info(function_info: AggregateFunctionInfo): object | undefined;
+
 // DUCKDB_C_API void duckdb_aggregate_function_set_error(duckdb_function_info info, const char *error);
+export function aggregate_function_set_error(function_info: AggregateFunctionInfo, error: string): void;
 
 // DUCKDB_C_API duckdb_aggregate_function_set duckdb_create_aggregate_function_set(const char *name);
+export function create_aggregate_function_set(name: string): AggregateFunctionSet;
+
 // DUCKDB_C_API void duckdb_destroy_aggregate_function_set(duckdb_aggregate_function_set *aggregate_function_set);
+// not exposed: destroyed in finalizer
+
 // DUCKDB_C_API duckdb_state duckdb_add_aggregate_function_to_set(duckdb_aggregate_function_set set, duckdb_aggregate_function function);
+export function add_aggregate_function_to_set(aggregate_function_set: AggregateFunctionSet, aggregate_function: AggregateFunction): void;
+
 // DUCKDB_C_API duckdb_state duckdb_register_aggregate_function_set(duckdb_connection con, duckdb_aggregate_function_set set);
+export function register_aggregate_function_set(connection: Connection, aggregate_function_set: AggregateFunctionSet): void;
 
 // DUCKDB_C_API duckdb_table_function duckdb_create_table_function();
 export function create_table_function(): TableFunction;
@@ -1319,9 +1621,16 @@ export function function_get_local_init_data(function_info: TableFunctionInfo):
 export function function_set_error(function_info: TableFunctionInfo, error: string): void;
 
 // DUCKDB_C_API void duckdb_add_replacement_scan(duckdb_database db, duckdb_replacement_callback_t replacement, void *extra_data, duckdb_delete_callback_t delete_callback);
+export function add_replacement_scan(database: Database, replacement: ReplacementScanFunction): void;
+
 // DUCKDB_C_API void duckdb_replacement_scan_set_function_name(duckdb_replacement_scan_info info, const char *function_name);
+export function replacement_scan_set_function_name(info: ReplacementScanInfo, function_name: string): void;
+
 // DUCKDB_C_API void duckdb_replacement_scan_add_parameter(duckdb_replacement_scan_info info, duckdb_value parameter);
+export function replacement_scan_add_parameter(info: ReplacementScanInfo, parameter: Value): void;
+
 // DUCKDB_C_API void duckdb_replacement_scan_set_error(duckdb_replacement_scan_info info, const char *error);
+export function replacement_scan_set_error(info: ReplacementScanInfo, error: string): void;
 
 // DUCKDB_C_API duckdb_profiling_info duckdb_get_profiling_info(duckdb_connection connection);
 // DUCKDB_C_API duckdb_value duckdb_profiling_info_get_value(duckdb_profiling_info info, const char *key);
@@ -1349,11 +1658,13 @@ export function appender_column_type(appender: Appender, column_index: number):
 // #endif
 
 // DUCKDB_C_API duckdb_error_data duckdb_appender_error_data(duckdb_appender appender);
+export function appender_error_data(appender: Appender): ErrorData;
 
 // DUCKDB_C_API duckdb_state duckdb_appender_flush(duckdb_appender appender);
 export function appender_flush_sync(appender: Appender): void;
 
 // DUCKDB_C_API duckdb_state duckdb_appender_clear(duckdb_appender appender);
+export function appender_clear(appender: Appender): void;
 
 // DUCKDB_C_API duckdb_state duckdb_appender_close(duckdb_appender appender);
 export function appender_close_sync(appender: Appender): void;
@@ -1362,7 +1673,10 @@ export function appender_close_sync(appender: Appender): void;
 // not exposed: destroyed in finalizer
 
 // DUCKDB_C_API duckdb_state duckdb_appender_add_column(duckdb_appender appender, const char *name);
+export function appender_add_column(appender: Appender, name: string): void;
+
 // DUCKDB_C_API duckdb_state duckdb_appender_clear_columns(duckdb_appender appender);
+export function appender_clear_columns(appender: Appender): void;
 
 // DUCKDB_C_API duckdb_state duckdb_appender_begin_row(duckdb_appender appender);
 // not exposed: no-op
@@ -1374,6 +1688,7 @@ export function appender_end_row(appender: Appender): void;
 export function append_default(appender: Appender): void;
 
 // DUCKDB_C_API duckdb_state duckdb_append_default_to_chunk(duckdb_appender appender, duckdb_data_chunk chunk, idx_t col, idx_t row);
+export function append_default_to_chunk(appender: Appender, chunk: DataChunk, column_index: number, row_index: number): void;
 
 // DUCKDB_C_API duckdb_state duckdb_append_bool(duckdb_appender appender, bool value);
 export function append_bool(appender: Appender, bool: boolean): void;
@@ -1493,39 +1808,104 @@ export function append_data_chunk(appender: Appender, chunk: DataChunk): void;
 export function fetch_chunk(result: Result): Promise<DataChunk | null>;
 
 // DUCKDB_C_API duckdb_cast_function duckdb_create_cast_function();
+export function create_cast_function(): CastFunction;
+
 // DUCKDB_C_API void duckdb_cast_function_set_source_type(duckdb_cast_function cast_function, duckdb_logical_type source_type);
+export function cast_function_set_source_type(cast_function: CastFunction, source_type: LogicalType): void;
+
 // DUCKDB_C_API void duckdb_cast_function_set_target_type(duckdb_cast_function cast_function, duckdb_logical_type target_type);
+export function cast_function_set_target_type(cast_function: CastFunction, target_type: LogicalType): void;
+
 // DUCKDB_C_API void duckdb_cast_function_set_implicit_cast_cost(duckdb_cast_function cast_function, int64_t cost);
+export function cast_function_set_implicit_cast_cost(cast_function: CastFunction, cost: number): void;
+
 // DUCKDB_C_API void duckdb_cast_function_set_function(duckdb_cast_function cast_function, duckdb_cast_function_t function);
+export function cast_function_set_function(cast_function: CastFunction, func: CastFunctionMainFunction): void;
+
 // DUCKDB_C_API void duckdb_cast_function_set_extra_info(duckdb_cast_function cast_function, void *extra_info, duckdb_delete_callback_t destroy);
+export function cast_function_set_extra_info(cast_function: CastFunction, extra_info: object): void;
+
 // DUCKDB_C_API void *duckdb_cast_function_get_extra_info(duckdb_function_info info);
+export function cast_function_get_extra_info(function_info: CastFunctionInfo): object | undefined;
+
 // DUCKDB_C_API duckdb_cast_mode duckdb_cast_function_get_cast_mode(duckdb_function_info info);
+export function cast_function_get_cast_mode(function_info: CastFunctionInfo): CastMode;
+
 // DUCKDB_C_API void duckdb_cast_function_set_error(duckdb_function_info info, const char *error);
+export function cast_function_set_error(function_info: CastFunctionInfo, error: string): void;
+
 // DUCKDB_C_API void duckdb_cast_function_set_row_error(duckdb_function_info info, const char *error, idx_t row, duckdb_vector output);
+export function cast_function_set_row_error(function_info: CastFunctionInfo, error: string, row: number, output: Vector): void;
+
 // DUCKDB_C_API duckdb_state duckdb_register_cast_function(duckdb_connection con, duckdb_cast_function cast_function);
+export function register_cast_function(connection: Connection, cast_function: CastFunction): void;
+
 // DUCKDB_C_API void duckdb_destroy_cast_function(duckdb_cast_function *cast_function);
+export function destroy_cast_function_sync(cast_function: CastFunction): void;
 
 // DUCKDB_C_API void duckdb_destroy_expression(duckdb_expression *expr);
+// not exposed: destroyed in finalizer
+
 // DUCKDB_C_API duckdb_logical_type duckdb_expression_return_type(duckdb_expression expr);
+export function expression_return_type(expression: Expression): LogicalType;
+
 // DUCKDB_C_API bool duckdb_expression_is_foldable(duckdb_expression expr);
+export function expression_is_foldable(expression: Expression): boolean;
+
 // DUCKDB_C_API duckdb_error_data duckdb_expression_fold(duckdb_client_context context, duckdb_expression expr, duckdb_value *out_value);
+/** Evaluates a foldable expression to a constant. Throws if evaluation fails. */
+export function expression_fold(client_context: ClientContext, expression: Expression): Value;
 
 // DUCKDB_C_API duckdb_file_system duckdb_client_context_get_file_system(duckdb_client_context context);
+export function client_context_get_file_system(client_context: ClientContext): FileSystem;
+
 // DUCKDB_C_API void duckdb_destroy_file_system(duckdb_file_system *file_system);
+// not exposed: destroyed in finalizer
+
 // DUCKDB_C_API duckdb_error_data duckdb_file_system_error_data(duckdb_file_system file_system);
+export function file_system_error_data(file_system: FileSystem): ErrorData;
+
 // DUCKDB_C_API duckdb_state duckdb_file_system_open(duckdb_file_system file_system, const char *path, duckdb_file_open_options options, duckdb_file_handle *out_file);
+/** Open a file through the database's file system, which includes any registered by extensions. Throws on failure. */
+export function file_system_open_sync(file_system: FileSystem, path: string, options: FileOpenOptions): FileHandle;
+
 // DUCKDB_C_API duckdb_file_open_options duckdb_create_file_open_options();
+export function create_file_open_options(): FileOpenOptions;
+
 // DUCKDB_C_API duckdb_state duckdb_file_open_options_set_flag(duckdb_file_open_options options, duckdb_file_flag flag, bool value);
+export function file_open_options_set_flag(options: FileOpenOptions, flag: FileFlag, value: boolean): void;
+
 // DUCKDB_C_API void duckdb_destroy_file_open_options(duckdb_file_open_options *options);
+// not exposed: destroyed in finalizer
+
 // DUCKDB_C_API void duckdb_destroy_file_handle(duckdb_file_handle *file_handle);
+// not exposed: destroyed in finalizer
+
 // DUCKDB_C_API duckdb_error_data duckdb_file_handle_error_data(duckdb_file_handle file_handle);
+export function file_handle_error_data(file_handle: FileHandle): ErrorData;
+
 // DUCKDB_C_API int64_t duckdb_file_handle_read(duckdb_file_handle file_handle, void *buffer, int64_t size);
+/** Read into `buffer`, up to its length, from the current position. Returns the number of bytes read; 0 at the end. */
+export function file_handle_read_sync(file_handle: FileHandle, buffer: Uint8Array): number;
+
 // DUCKDB_C_API int64_t duckdb_file_handle_write(duckdb_file_handle file_handle, const void *buffer, int64_t size);
+/** Write `data` at the current position. Returns the number of bytes written. */
+export function file_handle_write_sync(file_handle: FileHandle, data: Uint8Array): number;
+
 // DUCKDB_C_API int64_t duckdb_file_handle_tell(duckdb_file_handle file_handle);
+export function file_handle_tell(file_handle: FileHandle): number;
+
 // DUCKDB_C_API int64_t duckdb_file_handle_size(duckdb_file_handle file_handle);
+export function file_handle_size(file_handle: FileHandle): number;
+
 // DUCKDB_C_API duckdb_state duckdb_file_handle_seek(duckdb_file_handle file_handle, int64_t position);
+export function file_handle_seek(file_handle: FileHandle, position: number): void;
+
 // DUCKDB_C_API duckdb_state duckdb_file_handle_sync(duckdb_file_handle file_handle);
+export function file_handle_sync(file_handle: FileHandle): void;
+
 // DUCKDB_C_API duckdb_state duckdb_file_handle_close(duckdb_file_handle file_handle);
+export function file_handle_close_sync(file_handle: FileHandle): void;
 
 // DUCKDB_C_API duckdb_config_option duckdb_create_config_option();
 // DUCKDB_C_API void duckdb_destroy_config_option(duckdb_config_option *option);
@@ -1538,41 +1918,118 @@ export function fetch_chunk(result: Result): Promise<DataChunk | null>;
 // DUCKDB_C_API duckdb_value duckdb_client_context_get_config_option(duckdb_client_context context, const char *name, duckdb_config_option_scope *out_scope);
 
 // DUCKDB_C_API duckdb_copy_function duckdb_create_copy_function();
+export function create_copy_function(): CopyFunction;
+
 // DUCKDB_C_API void duckdb_copy_function_set_name(duckdb_copy_function copy_function, const char *name);
+export function copy_function_set_name(copy_function: CopyFunction, name: string): void;
+
 // DUCKDB_C_API void duckdb_copy_function_set_extra_info(duckdb_copy_function copy_function, void *extra_info, duckdb_delete_callback_t destructor);
+export function copy_function_set_extra_info(copy_function: CopyFunction, extra_info: object): void;
+
 // DUCKDB_C_API duckdb_state duckdb_register_copy_function(duckdb_connection connection, duckdb_copy_function copy_function);
+export function register_copy_function(connection: Connection, copy_function: CopyFunction): void;
+
 // DUCKDB_C_API void duckdb_destroy_copy_function(duckdb_copy_function *copy_function);
+export function destroy_copy_function_sync(copy_function: CopyFunction): void;
+
 // DUCKDB_C_API void duckdb_copy_function_set_bind(duckdb_copy_function copy_function, duckdb_copy_function_bind_t bind);
+export function copy_function_set_bind(copy_function: CopyFunction, func: CopyFunctionBindFunction): void;
+
 // DUCKDB_C_API void duckdb_copy_function_bind_set_error(duckdb_copy_function_bind_info info, const char *error);
+export function copy_function_bind_set_error(bind_info: CopyFunctionBindInfo, error: string): void;
+
 // DUCKDB_C_API void *duckdb_copy_function_bind_get_extra_info(duckdb_copy_function_bind_info info);
+export function copy_function_bind_get_extra_info(bind_info: CopyFunctionBindInfo): object | undefined;
+
 // DUCKDB_C_API duckdb_client_context duckdb_copy_function_bind_get_client_context(duckdb_copy_function_bind_info info);
+export function copy_function_bind_get_client_context(bind_info: CopyFunctionBindInfo): ClientContext;
+
 // DUCKDB_C_API idx_t duckdb_copy_function_bind_get_column_count(duckdb_copy_function_bind_info info);
+export function copy_function_bind_get_column_count(bind_info: CopyFunctionBindInfo): number;
+
 // DUCKDB_C_API duckdb_logical_type duckdb_copy_function_bind_get_column_type(duckdb_copy_function_bind_info info, idx_t col_idx);
+export function copy_function_bind_get_column_type(bind_info: CopyFunctionBindInfo, column_index: number): LogicalType;
+
 // DUCKDB_C_API duckdb_value duckdb_copy_function_bind_get_options(duckdb_copy_function_bind_info info);
+/** Get the options given to the COPY statement, as a STRUCT with one LIST field per option, holding its values. */
+export function copy_function_bind_get_options(bind_info: CopyFunctionBindInfo): Value;
+
 // DUCKDB_C_API void duckdb_copy_function_bind_set_bind_data(duckdb_copy_function_bind_info info, void *bind_data, duckdb_delete_callback_t destructor);
+export function copy_function_bind_set_bind_data(bind_info: CopyFunctionBindInfo, bind_data: object): void;
+
 // DUCKDB_C_API void duckdb_copy_function_set_global_init(duckdb_copy_function copy_function, duckdb_copy_function_global_init_t init);
+export function copy_function_set_global_init(copy_function: CopyFunction, func: CopyFunctionGlobalInitFunction): void;
+
 // DUCKDB_C_API void duckdb_copy_function_global_init_set_error(duckdb_copy_function_global_init_info info, const char *error);
+export function copy_function_global_init_set_error(global_init_info: CopyFunctionGlobalInitInfo, error: string): void;
+
 // DUCKDB_C_API void *duckdb_copy_function_global_init_get_extra_info(duckdb_copy_function_global_init_info info);
+export function copy_function_global_init_get_extra_info(global_init_info: CopyFunctionGlobalInitInfo): object | undefined;
+
 // DUCKDB_C_API duckdb_client_context duckdb_copy_function_global_init_get_client_context(duckdb_copy_function_global_init_info info);
+export function copy_function_global_init_get_client_context(global_init_info: CopyFunctionGlobalInitInfo): ClientContext;
+
 // DUCKDB_C_API void *duckdb_copy_function_global_init_get_bind_data(duckdb_copy_function_global_init_info info);
+export function copy_function_global_init_get_bind_data(global_init_info: CopyFunctionGlobalInitInfo): object | undefined;
+
 // DUCKDB_C_API const char *duckdb_copy_function_global_init_get_file_path(duckdb_copy_function_global_init_info info);
+export function copy_function_global_init_get_file_path(global_init_info: CopyFunctionGlobalInitInfo): string;
+
 // DUCKDB_C_API void duckdb_copy_function_global_init_set_global_state(duckdb_copy_function_global_init_info info, void *global_state, duckdb_delete_callback_t destructor);
+export function copy_function_global_init_set_global_state(global_init_info: CopyFunctionGlobalInitInfo, global_state: object): void;
+
 // DUCKDB_C_API void duckdb_copy_function_set_sink(duckdb_copy_function copy_function, duckdb_copy_function_sink_t function);
+export function copy_function_set_sink(copy_function: CopyFunction, func: CopyFunctionSinkFunction): void;
+
 // DUCKDB_C_API void duckdb_copy_function_sink_set_error(duckdb_copy_function_sink_info info, const char *error);
+export function copy_function_sink_set_error(sink_info: CopyFunctionSinkInfo, error: string): void;
+
 // DUCKDB_C_API void *duckdb_copy_function_sink_get_extra_info(duckdb_copy_function_sink_info info);
+export function copy_function_sink_get_extra_info(sink_info: CopyFunctionSinkInfo): object | undefined;
+
 // DUCKDB_C_API duckdb_client_context duckdb_copy_function_sink_get_client_context(duckdb_copy_function_sink_info info);
+export function copy_function_sink_get_client_context(sink_info: CopyFunctionSinkInfo): ClientContext;
+
 // DUCKDB_C_API void *duckdb_copy_function_sink_get_bind_data(duckdb_copy_function_sink_info info);
+export function copy_function_sink_get_bind_data(sink_info: CopyFunctionSinkInfo): object | undefined;
+
 // DUCKDB_C_API void *duckdb_copy_function_sink_get_global_state(duckdb_copy_function_sink_info info);
+export function copy_function_sink_get_global_state(sink_info: CopyFunctionSinkInfo): object | undefined;
+
 // DUCKDB_C_API void duckdb_copy_function_set_finalize(duckdb_copy_function copy_function, duckdb_copy_function_finalize_t finalize);
+export function copy_function_set_finalize(copy_function: CopyFunction, func: CopyFunctionFinalizeFunction): void;
+
 // DUCKDB_C_API void duckdb_copy_function_finalize_set_error(duckdb_copy_function_finalize_info info, const char *error);
+export function copy_function_finalize_set_error(finalize_info: CopyFunctionFinalizeInfo, error: string): void;
+
 // DUCKDB_C_API void *duckdb_copy_function_finalize_get_extra_info(duckdb_copy_function_finalize_info info);
+export function copy_function_finalize_get_extra_info(finalize_info: CopyFunctionFinalizeInfo): object | undefined;
+
 // DUCKDB_C_API duckdb_client_context duckdb_copy_function_finalize_get_client_context(duckdb_copy_function_finalize_info info);
+export function copy_function_finalize_get_client_context(finalize_info: CopyFunctionFinalizeInfo): ClientContext;
+
 // DUCKDB_C_API void *duckdb_copy_function_finalize_get_bind_data(duckdb_copy_function_finalize_info info);
+export function copy_function_finalize_get_bind_data(finalize_info: CopyFunctionFinalizeInfo): object | undefined;
+
 // DUCKDB_C_API void *duckdb_copy_function_finalize_get_global_state(duckdb_copy_function_finalize_info info);
+export function copy_function_finalize_get_global_state(finalize_info: CopyFunctionFinalizeInfo): object | undefined;
+
 // DUCKDB_C_API void duckdb_copy_function_set_copy_from_function(duckdb_copy_function copy_function, duckdb_table_function table_function);
+/**
+ * Make `COPY ... FROM` with this format read rows with `table_function`. Its bind function receives the file path as its
+ * first parameter. Sets a copy of `table_function`, so set it up fully first.
+ */
+export function copy_function_set_copy_from_function(copy_function: CopyFunction, table_function: TableFunction): void;
+
 // DUCKDB_C_API idx_t duckdb_table_function_bind_get_result_column_count(duckdb_bind_info info);
+/** Get the number of columns the table function is expected to produce. Only set when binding for `COPY ... FROM`. */
+export function table_function_bind_get_result_column_count(bind_info: TableFunctionBindInfo): number;
+
 // DUCKDB_C_API const char *duckdb_table_function_bind_get_result_column_name(duckdb_bind_info info, idx_t col_idx);
+export function table_function_bind_get_result_column_name(bind_info: TableFunctionBindInfo, column_index: number): string;
+
 // DUCKDB_C_API duckdb_logical_type duckdb_table_function_bind_get_result_column_type(duckdb_bind_info info, idx_t col_idx);
+export function table_function_bind_get_result_column_type(bind_info: TableFunctionBindInfo, column_index: number): LogicalType;
 
 // DUCKDB_C_API duckdb_catalog duckdb_client_context_get_catalog(duckdb_client_context context, const char *catalog_name);
 // DUCKDB_C_API const char *duckdb_catalog_get_type_name(duckdb_catalog catalog);
@@ -1619,3 +2076,269 @@ export function copy_data_to_vector(target_vector: Vector, target_byte_offset: n
  * Performs an efficient-but-unsafe memory copy. Use with care.
  */
 export function copy_data_to_vector_validity(target_vector: Vector, target_byte_offset: number, source_buffer: ArrayBuffer, source_byte_offset: number, source_byte_count: number): void;
+
+// ADDED
+/**
+ * Set the first `row_count` rows of `vector` to NULL where `null_mask` is nonzero, and to valid elsewhere. Allocates
+ * the vector's validity only if some row is NULL.
+ */
+export function vector_set_null_mask(vector: Vector, null_mask: Uint8Array, row_count: number): void;
+
+// ADDED
+/**
+ * Assign `offsets.length - 1` strings to `vector`, starting at `start_index`.
+ *
+ * The string for item `start_index + i` is the bytes of `data` from `offsets[i]` (inclusive) to `offsets[i + 1]` (exclusive).
+ * Throws, without assigning anything, unless `offsets` is non-decreasing and every offset is at most `data.length`.
+ *
+ * Used to write an entire VARCHAR or BLOB column from one contiguous buffer, instead of calling
+ * `vector_assign_string_element` once per item.
+ */
+export function vector_assign_strings(vector: Vector, start_index: number, data: Uint8Array, offsets: Uint32Array): void;
+
+// ADDED
+/**
+ * Same as `vector_assign_strings`, but skips UTF-8 validation of VARCHAR data.
+ *
+ * Only use this for data known to be valid UTF-8, such as the output of `TextEncoder` or bytes read from another
+ * VARCHAR vector. Assigning invalid UTF-8 this way leads to undefined behavior.
+ */
+export function unsafe_vector_assign_strings(vector: Vector, start_index: number, data: Uint8Array, offsets: Uint32Array): void;
+
+// ADDED
+/**
+ * Create a pool of main functions for scalar functions, to be attached from worker threads.
+ *
+ * A scalar function given a pool with `scalar_function_set_worker_pool` runs each call on one of the functions
+ * attached to the pool, chosen round-robin, so calls from DuckDB's threads run in parallel across workers instead of
+ * one at a time on the thread that registered the function.
+ */
+export function create_scalar_function_worker_pool(): ScalarFunctionWorkerPool;
+
+// ADDED
+/**
+ * Get the id of `pool`. Pass it to worker threads, which attach to the pool by id.
+ */
+export function scalar_function_worker_pool_get_id(pool: ScalarFunctionWorkerPool): number;
+
+// ADDED
+/**
+ * Attach `func` to the pool with id `pool_id`. Call from a worker thread.
+ *
+ * `func` runs on the calling thread. To report an error, throw. Once attached, the worker thread stays alive until it
+ * detaches or is terminated.
+ */
+export function scalar_function_worker_pool_attach(pool_id: number, func: ScalarFunctionWorkerMainFunction): void;
+
+// ADDED
+/**
+ * Detach every function the calling thread attached to the pool with id `pool_id`.
+ */
+export function scalar_function_worker_pool_detach(pool_id: number): void;
+
+// ADDED
+/**
+ * Run the main function of `scalar_function` on the functions attached to `pool`, instead of one set with
+ * `scalar_function_set_function`. Setting a main function afterwards replaces the pool.
+ *
+ * A call made when no function is attached fails with an error.
+ */
+export function scalar_function_set_worker_pool(scalar_function: ScalarFunction, pool: ScalarFunctionWorkerPool): void;
+
+// ADDED
+/**
+ * Load the shared library at `path`, so its exported C functions can be used as function callbacks.
+ *
+ * Callbacks from a native library are called by DuckDB directly, on its own threads, without going through the JS
+ * thread. They must have the signature of the corresponding C API callback type (e.g. `duckdb_scalar_function_t`),
+ * which cannot be checked. To call the C API, the library should link against the same libduckdb these bindings use.
+ *
+ * Libraries are never unloaded.
+ */
+export function load_native_library(path: string): NativeLibrary;
+
+// ADDED
+/**
+ * Set the bind callback of `scalar_function` to the `duckdb_scalar_function_bind_t` exported from `library` as
+ * `symbol_name`.
+ *
+ * Native callbacks must not call the C API's extra info getters, such as `duckdb_scalar_function_get_extra_info`: once
+ * any JS callback or extra info is set, they return the bindings' internal state, not the object given to
+ * `scalar_function_set_extra_info`. Nor may native callbacks read bind data set from JS, and JS callbacks must not read
+ * bind data set by native ones, so do not mix native and JS callbacks on the same function when either uses them.
+ */
+export function scalar_function_set_native_bind(scalar_function: ScalarFunction, library: NativeLibrary, symbol_name: string): void;
+
+// ADDED
+/**
+ * Set the main function of `scalar_function` to the `duckdb_scalar_function_t` exported from `library` as
+ * `symbol_name`. See `scalar_function_set_native_bind` about mixing native and JS callbacks.
+ */
+export function scalar_function_set_native_function(scalar_function: ScalarFunction, library: NativeLibrary, symbol_name: string): void;
+
+// ADDED
+/**
+ * Set the bind callback of `table_function` to the `duckdb_table_function_bind_t` exported from `library` as
+ * `symbol_name`. See `scalar_function_set_native_bind` about mixing native and JS callbacks.
+ */
+export function table_function_set_native_bind(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void;
+
+// ADDED
+/**
+ * Set the init callback of `table_function` to the `duckdb_table_function_init_t` exported from `library` as
+ * `symbol_name`. See `scalar_function_set_native_bind` about mixing native and JS callbacks.
+ */
+export function table_function_set_native_init(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void;
+
+// ADDED
+/**
+ * Set the local init callback of `table_function` to the `duckdb_table_function_init_t` exported from `library` as
+ * `symbol_name`. See `scalar_function_set_native_bind` about mixing native and JS callbacks.
+ */
+export function table_function_set_native_local_init(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void;
+
+// ADDED
+/**
+ * Set the main function of `table_function` to the `duckdb_table_function_t` exported from `library` as
+ * `symbol_name`. See `scalar_function_set_native_bind` about mixing native and JS callbacks.
+ */
+export function table_function_set_native_function(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void;
+
+// ADDED
+/**
+ * Set the function of `cast_function` to the `duckdb_cast_function_t` exported from `library` as `symbol_name`. A
+ * native cast function must not read extra info set from JS.
+ */
+export function cast_function_set_native_function(cast_function: CastFunction, library: NativeLibrary, symbol_name: string): void;
+
+// ADDED
+/**
+ * Deduplicate the input rows of `scalar_function` before calling its main function (JS or worker pool), which is then
+ * called with only the distinct rows, and copy each result back out to every row with the same input. Chunks with
+ * argument types other than fixed-width types, VARCHAR, and BLOB, or with mostly distinct rows, are passed through as
+ * they are. Must not be enabled for volatile functions.
+ */
+export function scalar_function_set_deduplicate_inputs(scalar_function: ScalarFunction, enabled: boolean): void;
+
+// ADDED
+/**
+ * Create a bounded queue of output chunks for a table function scan, holding at most `capacity` chunks. JS pushes
+ * filled chunks into it ahead of DuckDB, and a main function set with `table_function_set_chunk_queue_function` pops
+ * them without calling into JS. A queue serves one scan; create one per call of the init function.
+ */
+export function create_table_function_chunk_queue(capacity: number): TableFunctionChunkQueue;
+
+// ADDED
+/**
+ * Push a filled chunk, which must not be modified afterwards. Resolves to true once there is room for another chunk,
+ * or to false if the scan has ended and wants no more chunks. Wait for each push to resolve before the next.
+ */
+export function table_function_chunk_queue_push(queue: TableFunctionChunkQueue, chunk: DataChunk): Promise<boolean>;
+
+// ADDED
+/**
+ * Report that no more chunks will be pushed. Chunks already pushed are still returned; after them, the scan ends, or
+ * fails with `error` if given.
+ */
+export function table_function_chunk_queue_close(queue: TableFunctionChunkQueue, error?: string): void;
+
+// ADDED
+/** Set the init data of the scan to `queue`, replacing any other init data. Call from the init function. */
+export function init_set_chunk_queue(init_info: TableFunctionInitInfo, queue: TableFunctionChunkQueue): void;
+
+// ADDED
+/**
+ * Set the main function of `table_function` to one that pops chunks from the queue set by `init_set_chunk_queue`,
+ * on DuckDB's thread. Chunks must have the scan's output columns.
+ */
+export function table_function_set_chunk_queue_function(table_function: TableFunction): void;
+
+// ADDED
+/**
+ * Create a pool of main functions for table functions, to be attached from worker threads.
+ *
+ * A table function given a pool with `table_function_set_worker_pool` binds each of DuckDB's scan threads to one of
+ * the functions attached to the pool, chosen round-robin, and runs all of that thread's main calls on it, so a scan
+ * with more than one thread reads in parallel across workers.
+ */
+export function create_table_function_worker_pool(): TableFunctionWorkerPool;
+
+// ADDED
+/**
+ * Get the id of `pool`. Pass it to worker threads, which attach to the pool by id.
+ */
+export function table_function_worker_pool_get_id(pool: TableFunctionWorkerPool): number;
+
+// ADDED
+/**
+ * Attach `func` to the pool with id `pool_id`. Call from a worker thread.
+ *
+ * `func` runs on the calling thread. It fills `output` like a main function, reading the scan through `scan`, which
+ * is only valid during the call. To report an error, throw. Once attached, the worker thread stays alive until it
+ * detaches or is terminated.
+ */
+export function table_function_worker_pool_attach(pool_id: number, func: TableFunctionWorkerMainFunction): void;
+
+// ADDED
+/**
+ * Detach every function the calling thread attached to the pool with id `pool_id`.
+ */
+export function table_function_worker_pool_detach(pool_id: number): void;
+
+// ADDED
+/**
+ * Run the local init and main functions of `table_function` on the functions attached to `pool`, replacing any set
+ * before. Do not set either afterwards. The init function still runs on the calling thread; it should set max threads,
+ * and may pass data to the workers with `init_set_worker_scan_data`.
+ *
+ * A scan that starts when no function is attached, or whose worker detaches, fails with an error.
+ */
+export function table_function_set_worker_pool(table_function: TableFunction, pool: TableFunctionWorkerPool): void;
+
+// ADDED
+/**
+ * Set the init data of a scan run by a worker pool to `data`, which its workers read with
+ * `table_function_worker_scan_get_data`, replacing any other init data. Call from the init function.
+ */
+export function init_set_worker_scan_data(init_info: TableFunctionInitInfo, data: string): void;
+
+// ADDED
+/** Get the data set by the init function with `init_set_worker_scan_data`, if any. */
+export function table_function_worker_scan_get_data(scan: TableFunctionWorkerScan): string | undefined;
+
+// ADDED
+/**
+ * Claim the next partition number of the scan, counting up from 0 across all of its threads. Workers use this to
+ * divide a partitioned source between them; the count is shared by the whole scan, not kept per worker.
+ */
+export function table_function_worker_scan_next_partition(scan: TableFunctionWorkerScan): number;
+
+// ADDED
+/** Get the state set by `table_function_worker_scan_set_state` for this scan thread, if any. */
+export function table_function_worker_scan_get_state(scan: TableFunctionWorkerScan): object | undefined;
+
+// ADDED
+/**
+ * Set state kept for this scan thread across main calls, such as an open file. Calls for the thread always run on the
+ * same worker. The state is released when the thread's part of the scan ends.
+ */
+export function table_function_worker_scan_set_state(scan: TableFunctionWorkerScan, state: object): void;
+
+// ADDED
+/**
+ * Make `table_function` scan `columns` natively, on DuckDB's threads and without calling into JS, replacing its bind,
+ * init, and main functions. The table function supports projection pushdown, and its scans run in parallel.
+ *
+ * The arrays are referenced, not copied, for as long as the table function is, so they must not be written, resized,
+ * or transferred meanwhile. All columns must have the same row count. Throws if a column is invalid.
+ */
+export function table_function_set_typed_array_columns(table_function: TableFunction, columns: readonly TypedArrayTableColumn[]): void;
+
+// ADDED
+/**
+ * Make `copy_function` sink into JS without blocking DuckDB's threads on each chunk, replacing its sink function. Each
+ * sunk chunk is copied and queued, and `sink` is called on the main thread with all chunks queued since its previous
+ * call. A DuckDB thread waits only while `max_pending_chunks` chunks are queued or being written. The finalize function
+ * runs once every queued chunk has been written; if `sink` throws or rejects, the query fails instead.
+ */
+export function copy_function_set_async_sink(copy_function: CopyFunction, sink: CopyFunctionAsyncSinkFunction, max_pending_chunks: number): void;
@@ -0,0 +1,298 @@
+#pragma once
+
+#include "externals.h"
+#include "duckdb_thread_callback.h"
+#include "type_tags.h"
+#include "napi_ref_reaper.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Aggregate functions
+//
+// Everything specific to the aggregate function family lives here, following
+// scalar_function_helpers.h.
+//
+// States live in JS, not in DuckDB's state buffers. Each buffer holds only an id,
+// which JS uses to look its state up, and a pointer back to the function's extra
+// info, which the destroy callback needs because DuckDB passes it nothing else.
+// That keeps the two per-state callbacks off the JS thread entirely: state size
+// and init are answered here, and the JS side creates a state the first time it
+// sees an id. The remaining callbacks each take a whole batch of states per call
+// to JS -- update a chunk with one state id per row, combine and finalize arrays
+// of ids -- rather than one call per row or per state.
+
+// Info external
+//
+// duckdb_function_info is reused by every function family; see the note in
+// scalar_function_helpers.h. Aggregate functions have no bind or init info.
+
+inline Napi::External<_duckdb_function_info> CreateExternalForAggregateFunctionInfo(Napi::Env env, duckdb_function_info function_info) {
+  return CreateExternalWithoutFinalizer<_duckdb_function_info>(env, AggregateFunctionInfoTypeTag, function_info);
+}
+
+inline duckdb_function_info GetAggregateFunctionInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_function_info>(env, AggregateFunctionInfoTypeTag, value, "Invalid aggregate function info argument");
+}
+
+// States
+
+struct AggregateFunctionInternalExtraInfo;
+
+struct AggregateFunctionState {
+  double id; // a double so that JS reads ids straight out of a Float64Array
+  AggregateFunctionInternalExtraInfo *owner;
+};
+
+inline AggregateFunctionState *GetAggregateFunctionState(duckdb_aggregate_state state) {
+  return reinterpret_cast<AggregateFunctionState*>(state);
+}
+
+inline Napi::Float64Array CreateAggregateFunctionStateIdArray(Napi::Env env, duckdb_aggregate_state *states, idx_t count) {
+  auto state_ids = Napi::Float64Array::New(env, count);
+  for (idx_t i = 0; i < count; i++) {
+    state_ids[i] = GetAggregateFunctionState(states[i])->id;
+  }
+  return state_ids;
+}
+
+// Callbacks
+
+struct AggregateFunctionUpdateCallbackTraits {
+  struct Payload {
+    duckdb_function_info info;
+    duckdb_data_chunk input;
+    duckdb_aggregate_state *states;
+  };
+
+  static const char *ResourceName() {
+    return "AggregateFunctionUpdate";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForAggregateFunctionInfo(env, payload.info),
+        CreateExternalForDataChunkWithoutFinalizer(env, payload.input),
+        CreateAggregateFunctionStateIdArray(env, payload.states, duckdb_data_chunk_get_size(payload.input))
+      }
+    );
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_aggregate_function_set_error(payload.info, message);
+  }
+};
+
+struct AggregateFunctionCombineCallbackTraits {
+  struct Payload {
+    duckdb_function_info info;
+    duckdb_aggregate_state *source;
+    duckdb_aggregate_state *target;
+    idx_t count;
+  };
+
+  static const char *ResourceName() {
+    return "AggregateFunctionCombine";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForAggregateFunctionInfo(env, payload.info),
+        CreateAggregateFunctionStateIdArray(env, payload.source, payload.count),
+        CreateAggregateFunctionStateIdArray(env, payload.target, payload.count)
+      }
+    );
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_aggregate_function_set_error(payload.info, message);
+  }
+};
+
+struct AggregateFunctionFinalizeCallbackTraits {
+  struct Payload {
+    duckdb_function_info info;
+    duckdb_aggregate_state *source;
+    duckdb_vector result;
+    idx_t count;
+    idx_t offset;
+  };
+
+  static const char *ResourceName() {
+    return "AggregateFunctionFinalize";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForAggregateFunctionInfo(env, payload.info),
+        CreateAggregateFunctionStateIdArray(env, payload.source, payload.count),
+        CreateExternalForVectorWithoutFinalizer(env, payload.result),
+        Napi::Number::New(env, payload.offset)
+      }
+    );
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_aggregate_function_set_error(payload.info, message);
+  }
+};
+
+// Extra info
+
+struct AggregateFunctionInternalExtraInfo {
+  DuckDBThreadCallback<AggregateFunctionUpdateCallbackTraits> update_callback;
+  DuckDBThreadCallback<AggregateFunctionCombineCallbackTraits> combine_callback;
+  DuckDBThreadCallback<AggregateFunctionFinalizeCallbackTraits> finalize_callback;
+  std::shared_ptr<ManagedObjectReference> destroy_function_ref;
+  std::shared_ptr<ManagedObjectReference> user_extra_info_ref;
+  std::shared_ptr<NapiRefReaper> reaper;
+  std::atomic<uint64_t> next_state_id;
+
+  explicit AggregateFunctionInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state)
+    : update_callback(env_state), combine_callback(env_state), finalize_callback(env_state), reaper(env_state), next_state_id(1) {}
+
+  void SetFunctions(Napi::Env env, Napi::Function update, Napi::Function combine, Napi::Function finalize) {
+    update_callback.Set(env, update);
+    combine_callback.Set(env, combine);
+    finalize_callback.Set(env, finalize);
+  }
+
+  void SetDestroyFunction(Napi::Function destroy) {
+    destroy_function_ref = MakeManagedObjectReference(reaper, destroy);
+  }
+
+  void SetUserExtraInfo(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_extra_info) {
+    user_extra_info_ref = user_extra_info.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_extra_info);
+  }
+
+  // Ids are unique per function, and doubles hold integers exactly up to 2^53.
+  double NextStateId() {
+    return static_cast<double>(next_state_id++);
+  }
+};
+
+inline void DeleteAggregateFunctionInternalExtraInfo(AggregateFunctionInternalExtraInfo *internal_extra_info) {
+  delete internal_extra_info;
+}
+
+// External
+
+struct AggregateFunctionHolder {
+  duckdb_aggregate_function aggregate_function;
+  AggregateFunctionInternalExtraInfo *internal_extra_info;
+
+  AggregateFunctionHolder(duckdb_aggregate_function aggregate_function_in): aggregate_function(aggregate_function_in), internal_extra_info(nullptr) {}
+
+  ~AggregateFunctionHolder() {
+    // duckdb_destroy_aggregate_function is a no-op if already destroyed
+    duckdb_destroy_aggregate_function(&aggregate_function);
+  }
+
+  AggregateFunctionInternalExtraInfo *EnsureInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state) {
+    if (!internal_extra_info) {
+      internal_extra_info = new AggregateFunctionInternalExtraInfo(env_state);
+      duckdb_aggregate_function_set_extra_info(aggregate_function, internal_extra_info, reinterpret_cast<duckdb_delete_callback_t>(DeleteAggregateFunctionInternalExtraInfo));
+    }
+    return internal_extra_info;
+  }
+};
+
+inline AggregateFunctionHolder *CreateAggregateFunctionHolder(duckdb_aggregate_function aggregate_function) {
+  return new AggregateFunctionHolder(aggregate_function);
+}
+
+inline void FinalizeAggregateFunctionHolder(Napi::BasicEnv, AggregateFunctionHolder *holder) {
+  delete holder;
+}
+
+inline Napi::External<AggregateFunctionHolder> CreateExternalForAggregateFunction(Napi::Env env, duckdb_aggregate_function aggregate_function) {
+  return CreateExternal<AggregateFunctionHolder>(env, AggregateFunctionTypeTag, CreateAggregateFunctionHolder(aggregate_function), FinalizeAggregateFunctionHolder);
+}
+
+inline AggregateFunctionHolder *GetAggregateFunctionHolderFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<AggregateFunctionHolder>(env, AggregateFunctionTypeTag, value, "Invalid aggregate function argument");
+}
+
+inline duckdb_aggregate_function GetAggregateFunctionFromExternal(Napi::Env env, Napi::Value value) {
+  return GetAggregateFunctionHolderFromExternal(env, value)->aggregate_function;
+}
+
+// Set external
+
+inline void FinalizeAggregateFunctionSet(Napi::BasicEnv, duckdb_aggregate_function_set aggregate_function_set) {
+  duckdb_destroy_aggregate_function_set(&aggregate_function_set);
+}
+
+inline Napi::External<_duckdb_aggregate_function_set> CreateExternalForAggregateFunctionSet(Napi::Env env, duckdb_aggregate_function_set aggregate_function_set) {
+  return CreateExternal<_duckdb_aggregate_function_set>(env, AggregateFunctionSetTypeTag, aggregate_function_set, FinalizeAggregateFunctionSet);
+}
+
+inline duckdb_aggregate_function_set GetAggregateFunctionSetFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_aggregate_function_set>(env, AggregateFunctionSetTypeTag, value, "Invalid aggregate function set argument");
+}
+
+// Entry points handed to DuckDB
+
+inline AggregateFunctionInternalExtraInfo *GetAggregateFunctionInternalExtraInfoFromFunctionInfo(duckdb_function_info function_info) {
+  return reinterpret_cast<AggregateFunctionInternalExtraInfo*>(duckdb_aggregate_function_get_extra_info(function_info));
+}
+
+inline idx_t AggregateFunctionStateSize(duckdb_function_info) {
+  return sizeof(AggregateFunctionState);
+}
+
+inline void AggregateFunctionStateInit(duckdb_function_info info, duckdb_aggregate_state state) {
+  auto internal_extra_info = GetAggregateFunctionInternalExtraInfoFromFunctionInfo(info);
+  auto aggregate_function_state = GetAggregateFunctionState(state);
+  aggregate_function_state->id = internal_extra_info->NextStateId();
+  aggregate_function_state->owner = internal_extra_info;
+}
+
+inline void AggregateFunctionUpdate(duckdb_function_info info, duckdb_data_chunk input, duckdb_aggregate_state *states) {
+  GetAggregateFunctionInternalExtraInfoFromFunctionInfo(info)->update_callback.Invoke({info, input, states});
+}
+
+inline void AggregateFunctionCombine(duckdb_function_info info, duckdb_aggregate_state *source, duckdb_aggregate_state *target, idx_t count) {
+  GetAggregateFunctionInternalExtraInfoFromFunctionInfo(info)->combine_callback.Invoke({info, source, target, count});
+}
+
+inline void AggregateFunctionFinalize(duckdb_function_info info, duckdb_aggregate_state *source, duckdb_vector result, idx_t count, idx_t offset) {
+  GetAggregateFunctionInternalExtraInfoFromFunctionInfo(info)->finalize_callback.Invoke({info, source, result, count, offset});
+}
+
+// Called on whatever thread tears the query down, which can be the JS thread
+// inside a finalizer, where blocking on a thread-safe function would deadlock.
+// So unlike the other callbacks this does not wait: the ids are posted to the JS
+// thread, which forgets the states whenever it next runs. The states' buffers
+// are freed by DuckDB as soon as this returns, which is fine, since JS only
+// needs the ids.
+inline void AggregateFunctionDestroy(duckdb_aggregate_state *states, idx_t count) {
+  if (count == 0) {
+    return;
+  }
+  auto internal_extra_info = GetAggregateFunctionState(states[0])->owner;
+  auto destroy_function_ref = internal_extra_info->destroy_function_ref;
+  if (!destroy_function_ref) {
+    return;
+  }
+  std::vector<double> state_ids(count);
+  for (idx_t i = 0; i < count; i++) {
+    state_ids[i] = GetAggregateFunctionState(states[i])->id;
+  }
+  internal_extra_info->reaper->Post([destroy_function_ref, state_ids](Napi::Env env) {
+    try {
+      auto state_id_array = Napi::Float64Array::New(env, state_ids.size());
+      std::copy(state_ids.begin(), state_ids.end(), state_id_array.Data());
+      destroy_function_ref->ref.Value().As<Napi::Function>().Call(env.Undefined(), { state_id_array });
+    } catch (const Napi::Error &) {
+      // Nothing to report to: the query that owned the states is gone.
+    }
+  });
+}
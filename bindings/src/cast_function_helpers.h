@@ -0,0 +1,157 @@
+#pragma once
+
+#include "externals.h"
+#include "duckdb_thread_callback.h"
+#include "type_tags.h"
+#include "napi_ref_reaper.h"
+#include <memory>
+
+// Cast functions
+//
+// Everything specific to the cast function family lives here, following
+// scalar_function_helpers.h. A cast function is called once per chunk of input
+// with the whole input and output vectors, like a scalar function's main
+// function, and returns whether the cast succeeded.
+
+// Info external
+//
+// duckdb_function_info is reused by every function family; see the note in
+// scalar_function_helpers.h. Cast functions have no bind or init info.
+
+inline Napi::External<_duckdb_function_info> CreateExternalForCastFunctionInfo(Napi::Env env, duckdb_function_info function_info) {
+  return CreateExternalWithoutFinalizer<_duckdb_function_info>(env, CastFunctionInfoTypeTag, function_info);
+}
+
+inline duckdb_function_info GetCastFunctionInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_function_info>(env, CastFunctionInfoTypeTag, value, "Invalid cast function info argument");
+}
+
+// Callbacks
+
+struct CastFunctionMainCallbackTraits {
+  struct Payload {
+    duckdb_function_info info;
+    idx_t count;
+    duckdb_vector input;
+    duckdb_vector output;
+    // Points into the frame of the waiting DuckDB thread, which outlives the call.
+    bool *success;
+  };
+
+  static const char *ResourceName() {
+    return "CastFunctionMain";
+  }
+
+  // The JS function fails the cast by returning false (or a promise of false),
+  // by throwing, or by rejecting. Any other result is success.
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    auto result = callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForCastFunctionInfo(env, payload.info),
+        Napi::Number::New(env, payload.count),
+        CreateExternalForVectorWithoutFinalizer(env, payload.input),
+        CreateExternalForVectorWithoutFinalizer(env, payload.output)
+      }
+    );
+    if (result.IsPromise()) {
+      auto success = payload.success;
+      auto on_fulfilled = Napi::Function::New(env, [success](const Napi::CallbackInfo &info) {
+        RecordResult(info[0], success);
+      });
+      auto promise = result.As<Napi::Object>();
+      return promise.Get("then").As<Napi::Function>().Call(promise, { on_fulfilled });
+    }
+    RecordResult(result, payload.success);
+    return result;
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_cast_function_set_error(payload.info, message);
+    *payload.success = false;
+  }
+
+private:
+
+  static void RecordResult(Napi::Value result, bool *success) {
+    if (result.IsBoolean() && !result.As<Napi::Boolean>().Value()) {
+      *success = false;
+    }
+  }
+};
+
+// Extra info
+
+struct CastFunctionInternalExtraInfo {
+  DuckDBThreadCallback<CastFunctionMainCallbackTraits> main_callback;
+  std::shared_ptr<ManagedObjectReference> user_extra_info_ref;
+
+  explicit CastFunctionInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state)
+    : main_callback(env_state) {}
+
+  void SetMainFunction(Napi::Env env, Napi::Function func) {
+    main_callback.Set(env, func);
+  }
+
+  void SetUserExtraInfo(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_extra_info) {
+    user_extra_info_ref = user_extra_info.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_extra_info);
+  }
+};
+
+inline void DeleteCastFunctionInternalExtraInfo(CastFunctionInternalExtraInfo *internal_extra_info) {
+  delete internal_extra_info;
+}
+
+// External
+
+struct CastFunctionHolder {
+  duckdb_cast_function cast_function;
+  CastFunctionInternalExtraInfo *internal_extra_info;
+
+  CastFunctionHolder(duckdb_cast_function cast_function_in): cast_function(cast_function_in), internal_extra_info(nullptr) {}
+
+  ~CastFunctionHolder() {
+    // duckdb_destroy_cast_function is a no-op if already destroyed
+    duckdb_destroy_cast_function(&cast_function);
+  }
+
+  CastFunctionInternalExtraInfo *EnsureInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state) {
+    if (!internal_extra_info) {
+      internal_extra_info = new CastFunctionInternalExtraInfo(env_state);
+      duckdb_cast_function_set_extra_info(cast_function, internal_extra_info, reinterpret_cast<duckdb_delete_callback_t>(DeleteCastFunctionInternalExtraInfo));
+    }
+    return internal_extra_info;
+  }
+};
+
+inline CastFunctionHolder *CreateCastFunctionHolder(duckdb_cast_function cast_function) {
+  return new CastFunctionHolder(cast_function);
+}
+
+inline void FinalizeCastFunctionHolder(Napi::BasicEnv, CastFunctionHolder *holder) {
+  delete holder;
+}
+
+inline Napi::External<CastFunctionHolder> CreateExternalForCastFunction(Napi::Env env, duckdb_cast_function cast_function) {
+  return CreateExternal<CastFunctionHolder>(env, CastFunctionTypeTag, CreateCastFunctionHolder(cast_function), FinalizeCastFunctionHolder);
+}
+
+inline CastFunctionHolder *GetCastFunctionHolderFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<CastFunctionHolder>(env, CastFunctionTypeTag, value, "Invalid cast function argument");
+}
+
+inline duckdb_cast_function GetCastFunctionFromExternal(Napi::Env env, Napi::Value value) {
+  return GetCastFunctionHolderFromExternal(env, value)->cast_function;
+}
+
+// Entry points handed to DuckDB
+
+inline CastFunctionInternalExtraInfo *GetCastFunctionInternalExtraInfoFromFunctionInfo(duckdb_function_info function_info) {
+  return reinterpret_cast<CastFunctionInternalExtraInfo*>(duckdb_cast_function_get_extra_info(function_info));
+}
+
+inline bool CastFunctionMainFunction(duckdb_function_info info, idx_t count, duckdb_vector input, duckdb_vector output) {
+  bool success = true;
+  GetCastFunctionInternalExtraInfoFromFunctionInfo(info)->main_callback.Invoke({info, count, input, output, &success});
+  return success;
+}
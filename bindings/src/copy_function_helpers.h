@@ -0,0 +1,517 @@
+#pragma once
+
+#include "externals.h"
+#include "duckdb_thread_callback.h"
+#include "type_tags.h"
+#include "napi_ref_reaper.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Copy functions
+//
+// Everything specific to the copy function family lives here, following
+// table_function_helpers.h. A copy function implements a format for
+// COPY ... TO: bind sees the columns and the options, global init the file path,
+// the sink is called with each chunk of the query's result, and finalize once
+// the last chunk has been sunk.
+
+// Info externals
+//
+// Each callback has its own info type in the C API, so unlike the other families
+// there is no handle shared with another family, but each still gets its own tag.
+//
+// None of these is ever created explicitly; all are passed in to callbacks.
+
+inline Napi::External<_duckdb_copy_function_bind_info> CreateExternalForCopyFunctionBindInfo(Napi::Env env, duckdb_copy_function_bind_info bind_info) {
+  return CreateExternalWithoutFinalizer<_duckdb_copy_function_bind_info>(env, CopyFunctionBindInfoTypeTag, bind_info);
+}
+
+inline duckdb_copy_function_bind_info GetCopyFunctionBindInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_copy_function_bind_info>(env, CopyFunctionBindInfoTypeTag, value, "Invalid copy function bind info argument");
+}
+
+inline Napi::External<_duckdb_copy_function_global_init_info> CreateExternalForCopyFunctionGlobalInitInfo(Napi::Env env, duckdb_copy_function_global_init_info global_init_info) {
+  return CreateExternalWithoutFinalizer<_duckdb_copy_function_global_init_info>(env, CopyFunctionGlobalInitInfoTypeTag, global_init_info);
+}
+
+inline duckdb_copy_function_global_init_info GetCopyFunctionGlobalInitInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_copy_function_global_init_info>(env, CopyFunctionGlobalInitInfoTypeTag, value, "Invalid copy function global init info argument");
+}
+
+inline Napi::External<_duckdb_copy_function_sink_info> CreateExternalForCopyFunctionSinkInfo(Napi::Env env, duckdb_copy_function_sink_info sink_info) {
+  return CreateExternalWithoutFinalizer<_duckdb_copy_function_sink_info>(env, CopyFunctionSinkInfoTypeTag, sink_info);
+}
+
+inline duckdb_copy_function_sink_info GetCopyFunctionSinkInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_copy_function_sink_info>(env, CopyFunctionSinkInfoTypeTag, value, "Invalid copy function sink info argument");
+}
+
+inline Napi::External<_duckdb_copy_function_finalize_info> CreateExternalForCopyFunctionFinalizeInfo(Napi::Env env, duckdb_copy_function_finalize_info finalize_info) {
+  return CreateExternalWithoutFinalizer<_duckdb_copy_function_finalize_info>(env, CopyFunctionFinalizeInfoTypeTag, finalize_info);
+}
+
+inline duckdb_copy_function_finalize_info GetCopyFunctionFinalizeInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_copy_function_finalize_info>(env, CopyFunctionFinalizeInfoTypeTag, value, "Invalid copy function finalize info argument");
+}
+
+// Callbacks
+
+struct CopyFunctionBindCallbackTraits {
+  using Payload = duckdb_copy_function_bind_info;
+
+  static const char *ResourceName() {
+    return "CopyFunctionBind";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(env.Undefined(), { CreateExternalForCopyFunctionBindInfo(env, payload) });
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_copy_function_bind_set_error(payload, message);
+  }
+};
+
+struct CopyFunctionGlobalInitCallbackTraits {
+  using Payload = duckdb_copy_function_global_init_info;
+
+  static const char *ResourceName() {
+    return "CopyFunctionGlobalInit";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(env.Undefined(), { CreateExternalForCopyFunctionGlobalInitInfo(env, payload) });
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_copy_function_global_init_set_error(payload, message);
+  }
+};
+
+struct CopyFunctionSinkCallbackTraits {
+  struct Payload {
+    duckdb_copy_function_sink_info info;
+    duckdb_data_chunk input;
+  };
+
+  static const char *ResourceName() {
+    return "CopyFunctionSink";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForCopyFunctionSinkInfo(env, payload.info),
+        CreateExternalForDataChunkWithoutFinalizer(env, payload.input)
+      }
+    );
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_copy_function_sink_set_error(payload.info, message);
+  }
+};
+
+struct CopyFunctionFinalizeCallbackTraits {
+  using Payload = duckdb_copy_function_finalize_info;
+
+  static const char *ResourceName() {
+    return "CopyFunctionFinalize";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(env.Undefined(), { CreateExternalForCopyFunctionFinalizeInfo(env, payload) });
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_copy_function_finalize_set_error(payload, message);
+  }
+};
+
+// Chunk writers
+//
+// A sink callback blocks its DuckDB thread until JS has handled the chunk, so the
+// query produces nothing while JS writes. An async sink lets the query run ahead
+// instead: the native sink copies each chunk and queues it, and JS is handed
+// every chunk queued so far in one call, while the query keeps going. DuckDB only
+// waits once the queue is full, and at finalize, which waits for every write to
+// finish before calling the finalize callback.
+//
+// The sink's input must be copied because DuckDB reuses its buffers for the next
+// chunk as soon as the sink returns. The copies are owned by JS once handed over.
+//
+// One writer serves one execution of COPY, and lives in its global state. Calls
+// are posted through the reaper, which needs no thread-safe function of its own;
+// the query's async worker holds the event loop open while writes are pending,
+// since finalize waits for them. The first failed write fails the query: later
+// sinks and finalize report its error, and chunks still queued are dropped.
+
+class CopyFunctionChunkWriter : public std::enable_shared_from_this<CopyFunctionChunkWriter> {
+
+public:
+
+  CopyFunctionChunkWriter(std::shared_ptr<NapiRefReaper> reaper_in, std::shared_ptr<ManagedObjectReference> write_ref_in,
+                          std::shared_ptr<ManagedObjectReference> global_state_ref_in, size_t capacity_in)
+    : reaper(std::move(reaper_in)), write_ref(std::move(write_ref_in)), global_state_ref(std::move(global_state_ref_in)),
+      capacity(capacity_in > 0 ? capacity_in : 1), writing(false), has_error(false) {}
+
+  ~CopyFunctionChunkWriter() {
+    for (auto chunk : pending) {
+      duckdb_destroy_data_chunk(&chunk);
+    }
+  }
+
+  CopyFunctionChunkWriter(const CopyFunctionChunkWriter &) = delete;
+  CopyFunctionChunkWriter &operator=(const CopyFunctionChunkWriter &) = delete;
+
+  // Called on a DuckDB thread. Queues a copy of `input`, first waiting for room
+  // if the queue is full. Returns false, setting `error`, if a write has failed.
+  bool Write(duckdb_data_chunk input, std::string &error) {
+    auto chunk = CopyChunk(input);
+    std::vector<duckdb_data_chunk> batch;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [this]() { return pending.size() + in_flight < capacity || has_error; });
+      if (has_error) {
+        duckdb_destroy_data_chunk(&chunk);
+        error = error_message;
+        return false;
+      }
+      pending.push_back(chunk);
+      if (!writing) {
+        batch = TakeBatch();
+      }
+    }
+    Post(std::move(batch));
+    return true;
+  }
+
+  // Called on a DuckDB thread. Waits until every queued chunk has been written.
+  // Returns false, setting `error`, if a write has failed.
+  bool Flush(std::string &error) {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() { return !writing || has_error; });
+    if (has_error) {
+      error = error_message;
+      return false;
+    }
+    return true;
+  }
+
+private:
+
+  // Owns the chunks of one write until they are handed to JS. If the env is
+  // going away, the reaper drops the work without running it, and the write
+  // fails instead, so that no DuckDB thread waits on it for good.
+  struct Batch {
+    std::shared_ptr<CopyFunctionChunkWriter> writer;
+    std::vector<duckdb_data_chunk> chunks;
+    bool handed_off = false;
+
+    Batch(std::shared_ptr<CopyFunctionChunkWriter> writer_in, std::vector<duckdb_data_chunk> chunks_in)
+      : writer(std::move(writer_in)), chunks(std::move(chunks_in)) {}
+
+    Batch(Batch &&other) noexcept
+      : writer(std::move(other.writer)), chunks(std::move(other.chunks)), handed_off(other.handed_off) {
+      other.handed_off = true;
+    }
+
+    ~Batch() {
+      for (auto chunk : chunks) {
+        duckdb_destroy_data_chunk(&chunk);
+      }
+      if (!handed_off && writer) {
+        writer->Complete("Copy function writer was shut down");
+      }
+    }
+
+    // Called on the JS thread.
+    void operator()(Napi::Env env) {
+      handed_off = true;
+      writer->Run(env, std::move(chunks));
+    }
+  };
+
+  // Called with the mutex held. Takes every queued chunk for the next write.
+  std::vector<duckdb_data_chunk> TakeBatch() {
+    writing = true;
+    in_flight = pending.size();
+    std::vector<duckdb_data_chunk> chunks(pending.begin(), pending.end());
+    pending.clear();
+    return chunks;
+  }
+
+  // Called without the mutex held: if the reaper drops the batch, destroying it
+  // completes the write, which takes the mutex.
+  void Post(std::vector<duckdb_data_chunk> chunks) {
+    if (!chunks.empty()) {
+      reaper->Post(Batch(shared_from_this(), std::move(chunks)));
+    }
+  }
+
+  // Called on the JS thread.
+  void Run(Napi::Env env, std::vector<duckdb_data_chunk> chunks) {
+    Napi::HandleScope scope(env);
+    auto chunk_array = Napi::Array::New(env, chunks.size());
+    for (size_t i = 0; i < chunks.size(); i++) {
+      chunk_array.Set(i, CreateExternalForDataChunk(env, chunks[i]));
+    }
+    auto global_state = global_state_ref ? Napi::Value(global_state_ref->ref.Value()) : env.Undefined();
+    try {
+      auto result = write_ref->ref.Value().As<Napi::Function>().Call(env.Undefined(), { chunk_array, global_state });
+      if (result.IsPromise()) {
+        auto self = shared_from_this();
+        auto on_fulfilled = Napi::Function::New(env, [self](const Napi::CallbackInfo &) {
+          self->Complete("");
+        });
+        auto on_rejected = Napi::Function::New(env, [self](const Napi::CallbackInfo &info) {
+          self->Complete(DuckDBThreadCallbackRejectionMessage(info[0]));
+        });
+        auto promise = result.As<Napi::Object>();
+        promise.Get("then").As<Napi::Function>().Call(promise, { on_fulfilled, on_rejected });
+        return;
+      }
+      Complete("");
+    } catch (const Napi::Error &error) {
+      Complete(error.Message());
+    }
+  }
+
+  // Called on the JS thread, or wherever a dropped batch is destroyed. An empty
+  // message is success.
+  void Complete(const std::string &message) {
+    std::vector<duckdb_data_chunk> batch;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      writing = false;
+      in_flight = 0;
+      if (!message.empty() && !has_error) {
+        has_error = true;
+        error_message = message;
+      }
+      if (has_error) {
+        for (auto chunk : pending) {
+          duckdb_destroy_data_chunk(&chunk);
+        }
+        pending.clear();
+      } else if (!pending.empty()) {
+        batch = TakeBatch();
+      }
+      cv.notify_all();
+    }
+    Post(std::move(batch));
+  }
+
+  static duckdb_data_chunk CopyChunk(duckdb_data_chunk input) {
+    auto column_count = duckdb_data_chunk_get_column_count(input);
+    auto row_count = duckdb_data_chunk_get_size(input);
+    std::vector<duckdb_logical_type> types(column_count);
+    for (idx_t column_index = 0; column_index < column_count; column_index++) {
+      types[column_index] = duckdb_vector_get_column_type(duckdb_data_chunk_get_vector(input, column_index));
+    }
+    auto chunk = duckdb_create_data_chunk(types.data(), column_count);
+    for (auto &type : types) {
+      duckdb_destroy_logical_type(&type);
+    }
+    // An identity selection copies rows in order, resolving dictionary and
+    // constant vectors into flat ones the chunk owns.
+    auto sel = duckdb_create_selection_vector(row_count);
+    auto sel_data = duckdb_selection_vector_get_data_ptr(sel);
+    for (idx_t row = 0; row < row_count; row++) {
+      sel_data[row] = static_cast<sel_t>(row);
+    }
+    for (idx_t column_index = 0; column_index < column_count; column_index++) {
+      duckdb_vector_copy_sel(duckdb_data_chunk_get_vector(input, column_index), duckdb_data_chunk_get_vector(chunk, column_index), sel, row_count, 0, 0);
+    }
+    duckdb_destroy_selection_vector(sel);
+    duckdb_data_chunk_set_size(chunk, row_count);
+    return chunk;
+  }
+
+  std::shared_ptr<NapiRefReaper> reaper;
+  std::shared_ptr<ManagedObjectReference> write_ref;
+  std::shared_ptr<ManagedObjectReference> global_state_ref;
+  size_t capacity;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<duckdb_data_chunk> pending;
+  size_t in_flight = 0;
+  bool writing;
+  bool has_error;
+  std::string error_message;
+
+};
+
+// Extra info
+
+struct CopyFunctionInternalExtraInfo {
+  DuckDBThreadCallback<CopyFunctionBindCallbackTraits> bind_callback;
+  DuckDBThreadCallback<CopyFunctionGlobalInitCallbackTraits> global_init_callback;
+  DuckDBThreadCallback<CopyFunctionSinkCallbackTraits> sink_callback;
+  DuckDBThreadCallback<CopyFunctionFinalizeCallbackTraits> finalize_callback;
+  std::shared_ptr<NapiRefReaper> reaper;
+  std::shared_ptr<ManagedObjectReference> async_sink_ref;
+  size_t async_sink_capacity = 0;
+  std::shared_ptr<ManagedObjectReference> user_extra_info_ref;
+
+  explicit CopyFunctionInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state)
+    : bind_callback(env_state), global_init_callback(env_state), sink_callback(env_state), finalize_callback(env_state),
+      reaper(env_state) {}
+
+  void SetBindFunction(Napi::Env env, Napi::Function func) {
+    bind_callback.Set(env, func);
+  }
+
+  void SetGlobalInitFunction(Napi::Env env, Napi::Function func) {
+    global_init_callback.Set(env, func);
+  }
+
+  void SetSinkFunction(Napi::Env env, Napi::Function func) {
+    sink_callback.Set(env, func);
+  }
+
+  void SetFinalizeFunction(Napi::Env env, Napi::Function func) {
+    finalize_callback.Set(env, func);
+  }
+
+  void SetAsyncSinkFunction(Napi::Function func, size_t capacity) {
+    async_sink_ref = MakeManagedObjectReference(reaper, func);
+    async_sink_capacity = capacity;
+  }
+
+  void SetUserExtraInfo(Napi::Object user_extra_info) {
+    user_extra_info_ref = user_extra_info.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_extra_info);
+  }
+};
+
+inline void DeleteCopyFunctionInternalExtraInfo(CopyFunctionInternalExtraInfo *internal_extra_info) {
+  delete internal_extra_info;
+}
+
+// External
+
+struct CopyFunctionHolder {
+  duckdb_copy_function copy_function;
+  CopyFunctionInternalExtraInfo *internal_extra_info;
+
+  CopyFunctionHolder(duckdb_copy_function copy_function_in): copy_function(copy_function_in), internal_extra_info(nullptr) {}
+
+  ~CopyFunctionHolder() {
+    // duckdb_destroy_copy_function is a no-op if already destroyed
+    duckdb_destroy_copy_function(&copy_function);
+  }
+
+  CopyFunctionInternalExtraInfo *EnsureInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state) {
+    if (!internal_extra_info) {
+      internal_extra_info = new CopyFunctionInternalExtraInfo(env_state);
+      duckdb_copy_function_set_extra_info(copy_function, internal_extra_info, reinterpret_cast<duckdb_delete_callback_t>(DeleteCopyFunctionInternalExtraInfo));
+    }
+    return internal_extra_info;
+  }
+};
+
+inline CopyFunctionHolder *CreateCopyFunctionHolder(duckdb_copy_function copy_function) {
+  return new CopyFunctionHolder(copy_function);
+}
+
+inline void FinalizeCopyFunctionHolder(Napi::BasicEnv, CopyFunctionHolder *holder) {
+  delete holder;
+}
+
+inline Napi::External<CopyFunctionHolder> CreateExternalForCopyFunction(Napi::Env env, duckdb_copy_function copy_function) {
+  return CreateExternal<CopyFunctionHolder>(env, CopyFunctionTypeTag, CreateCopyFunctionHolder(copy_function), FinalizeCopyFunctionHolder);
+}
+
+inline CopyFunctionHolder *GetCopyFunctionHolderFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<CopyFunctionHolder>(env, CopyFunctionTypeTag, value, "Invalid copy function argument");
+}
+
+inline duckdb_copy_function GetCopyFunctionFromExternal(Napi::Env env, Napi::Value value) {
+  return GetCopyFunctionHolderFromExternal(env, value)->copy_function;
+}
+
+// Bind data and global state
+//
+// Both hold a user object through the reaper, as for table functions. The global
+// state also holds the chunk writer of an async sink, created with the state, so
+// sinks running on several threads only ever read it. The native global init
+// always sets a global state before calling the JS one, which may replace it
+// with one holding a user object, so the sink always finds a writer.
+
+struct CopyFunctionInternalBindData {
+  std::shared_ptr<ManagedObjectReference> user_bind_data_ref;
+
+  void SetUserBindData(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_bind_data) {
+    user_bind_data_ref = user_bind_data.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_bind_data);
+  }
+};
+
+inline void DeleteCopyFunctionInternalBindData(CopyFunctionInternalBindData *internal_bind_data) {
+  delete internal_bind_data;
+}
+
+struct CopyFunctionInternalGlobalState {
+  std::shared_ptr<ManagedObjectReference> user_global_state_ref;
+  std::shared_ptr<CopyFunctionChunkWriter> writer;
+
+  CopyFunctionInternalGlobalState(CopyFunctionInternalExtraInfo *internal_extra_info,
+                                  std::shared_ptr<ManagedObjectReference> user_global_state_ref_in)
+    : user_global_state_ref(std::move(user_global_state_ref_in)) {
+    if (internal_extra_info->async_sink_ref) {
+      writer = std::make_shared<CopyFunctionChunkWriter>(
+        internal_extra_info->reaper,
+        internal_extra_info->async_sink_ref,
+        user_global_state_ref,
+        internal_extra_info->async_sink_capacity
+      );
+    }
+  }
+};
+
+inline void DeleteCopyFunctionInternalGlobalState(CopyFunctionInternalGlobalState *internal_global_state) {
+  delete internal_global_state;
+}
+
+// Entry points handed to DuckDB
+
+inline void CopyFunctionBindFunction(duckdb_copy_function_bind_info info) {
+  auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_bind_get_extra_info(info));
+  internal_extra_info->bind_callback.Invoke(info);
+}
+
+inline void CopyFunctionGlobalInitFunction(duckdb_copy_function_global_init_info info) {
+  auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_global_init_get_extra_info(info));
+  duckdb_copy_function_global_init_set_global_state(info, new CopyFunctionInternalGlobalState(internal_extra_info, nullptr), reinterpret_cast<duckdb_delete_callback_t>(DeleteCopyFunctionInternalGlobalState));
+  internal_extra_info->global_init_callback.Invoke(info);
+}
+
+inline void CopyFunctionSinkFunction(duckdb_copy_function_sink_info info, duckdb_data_chunk input) {
+  auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_sink_get_extra_info(info));
+  internal_extra_info->sink_callback.Invoke({info, input});
+}
+
+inline void CopyFunctionAsyncSinkFunction(duckdb_copy_function_sink_info info, duckdb_data_chunk input) {
+  auto internal_global_state = reinterpret_cast<CopyFunctionInternalGlobalState*>(duckdb_copy_function_sink_get_global_state(info));
+  std::string error;
+  if (!internal_global_state->writer->Write(input, error)) {
+    duckdb_copy_function_sink_set_error(info, error.c_str());
+  }
+}
+
+inline void CopyFunctionFinalizeFunction(duckdb_copy_function_finalize_info info) {
+  auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_finalize_get_extra_info(info));
+  auto internal_global_state = reinterpret_cast<CopyFunctionInternalGlobalState*>(duckdb_copy_function_finalize_get_global_state(info));
+  if (internal_global_state && internal_global_state->writer) {
+    std::string error;
+    if (!internal_global_state->writer->Flush(error)) {
+      duckdb_copy_function_finalize_set_error(info, error.c_str());
+      return;
+    }
+  }
+  internal_extra_info->finalize_callback.Invoke(info);
+}
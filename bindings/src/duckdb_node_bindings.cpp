@@ -10,10 +10,15 @@
 
 #include "duckdb.h"
 
+#include "aggregate_function_helpers.h"
 #include "bindings_config.h"
+#include "cast_function_helpers.h"
 #include "conversion_helpers.h"
+#include "copy_function_helpers.h"
 #include "externals.h"
 #include "napi_ref_reaper.h"
+#include "native_library_helpers.h"
+#include "replacement_scan_helpers.h"
 #include "scalar_function_helpers.h"
 #include "table_function_helpers.h"
 #include "promise_workers.h"
@@ -29,6 +34,9 @@ public:
     DefineAddon(exports, {
       InstanceValue("sizeof_bool", Napi::Number::New(env, sizeof(bool))),
 
+      InstanceValue("CastMode", CreateCastModeEnum(env)),
+      InstanceValue("ErrorType", CreateErrorTypeEnum(env)),
+      InstanceValue("FileFlag", CreateFileFlagEnum(env)),
       InstanceValue("PendingState", CreatePendingStateEnum(env)),
       InstanceValue("ResultType", CreateResultTypeEnum(env)),
       InstanceValue("StatementType", CreateStatementTypeEnum(env)),
@@ -56,6 +64,11 @@ public:
       InstanceMethod("get_config_flag", &DuckDBNodeAddon::get_config_flag),
       InstanceMethod("set_config", &DuckDBNodeAddon::set_config),
 
+      InstanceMethod("create_error_data", &DuckDBNodeAddon::create_error_data),
+      InstanceMethod("error_data_error_type", &DuckDBNodeAddon::error_data_error_type),
+      InstanceMethod("error_data_message", &DuckDBNodeAddon::error_data_message),
+      InstanceMethod("error_data_has_error", &DuckDBNodeAddon::error_data_has_error),
+
       InstanceMethod("query", &DuckDBNodeAddon::query),
       InstanceMethod("column_name", &DuckDBNodeAddon::column_name),
       InstanceMethod("column_type", &DuckDBNodeAddon::column_type),
@@ -262,6 +275,7 @@ public:
       InstanceMethod("vector_ensure_validity_writable", &DuckDBNodeAddon::vector_ensure_validity_writable),
       InstanceMethod("vector_assign_string_element", &DuckDBNodeAddon::vector_assign_string_element),
       InstanceMethod("vector_assign_string_element_len", &DuckDBNodeAddon::vector_assign_string_element_len),
+      InstanceMethod("unsafe_vector_assign_string_element_len", &DuckDBNodeAddon::unsafe_vector_assign_string_element_len),
       InstanceMethod("list_vector_get_child", &DuckDBNodeAddon::list_vector_get_child),
       InstanceMethod("list_vector_get_size", &DuckDBNodeAddon::list_vector_get_size),
       InstanceMethod("list_vector_set_size", &DuckDBNodeAddon::list_vector_set_size),
@@ -292,6 +306,34 @@ public:
       InstanceMethod("scalar_function_get_bind_data", &DuckDBNodeAddon::scalar_function_get_bind_data),
       InstanceMethod("scalar_function_get_client_context", &DuckDBNodeAddon::scalar_function_get_client_context),
       InstanceMethod("scalar_function_set_error", &DuckDBNodeAddon::scalar_function_set_error),
+      InstanceMethod("create_scalar_function_set", &DuckDBNodeAddon::create_scalar_function_set),
+      InstanceMethod("add_scalar_function_to_set", &DuckDBNodeAddon::add_scalar_function_to_set),
+      InstanceMethod("register_scalar_function_set", &DuckDBNodeAddon::register_scalar_function_set),
+      InstanceMethod("scalar_function_get_state", &DuckDBNodeAddon::scalar_function_get_state),
+      InstanceMethod("scalar_function_set_init", &DuckDBNodeAddon::scalar_function_set_init),
+      InstanceMethod("scalar_function_init_set_error", &DuckDBNodeAddon::scalar_function_init_set_error),
+      InstanceMethod("scalar_function_init_set_state", &DuckDBNodeAddon::scalar_function_init_set_state),
+      InstanceMethod("scalar_function_init_get_client_context", &DuckDBNodeAddon::scalar_function_init_get_client_context),
+      InstanceMethod("scalar_function_init_get_bind_data", &DuckDBNodeAddon::scalar_function_init_get_bind_data),
+      InstanceMethod("scalar_function_init_get_extra_info", &DuckDBNodeAddon::scalar_function_init_get_extra_info),
+      InstanceMethod("scalar_function_bind_get_argument_count", &DuckDBNodeAddon::scalar_function_bind_get_argument_count),
+      InstanceMethod("scalar_function_bind_get_argument", &DuckDBNodeAddon::scalar_function_bind_get_argument),
+
+      InstanceMethod("create_aggregate_function", &DuckDBNodeAddon::create_aggregate_function),
+      InstanceMethod("destroy_aggregate_function_sync", &DuckDBNodeAddon::destroy_aggregate_function_sync),
+      InstanceMethod("aggregate_function_set_name", &DuckDBNodeAddon::aggregate_function_set_name),
+      InstanceMethod("aggregate_function_add_parameter", &DuckDBNodeAddon::aggregate_function_add_parameter),
+      InstanceMethod("aggregate_function_set_return_type", &DuckDBNodeAddon::aggregate_function_set_return_type),
+      InstanceMethod("aggregate_function_set_functions", &DuckDBNodeAddon::aggregate_function_set_functions),
+      InstanceMethod("aggregate_function_set_destructor", &DuckDBNodeAddon::aggregate_function_set_destructor),
+      InstanceMethod("register_aggregate_function", &DuckDBNodeAddon::register_aggregate_function),
+      InstanceMethod("aggregate_function_set_special_handling", &DuckDBNodeAddon::aggregate_function_set_special_handling),
+      InstanceMethod("aggregate_function_set_extra_info", &DuckDBNodeAddon::aggregate_function_set_extra_info),
+      InstanceMethod("aggregate_function_get_extra_info", &DuckDBNodeAddon::aggregate_function_get_extra_info),
+      InstanceMethod("aggregate_function_set_error", &DuckDBNodeAddon::aggregate_function_set_error),
+      InstanceMethod("create_aggregate_function_set", &DuckDBNodeAddon::create_aggregate_function_set),
+      InstanceMethod("add_aggregate_function_to_set", &DuckDBNodeAddon::add_aggregate_function_to_set),
+      InstanceMethod("register_aggregate_function_set", &DuckDBNodeAddon::register_aggregate_function_set),
 
       InstanceMethod("create_table_function", &DuckDBNodeAddon::create_table_function),
       InstanceMethod("destroy_table_function_sync", &DuckDBNodeAddon::destroy_table_function_sync),
@@ -327,14 +369,24 @@ public:
       InstanceMethod("function_get_local_init_data", &DuckDBNodeAddon::function_get_local_init_data),
       InstanceMethod("function_set_error", &DuckDBNodeAddon::function_set_error),
 
+      InstanceMethod("add_replacement_scan", &DuckDBNodeAddon::add_replacement_scan),
+      InstanceMethod("replacement_scan_set_function_name", &DuckDBNodeAddon::replacement_scan_set_function_name),
+      InstanceMethod("replacement_scan_add_parameter", &DuckDBNodeAddon::replacement_scan_add_parameter),
+      InstanceMethod("replacement_scan_set_error", &DuckDBNodeAddon::replacement_scan_set_error),
+
       InstanceMethod("appender_create", &DuckDBNodeAddon::appender_create),
       InstanceMethod("appender_create_ext", &DuckDBNodeAddon::appender_create_ext),
       InstanceMethod("appender_column_count", &DuckDBNodeAddon::appender_column_count),
       InstanceMethod("appender_column_type", &DuckDBNodeAddon::appender_column_type),
+      InstanceMethod("appender_error_data", &DuckDBNodeAddon::appender_error_data),
       InstanceMethod("appender_flush_sync", &DuckDBNodeAddon::appender_flush_sync),
+      InstanceMethod("appender_clear", &DuckDBNodeAddon::appender_clear),
       InstanceMethod("appender_close_sync", &DuckDBNodeAddon::appender_close_sync),
+      InstanceMethod("appender_add_column", &DuckDBNodeAddon::appender_add_column),
+      InstanceMethod("appender_clear_columns", &DuckDBNodeAddon::appender_clear_columns),
       InstanceMethod("appender_end_row", &DuckDBNodeAddon::appender_end_row),
       InstanceMethod("append_default", &DuckDBNodeAddon::append_default),
+      InstanceMethod("append_default_to_chunk", &DuckDBNodeAddon::append_default_to_chunk),
       InstanceMethod("append_bool", &DuckDBNodeAddon::append_bool),
       InstanceMethod("append_int8", &DuckDBNodeAddon::append_int8),
       InstanceMethod("append_int16", &DuckDBNodeAddon::append_int16),
@@ -360,11 +412,113 @@ public:
 
       InstanceMethod("fetch_chunk", &DuckDBNodeAddon::fetch_chunk),
 
+      InstanceMethod("create_cast_function", &DuckDBNodeAddon::create_cast_function),
+      InstanceMethod("cast_function_set_source_type", &DuckDBNodeAddon::cast_function_set_source_type),
+      InstanceMethod("cast_function_set_target_type", &DuckDBNodeAddon::cast_function_set_target_type),
+      InstanceMethod("cast_function_set_implicit_cast_cost", &DuckDBNodeAddon::cast_function_set_implicit_cast_cost),
+      InstanceMethod("cast_function_set_function", &DuckDBNodeAddon::cast_function_set_function),
+      InstanceMethod("cast_function_set_extra_info", &DuckDBNodeAddon::cast_function_set_extra_info),
+      InstanceMethod("cast_function_get_extra_info", &DuckDBNodeAddon::cast_function_get_extra_info),
+      InstanceMethod("cast_function_get_cast_mode", &DuckDBNodeAddon::cast_function_get_cast_mode),
+      InstanceMethod("cast_function_set_error", &DuckDBNodeAddon::cast_function_set_error),
+      InstanceMethod("cast_function_set_row_error", &DuckDBNodeAddon::cast_function_set_row_error),
+      InstanceMethod("register_cast_function", &DuckDBNodeAddon::register_cast_function),
+      InstanceMethod("destroy_cast_function_sync", &DuckDBNodeAddon::destroy_cast_function_sync),
+
+      InstanceMethod("expression_return_type", &DuckDBNodeAddon::expression_return_type),
+      InstanceMethod("expression_is_foldable", &DuckDBNodeAddon::expression_is_foldable),
+      InstanceMethod("expression_fold", &DuckDBNodeAddon::expression_fold),
+
+      InstanceMethod("client_context_get_file_system", &DuckDBNodeAddon::client_context_get_file_system),
+      InstanceMethod("file_system_error_data", &DuckDBNodeAddon::file_system_error_data),
+      InstanceMethod("file_system_open_sync", &DuckDBNodeAddon::file_system_open_sync),
+      InstanceMethod("create_file_open_options", &DuckDBNodeAddon::create_file_open_options),
+      InstanceMethod("file_open_options_set_flag", &DuckDBNodeAddon::file_open_options_set_flag),
+      InstanceMethod("file_handle_error_data", &DuckDBNodeAddon::file_handle_error_data),
+      InstanceMethod("file_handle_read_sync", &DuckDBNodeAddon::file_handle_read_sync),
+      InstanceMethod("file_handle_write_sync", &DuckDBNodeAddon::file_handle_write_sync),
+      InstanceMethod("file_handle_tell", &DuckDBNodeAddon::file_handle_tell),
+      InstanceMethod("file_handle_size", &DuckDBNodeAddon::file_handle_size),
+      InstanceMethod("file_handle_seek", &DuckDBNodeAddon::file_handle_seek),
+      InstanceMethod("file_handle_sync", &DuckDBNodeAddon::file_handle_sync),
+      InstanceMethod("file_handle_close_sync", &DuckDBNodeAddon::file_handle_close_sync),
+
+      InstanceMethod("create_copy_function", &DuckDBNodeAddon::create_copy_function),
+      InstanceMethod("copy_function_set_name", &DuckDBNodeAddon::copy_function_set_name),
+      InstanceMethod("copy_function_set_extra_info", &DuckDBNodeAddon::copy_function_set_extra_info),
+      InstanceMethod("register_copy_function", &DuckDBNodeAddon::register_copy_function),
+      InstanceMethod("destroy_copy_function_sync", &DuckDBNodeAddon::destroy_copy_function_sync),
+      InstanceMethod("copy_function_set_bind", &DuckDBNodeAddon::copy_function_set_bind),
+      InstanceMethod("copy_function_bind_set_error", &DuckDBNodeAddon::copy_function_bind_set_error),
+      InstanceMethod("copy_function_bind_get_extra_info", &DuckDBNodeAddon::copy_function_bind_get_extra_info),
+      InstanceMethod("copy_function_bind_get_client_context", &DuckDBNodeAddon::copy_function_bind_get_client_context),
+      InstanceMethod("copy_function_bind_get_column_count", &DuckDBNodeAddon::copy_function_bind_get_column_count),
+      InstanceMethod("copy_function_bind_get_column_type", &DuckDBNodeAddon::copy_function_bind_get_column_type),
+      InstanceMethod("copy_function_bind_get_options", &DuckDBNodeAddon::copy_function_bind_get_options),
+      InstanceMethod("copy_function_bind_set_bind_data", &DuckDBNodeAddon::copy_function_bind_set_bind_data),
+      InstanceMethod("copy_function_set_global_init", &DuckDBNodeAddon::copy_function_set_global_init),
+      InstanceMethod("copy_function_global_init_set_error", &DuckDBNodeAddon::copy_function_global_init_set_error),
+      InstanceMethod("copy_function_global_init_get_extra_info", &DuckDBNodeAddon::copy_function_global_init_get_extra_info),
+      InstanceMethod("copy_function_global_init_get_client_context", &DuckDBNodeAddon::copy_function_global_init_get_client_context),
+      InstanceMethod("copy_function_global_init_get_bind_data", &DuckDBNodeAddon::copy_function_global_init_get_bind_data),
+      InstanceMethod("copy_function_global_init_get_file_path", &DuckDBNodeAddon::copy_function_global_init_get_file_path),
+      InstanceMethod("copy_function_global_init_set_global_state", &DuckDBNodeAddon::copy_function_global_init_set_global_state),
+      InstanceMethod("copy_function_set_sink", &DuckDBNodeAddon::copy_function_set_sink),
+      InstanceMethod("copy_function_sink_set_error", &DuckDBNodeAddon::copy_function_sink_set_error),
+      InstanceMethod("copy_function_sink_get_extra_info", &DuckDBNodeAddon::copy_function_sink_get_extra_info),
+      InstanceMethod("copy_function_sink_get_client_context", &DuckDBNodeAddon::copy_function_sink_get_client_context),
+      InstanceMethod("copy_function_sink_get_bind_data", &DuckDBNodeAddon::copy_function_sink_get_bind_data),
+      InstanceMethod("copy_function_sink_get_global_state", &DuckDBNodeAddon::copy_function_sink_get_global_state),
+      InstanceMethod("copy_function_set_finalize", &DuckDBNodeAddon::copy_function_set_finalize),
+      InstanceMethod("copy_function_finalize_set_error", &DuckDBNodeAddon::copy_function_finalize_set_error),
+      InstanceMethod("copy_function_finalize_get_extra_info", &DuckDBNodeAddon::copy_function_finalize_get_extra_info),
+      InstanceMethod("copy_function_finalize_get_client_context", &DuckDBNodeAddon::copy_function_finalize_get_client_context),
+      InstanceMethod("copy_function_finalize_get_bind_data", &DuckDBNodeAddon::copy_function_finalize_get_bind_data),
+      InstanceMethod("copy_function_finalize_get_global_state", &DuckDBNodeAddon::copy_function_finalize_get_global_state),
+      InstanceMethod("copy_function_set_copy_from_function", &DuckDBNodeAddon::copy_function_set_copy_from_function),
+      InstanceMethod("table_function_bind_get_result_column_count", &DuckDBNodeAddon::table_function_bind_get_result_column_count),
+      InstanceMethod("table_function_bind_get_result_column_name", &DuckDBNodeAddon::table_function_bind_get_result_column_name),
+      InstanceMethod("table_function_bind_get_result_column_type", &DuckDBNodeAddon::table_function_bind_get_result_column_type),
+
       InstanceMethod("geometry_type_get_crs", &DuckDBNodeAddon::geometry_type_get_crs),
 
       InstanceMethod("get_data_from_pointer", &DuckDBNodeAddon::get_data_from_pointer),
       InstanceMethod("copy_data_to_vector", &DuckDBNodeAddon::copy_data_to_vector),
       InstanceMethod("copy_data_to_vector_validity", &DuckDBNodeAddon::copy_data_to_vector_validity),
+      InstanceMethod("vector_set_null_mask", &DuckDBNodeAddon::vector_set_null_mask),
+      InstanceMethod("vector_assign_strings", &DuckDBNodeAddon::vector_assign_strings),
+      InstanceMethod("unsafe_vector_assign_strings", &DuckDBNodeAddon::unsafe_vector_assign_strings),
+      InstanceMethod("create_scalar_function_worker_pool", &DuckDBNodeAddon::create_scalar_function_worker_pool),
+      InstanceMethod("scalar_function_worker_pool_get_id", &DuckDBNodeAddon::scalar_function_worker_pool_get_id),
+      InstanceMethod("scalar_function_worker_pool_attach", &DuckDBNodeAddon::scalar_function_worker_pool_attach),
+      InstanceMethod("scalar_function_worker_pool_detach", &DuckDBNodeAddon::scalar_function_worker_pool_detach),
+      InstanceMethod("scalar_function_set_worker_pool", &DuckDBNodeAddon::scalar_function_set_worker_pool),
+      InstanceMethod("load_native_library", &DuckDBNodeAddon::load_native_library),
+      InstanceMethod("scalar_function_set_native_bind", &DuckDBNodeAddon::scalar_function_set_native_bind),
+      InstanceMethod("scalar_function_set_native_function", &DuckDBNodeAddon::scalar_function_set_native_function),
+      InstanceMethod("table_function_set_native_bind", &DuckDBNodeAddon::table_function_set_native_bind),
+      InstanceMethod("table_function_set_native_init", &DuckDBNodeAddon::table_function_set_native_init),
+      InstanceMethod("table_function_set_native_local_init", &DuckDBNodeAddon::table_function_set_native_local_init),
+      InstanceMethod("table_function_set_native_function", &DuckDBNodeAddon::table_function_set_native_function),
+      InstanceMethod("cast_function_set_native_function", &DuckDBNodeAddon::cast_function_set_native_function),
+      InstanceMethod("scalar_function_set_deduplicate_inputs", &DuckDBNodeAddon::scalar_function_set_deduplicate_inputs),
+      InstanceMethod("create_table_function_chunk_queue", &DuckDBNodeAddon::create_table_function_chunk_queue),
+      InstanceMethod("table_function_chunk_queue_push", &DuckDBNodeAddon::table_function_chunk_queue_push),
+      InstanceMethod("table_function_chunk_queue_close", &DuckDBNodeAddon::table_function_chunk_queue_close),
+      InstanceMethod("init_set_chunk_queue", &DuckDBNodeAddon::init_set_chunk_queue),
+      InstanceMethod("table_function_set_chunk_queue_function", &DuckDBNodeAddon::table_function_set_chunk_queue_function),
+      InstanceMethod("create_table_function_worker_pool", &DuckDBNodeAddon::create_table_function_worker_pool),
+      InstanceMethod("table_function_worker_pool_get_id", &DuckDBNodeAddon::table_function_worker_pool_get_id),
+      InstanceMethod("table_function_worker_pool_attach", &DuckDBNodeAddon::table_function_worker_pool_attach),
+      InstanceMethod("table_function_worker_pool_detach", &DuckDBNodeAddon::table_function_worker_pool_detach),
+      InstanceMethod("table_function_set_worker_pool", &DuckDBNodeAddon::table_function_set_worker_pool),
+      InstanceMethod("init_set_worker_scan_data", &DuckDBNodeAddon::init_set_worker_scan_data),
+      InstanceMethod("table_function_worker_scan_get_data", &DuckDBNodeAddon::table_function_worker_scan_get_data),
+      InstanceMethod("table_function_worker_scan_next_partition", &DuckDBNodeAddon::table_function_worker_scan_next_partition),
+      InstanceMethod("table_function_worker_scan_get_state", &DuckDBNodeAddon::table_function_worker_scan_get_state),
+      InstanceMethod("table_function_worker_scan_set_state", &DuckDBNodeAddon::table_function_worker_scan_set_state),
+      InstanceMethod("table_function_set_typed_array_columns", &DuckDBNodeAddon::table_function_set_typed_array_columns),
+      InstanceMethod("copy_function_set_async_sink", &DuckDBNodeAddon::copy_function_set_async_sink),
     });
   }
 
@@ -583,19 +737,44 @@ private:
   // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_error_data duckdb_create_error_data(duckdb_error_type type, const char *message);
-  // TODO error data
+  // function create_error_data(error_type: ErrorType, message: string): ErrorData
+  Napi::Value create_error_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto error_type = static_cast<duckdb_error_type>(info[0].As<Napi::Number>().Uint32Value());
+    std::string message = info[1].As<Napi::String>();
+    auto error_data = duckdb_create_error_data(error_type, message.c_str());
+    return CreateExternalForErrorData(env, error_data);
+  }
 
   // DUCKDB_C_API void duckdb_destroy_error_data(duckdb_error_data *error_data);
-  // TODO error data
+  // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_error_type duckdb_error_data_error_type(duckdb_error_data error_data);
-  // TODO error data
+  // function error_data_error_type(error_data: ErrorData): ErrorType
+  Napi::Value error_data_error_type(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto error_data = GetErrorDataFromExternal(env, info[0]);
+    auto error_type = duckdb_error_data_error_type(error_data);
+    return Napi::Number::New(env, error_type);
+  }
 
   // DUCKDB_C_API const char *duckdb_error_data_message(duckdb_error_data error_data);
-  // TODO error data
+  // function error_data_message(error_data: ErrorData): string
+  Napi::Value error_data_message(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto error_data = GetErrorDataFromExternal(env, info[0]);
+    auto message = duckdb_error_data_message(error_data);
+    return Napi::String::New(env, message ? message : "");
+  }
 
   // DUCKDB_C_API bool duckdb_error_data_has_error(duckdb_error_data error_data);
-  // TODO error data
+  // function error_data_has_error(error_data: ErrorData): boolean
+  Napi::Value error_data_has_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto error_data = GetErrorDataFromExternal(env, info[0]);
+    auto has_error = duckdb_error_data_has_error(error_data);
+    return Napi::Boolean::New(env, has_error);
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_query(duckdb_connection connection, const char *query, duckdb_result *out_result);
   // function query(connection: Connection, query: string): Promise<Result>
@@ -2875,7 +3054,17 @@ private:
   }
 
   // DUCKDB_C_API void duckdb_unsafe_vector_assign_string_element_len(duckdb_vector vector, idx_t index, const char *str, idx_t str_len);
-  // TODO utf8
+  // function unsafe_vector_assign_string_element_len(vector: Vector, index: number, data: Uint8Array): void
+  Napi::Value unsafe_vector_assign_string_element_len(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto vector = GetVectorFromExternal(env, info[0]);
+    auto index = info[1].As<Napi::Number>().Uint32Value();
+    auto array = info[2].As<Napi::Uint8Array>();
+    auto data = reinterpret_cast<const char *>(array.Data());
+    auto length = array.ByteLength();
+    duckdb_unsafe_vector_assign_string_element_len(vector, index, data, length);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_vector duckdb_list_vector_get_child(duckdb_vector vector);
   // function list_vector_get_child(vector: Vector): Vector
@@ -3203,43 +3392,145 @@ private:
   }
 
   // DUCKDB_C_API duckdb_scalar_function_set duckdb_create_scalar_function_set(const char *name);
-  // TODO scalar function set
+  // function create_scalar_function_set(name: string): ScalarFunctionSet
+  Napi::Value create_scalar_function_set(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    std::string name = info[0].As<Napi::String>();
+    auto scalar_function_set = duckdb_create_scalar_function_set(name.c_str());
+    return CreateExternalForScalarFunctionSet(env, scalar_function_set);
+  }
 
   // DUCKDB_C_API void duckdb_destroy_scalar_function_set(duckdb_scalar_function_set *scalar_function_set);
-  // TODO scalar function set
+  // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_state duckdb_add_scalar_function_to_set(duckdb_scalar_function_set set, duckdb_scalar_function function);
-  // TODO scalar function set
+  // function add_scalar_function_to_set(scalar_function_set: ScalarFunctionSet, scalar_function: ScalarFunction): void
+  Napi::Value add_scalar_function_to_set(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto scalar_function_set = GetScalarFunctionSetFromExternal(env, info[0]);
+    auto scalar_function = GetScalarFunctionFromExternal(env, info[1]);
+    if (duckdb_add_scalar_function_to_set(scalar_function_set, scalar_function)) {
+      throw Napi::Error::New(env, "Failed to add scalar function to set");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_register_scalar_function_set(duckdb_connection con, duckdb_scalar_function_set set);
-  // TODO scalar function set
+  // function register_scalar_function_set(connection: Connection, scalar_function_set: ScalarFunctionSet): void
+  Napi::Value register_scalar_function_set(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto connection = GetConnectionFromExternal(env, info[0]);
+    auto scalar_function_set = GetScalarFunctionSetFromExternal(env, info[1]);
+    if (duckdb_register_scalar_function_set(connection, scalar_function_set)) {
+      throw Napi::Error::New(env, "Failed to register scalar function set");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API idx_t duckdb_scalar_function_bind_get_argument_count(duckdb_bind_info info);
-  // TODO scalar function expression
+  // function scalar_function_bind_get_argument_count(bind_info: ScalarFunctionBindInfo): number
+  Napi::Value scalar_function_bind_get_argument_count(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetScalarFunctionBindInfoFromExternal(env, info[0]);
+    auto count = duckdb_scalar_function_bind_get_argument_count(bind_info);
+    return Napi::Number::New(env, count);
+  }
 
   // DUCKDB_C_API duckdb_expression duckdb_scalar_function_bind_get_argument(duckdb_bind_info info, idx_t index);
-  // TODO scalar function expression
+  // function scalar_function_bind_get_argument(bind_info: ScalarFunctionBindInfo, index: number): Expression
+  Napi::Value scalar_function_bind_get_argument(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetScalarFunctionBindInfoFromExternal(env, info[0]);
+    auto index = info[1].As<Napi::Number>().Uint32Value();
+    auto expression = duckdb_scalar_function_bind_get_argument(bind_info, index);
+    if (!expression) {
+      throw Napi::Error::New(env, "Failed to get argument");
+    }
+    return CreateExternalForExpression(env, expression);
+  }
 
   // DUCKDB_C_API void *duckdb_scalar_function_get_state(duckdb_function_info info);
-  // TODO scalar function init
+  // function scalar_function_get_state(function_info: ScalarFunctionInfo): object | undefined
+  Napi::Value scalar_function_get_state(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto function_info = GetScalarFunctionInfoFromExternal(env, info[0]);
+    auto internal_state = reinterpret_cast<ScalarFunctionInternalState*>(duckdb_scalar_function_get_state(function_info));
+    if (!internal_state || !internal_state->user_state_ref) {
+      return env.Undefined();
+    }
+    return internal_state->user_state_ref->ref.Value();
+  }
 
   // DUCKDB_C_API void duckdb_scalar_function_set_init(duckdb_scalar_function scalar_function, duckdb_scalar_function_init_t init);
-  // TODO scalar function init
+  // function scalar_function_set_init(scalar_function: ScalarFunction, func: ScalarFunctionInitFunction): void
+  Napi::Value scalar_function_set_init(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetScalarFunctionHolderFromExternal(env, info[0]);
+    auto func = info[1].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetInitFunction(env, func);
+    duckdb_scalar_function_set_init(holder->scalar_function, &ScalarFunctionInitFunction);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_scalar_function_init_set_error(duckdb_init_info info, const char *error);
-  // TODO scalar function init
+  // function scalar_function_init_set_error(init_info: ScalarFunctionInitInfo, error: string): void
+  Napi::Value scalar_function_init_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto init_info = GetScalarFunctionInitInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_scalar_function_init_set_error(init_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_scalar_function_init_set_state(duckdb_init_info info, void *state, duckdb_delete_callback_t destroy);
-  // TODO scalar function init
+  // function scalar_function_init_set_state(init_info: ScalarFunctionInitInfo, state: object): void
+  Napi::Value scalar_function_init_set_state(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto init_info = GetScalarFunctionInitInfoFromExternal(env, info[0]);
+    auto user_state = info[1].As<Napi::Object>();
+    auto internal_state = new ScalarFunctionInternalState();
+    internal_state->SetUserState(ref_reaper, user_state);
+    duckdb_scalar_function_init_set_state(init_info, internal_state, reinterpret_cast<duckdb_delete_callback_t>(DeleteScalarFunctionInternalState));
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_scalar_function_init_get_client_context(duckdb_init_info info, duckdb_client_context *out_context);
-  // TODO scalar function init
+  // function scalar_function_init_get_client_context(init_info: ScalarFunctionInitInfo): ClientContext
+  Napi::Value scalar_function_init_get_client_context(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto init_info = GetScalarFunctionInitInfoFromExternal(env, info[0]);
+    duckdb_client_context client_context;
+    duckdb_scalar_function_init_get_client_context(init_info, &client_context);
+    if (!client_context) {
+      throw Napi::Error::New(env, "Failed to get client context");
+    }
+    return CreateExternalForClientContext(env, client_context);
+  }
 
   // DUCKDB_C_API void *duckdb_scalar_function_init_get_bind_data(duckdb_init_info info);
-  // TODO scalar function init
+  // function scalar_function_init_get_bind_data(init_info: ScalarFunctionInitInfo): object | undefined
+  Napi::Value scalar_function_init_get_bind_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto init_info = GetScalarFunctionInitInfoFromExternal(env, info[0]);
+    auto internal_bind_data = reinterpret_cast<ScalarFunctionInternalBindData*>(duckdb_scalar_function_init_get_bind_data(init_info));
+    if (!internal_bind_data || !internal_bind_data->user_bind_data_ref) {
+      return env.Undefined();
+    }
+    return internal_bind_data->user_bind_data_ref->ref.Value();
+  }
 
   // DUCKDB_C_API void *duckdb_scalar_function_init_get_extra_info(duckdb_init_info info);
-  // TODO scalar function init
+  // function scalar_function_init_get_extra_info(init_info: ScalarFunctionInitInfo): object | undefined
+  Napi::Value scalar_function_init_get_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto init_info = GetScalarFunctionInitInfoFromExternal(env, info[0]);
+    auto internal_extra_info = GetScalarFunctionInternalExtraInfoFromInitInfo(init_info);
+    if (!internal_extra_info || !internal_extra_info->user_extra_info_ref) {
+      return env.Undefined();
+    }
+    return internal_extra_info->user_extra_info_ref->ref.Value();
+  }
 
   // DUCKDB_C_API duckdb_selection_vector duckdb_create_selection_vector(idx_t size);
   // TODO selection vector
@@ -3251,52 +3542,175 @@ private:
   // TODO selection vector
 
   // DUCKDB_C_API duckdb_aggregate_function duckdb_create_aggregate_function();
-  // TODO aggregate function
+  // function create_aggregate_function(): AggregateFunction
+  Napi::Value create_aggregate_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto aggregate_function = duckdb_create_aggregate_function();
+    return CreateExternalForAggregateFunction(env, aggregate_function);
+  }
 
   // DUCKDB_C_API void duckdb_destroy_aggregate_function(duckdb_aggregate_function *aggregate_function);
-  // TODO aggregate function
+  // function destroy_aggregate_function_sync(aggregate_function: AggregateFunction): void
+  Napi::Value destroy_aggregate_function_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetAggregateFunctionHolderFromExternal(env, info[0]);
+    // duckdb_destroy_aggregate_function is a no-op if already destroyed
+    duckdb_destroy_aggregate_function(&holder->aggregate_function);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_set_name(duckdb_aggregate_function aggregate_function, const char *name);
-  // TODO aggregate function
+  // function aggregate_function_set_name(aggregate_function: AggregateFunction, name: string): void
+  Napi::Value aggregate_function_set_name(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto aggregate_function = GetAggregateFunctionFromExternal(env, info[0]);
+    std::string name = info[1].As<Napi::String>();
+    duckdb_aggregate_function_set_name(aggregate_function, name.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_add_parameter(duckdb_aggregate_function aggregate_function, duckdb_logical_type type);
-  // TODO aggregate function
+  // function aggregate_function_add_parameter(aggregate_function: AggregateFunction, logical_type: LogicalType): void
+  Napi::Value aggregate_function_add_parameter(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto aggregate_function = GetAggregateFunctionFromExternal(env, info[0]);
+    auto logical_type = GetLogicalTypeFromExternal(env, info[1]);
+    duckdb_aggregate_function_add_parameter(aggregate_function, logical_type);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_set_return_type(duckdb_aggregate_function aggregate_function, duckdb_logical_type type);
-  // TODO aggregate function
+  // function aggregate_function_set_return_type(aggregate_function: AggregateFunction, logical_type: LogicalType): void
+  Napi::Value aggregate_function_set_return_type(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto aggregate_function = GetAggregateFunctionFromExternal(env, info[0]);
+    auto logical_type = GetLogicalTypeFromExternal(env, info[1]);
+    duckdb_aggregate_function_set_return_type(aggregate_function, logical_type);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_set_functions(duckdb_aggregate_function aggregate_function, duckdb_aggregate_state_size state_size, duckdb_aggregate_init_t state_init, duckdb_aggregate_update_t update, duckdb_aggregate_combine_t combine, duckdb_aggregate_finalize_t finalize);
-  // TODO aggregate function
+  // function aggregate_function_set_functions(aggregate_function: AggregateFunction, update: AggregateFunctionUpdateFunction, combine: AggregateFunctionCombineFunction, finalize: AggregateFunctionFinalizeFunction): void
+  Napi::Value aggregate_function_set_functions(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetAggregateFunctionHolderFromExternal(env, info[0]);
+    auto update = info[1].As<Napi::Function>();
+    auto combine = info[2].As<Napi::Function>();
+    auto finalize = info[3].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetFunctions(env, update, combine, finalize);
+    duckdb_aggregate_function_set_functions(
+      holder->aggregate_function,
+      &AggregateFunctionStateSize,
+      &AggregateFunctionStateInit,
+      &AggregateFunctionUpdate,
+      &AggregateFunctionCombine,
+      &AggregateFunctionFinalize
+    );
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_set_destructor(duckdb_aggregate_function aggregate_function, duckdb_aggregate_destroy_t destroy);
-  // TODO aggregate function
+  // function aggregate_function_set_destructor(aggregate_function: AggregateFunction, destroy: AggregateFunctionDestroyFunction): void
+  Napi::Value aggregate_function_set_destructor(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetAggregateFunctionHolderFromExternal(env, info[0]);
+    auto destroy = info[1].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetDestroyFunction(destroy);
+    duckdb_aggregate_function_set_destructor(holder->aggregate_function, &AggregateFunctionDestroy);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_register_aggregate_function(duckdb_connection con, duckdb_aggregate_function aggregate_function);
-  // TODO aggregate function
+  // function register_aggregate_function(connection: Connection, aggregate_function: AggregateFunction): void
+  Napi::Value register_aggregate_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto connection = GetConnectionFromExternal(env, info[0]);
+    auto aggregate_function = GetAggregateFunctionFromExternal(env, info[1]);
+    if (duckdb_register_aggregate_function(connection, aggregate_function)) {
+      throw Napi::Error::New(env, "Failed to register aggregate function");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_set_special_handling(duckdb_aggregate_function aggregate_function);
-  // TODO aggregate function
+  // function aggregate_function_set_special_handling(aggregate_function: AggregateFunction): void
+  Napi::Value aggregate_function_set_special_handling(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto aggregate_function = GetAggregateFunctionFromExternal(env, info[0]);
+    duckdb_aggregate_function_set_special_handling(aggregate_function);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_set_extra_info(duckdb_aggregate_function aggregate_function, void *extra_info, duckdb_delete_callback_t destroy);
-  // TODO aggregate function
+  // function aggregate_function_set_extra_info(aggregate_function: AggregateFunction, extra_info: object): void
+  Napi::Value aggregate_function_set_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetAggregateFunctionHolderFromExternal(env, info[0]);
+    auto user_extra_info = info[1].As<Napi::Object>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetUserExtraInfo(ref_reaper, user_extra_info);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void *duckdb_aggregate_function_get_extra_info(duckdb_function_info info);
-  // TODO aggregate function
+  // function aggregate_function_get_extra_info(function_info: AggregateFunctionInfo): object | undefined
+  Napi::Value aggregate_function_get_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto function_info = GetAggregateFunctionInfoFromExternal(env, info[0]);
+    auto internal_extra_info = GetAggregateFunctionInternalExtraInfoFromFunctionInfo(function_info);
+    if (!internal_extra_info || !internal_extra_info->user_extra_info_ref) {
+      return env.Undefined();
+    }
+    return internal_extra_info->user_extra_info_ref->ref.Value();
+  }
 
   // DUCKDB_C_API void duckdb_aggregate_function_set_error(duckdb_function_info info, const char *error);
-  // TODO aggregate function
+  // function aggregate_function_set_error(function_info: AggregateFunctionInfo, error: string): void
+  Napi::Value aggregate_function_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto function_info = GetAggregateFunctionInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_aggregate_function_set_error(function_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_aggregate_function_set duckdb_create_aggregate_function_set(const char *name);
-  // TODO aggregate function set
+  // function create_aggregate_function_set(name: string): AggregateFunctionSet
+  Napi::Value create_aggregate_function_set(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    std::string name = info[0].As<Napi::String>();
+    auto aggregate_function_set = duckdb_create_aggregate_function_set(name.c_str());
+    return CreateExternalForAggregateFunctionSet(env, aggregate_function_set);
+  }
 
   // DUCKDB_C_API void duckdb_destroy_aggregate_function_set(duckdb_aggregate_function_set *aggregate_function_set);
-  // TODO aggregate function set
+  // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_state duckdb_add_aggregate_function_to_set(duckdb_aggregate_function_set set, duckdb_aggregate_function function);
-  // TODO aggregate function set
+  // function add_aggregate_function_to_set(aggregate_function_set: AggregateFunctionSet, aggregate_function: AggregateFunction): void
+  Napi::Value add_aggregate_function_to_set(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto aggregate_function_set = GetAggregateFunctionSetFromExternal(env, info[0]);
+    auto aggregate_function = GetAggregateFunctionFromExternal(env, info[1]);
+    if (duckdb_add_aggregate_function_to_set(aggregate_function_set, aggregate_function)) {
+      throw Napi::Error::New(env, "Failed to add aggregate function to set");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_register_aggregate_function_set(duckdb_connection con, duckdb_aggregate_function_set set);
-  // TODO aggregate function set
+  // function register_aggregate_function_set(connection: Connection, aggregate_function_set: AggregateFunctionSet): void
+  Napi::Value register_aggregate_function_set(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto connection = GetConnectionFromExternal(env, info[0]);
+    auto aggregate_function_set = GetAggregateFunctionSetFromExternal(env, info[1]);
+    if (duckdb_register_aggregate_function_set(connection, aggregate_function_set)) {
+      throw Napi::Error::New(env, "Failed to register aggregate function set");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_table_function duckdb_create_table_function();
   // function create_table_function(): TableFunction
@@ -3669,16 +4083,46 @@ private:
   }
 
   // DUCKDB_C_API void duckdb_add_replacement_scan(duckdb_database db, duckdb_replacement_callback_t replacement, void *extra_data, duckdb_delete_callback_t delete_callback);
-  // TODO replacement scan
+  // function add_replacement_scan(database: Database, replacement: ReplacementScanFunction): void
+  Napi::Value add_replacement_scan(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto database = GetDatabaseFromExternal(env, info[0]);
+    auto replacement = info[1].As<Napi::Function>();
+    auto internal_extra_data = new ReplacementScanInternalExtraData(ref_reaper);
+    internal_extra_data->callback.Set(env, replacement);
+    duckdb_add_replacement_scan(database, &ReplacementScanFunction, internal_extra_data, reinterpret_cast<duckdb_delete_callback_t>(DeleteReplacementScanInternalExtraData));
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_replacement_scan_set_function_name(duckdb_replacement_scan_info info, const char *function_name);
-  // TODO replacement scan
+  // function replacement_scan_set_function_name(info: ReplacementScanInfo, function_name: string): void
+  Napi::Value replacement_scan_set_function_name(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto replacement_scan_info = GetReplacementScanInfoFromExternal(env, info[0]);
+    std::string function_name = info[1].As<Napi::String>();
+    duckdb_replacement_scan_set_function_name(replacement_scan_info, function_name.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_replacement_scan_add_parameter(duckdb_replacement_scan_info info, duckdb_value parameter);
-  // TODO replacement scan
+  // function replacement_scan_add_parameter(info: ReplacementScanInfo, parameter: Value): void
+  Napi::Value replacement_scan_add_parameter(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto replacement_scan_info = GetReplacementScanInfoFromExternal(env, info[0]);
+    auto parameter = GetValueFromExternal(env, info[1]);
+    duckdb_replacement_scan_add_parameter(replacement_scan_info, parameter);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_replacement_scan_set_error(duckdb_replacement_scan_info info, const char *error);
-  // TODO replacement scan
+  // function replacement_scan_set_error(info: ReplacementScanInfo, error: string): void
+  Napi::Value replacement_scan_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto replacement_scan_info = GetReplacementScanInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_replacement_scan_set_error(replacement_scan_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_profiling_info duckdb_get_profiling_info(duckdb_connection connection);
   // TODO profiling info
@@ -3779,7 +4223,13 @@ private:
   // #endif
 
   // DUCKDB_C_API duckdb_error_data duckdb_appender_error_data(duckdb_appender appender);
-  // TODO appender error data
+  // function appender_error_data(appender: Appender): ErrorData
+  Napi::Value appender_error_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto appender = GetAppenderFromExternal(env, info[0]);
+    auto error_data = duckdb_appender_error_data(appender);
+    return CreateExternalForErrorData(env, error_data);
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_appender_flush(duckdb_appender appender);
   // function appender_flush(appender: Appender): void
@@ -3793,7 +4243,15 @@ private:
   }
 
   // DUCKDB_C_API duckdb_state duckdb_appender_clear(duckdb_appender appender);
-  // TODO appender clear
+  // function appender_clear(appender: Appender): void
+  Napi::Value appender_clear(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto appender = GetAppenderFromExternal(env, info[0]);
+    if (duckdb_appender_clear(appender)) {
+      throw Napi::Error::New(env, duckdb_appender_error(appender));
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_appender_close(duckdb_appender appender);
   // function appender_close(appender: Appender): void
@@ -3810,10 +4268,27 @@ private:
   // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_state duckdb_appender_add_column(duckdb_appender appender, const char *name);
-  // TODO appender columns
+  // function appender_add_column(appender: Appender, name: string): void
+  Napi::Value appender_add_column(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto appender = GetAppenderFromExternal(env, info[0]);
+    std::string name = info[1].As<Napi::String>();
+    if (duckdb_appender_add_column(appender, name.c_str())) {
+      throw Napi::Error::New(env, duckdb_appender_error(appender));
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_appender_clear_columns(duckdb_appender appender);
-  // TODO appender columns
+  // function appender_clear_columns(appender: Appender): void
+  Napi::Value appender_clear_columns(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto appender = GetAppenderFromExternal(env, info[0]);
+    if (duckdb_appender_clear_columns(appender)) {
+      throw Napi::Error::New(env, duckdb_appender_error(appender));
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_appender_begin_row(duckdb_appender appender);
   // not exposed: no-op
@@ -3841,7 +4316,18 @@ private:
   }
 
   // DUCKDB_C_API duckdb_state duckdb_append_default_to_chunk(duckdb_appender appender, duckdb_data_chunk chunk, idx_t col, idx_t row);
-  // TODO appender default
+  // function append_default_to_chunk(appender: Appender, chunk: DataChunk, column_index: number, row_index: number): void
+  Napi::Value append_default_to_chunk(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto appender = GetAppenderFromExternal(env, info[0]);
+    auto chunk = GetDataChunkFromExternal(env, info[1]);
+    auto column_index = info[2].As<Napi::Number>().Uint32Value();
+    auto row_index = info[3].As<Napi::Number>().Uint32Value();
+    if (duckdb_append_default_to_chunk(appender, chunk, column_index, row_index)) {
+      throw Napi::Error::New(env, duckdb_appender_error(appender));
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_append_bool(duckdb_appender appender, bool value);
   // function append_bool(appender: Appender, bool: boolean): void
@@ -4248,100 +4734,331 @@ private:
   }
 
   // DUCKDB_C_API duckdb_cast_function duckdb_create_cast_function();
-  // TODO cast function
+  // function create_cast_function(): CastFunction
+  Napi::Value create_cast_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto cast_function = duckdb_create_cast_function();
+    return CreateExternalForCastFunction(env, cast_function);
+  }
 
   // DUCKDB_C_API void duckdb_cast_function_set_source_type(duckdb_cast_function cast_function, duckdb_logical_type source_type);
-  // TODO cast function
+  // function cast_function_set_source_type(cast_function: CastFunction, source_type: LogicalType): void
+  Napi::Value cast_function_set_source_type(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto cast_function = GetCastFunctionFromExternal(env, info[0]);
+    auto source_type = GetLogicalTypeFromExternal(env, info[1]);
+    duckdb_cast_function_set_source_type(cast_function, source_type);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_cast_function_set_target_type(duckdb_cast_function cast_function, duckdb_logical_type target_type);
-  // TODO cast function
+  // function cast_function_set_target_type(cast_function: CastFunction, target_type: LogicalType): void
+  Napi::Value cast_function_set_target_type(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto cast_function = GetCastFunctionFromExternal(env, info[0]);
+    auto target_type = GetLogicalTypeFromExternal(env, info[1]);
+    duckdb_cast_function_set_target_type(cast_function, target_type);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_cast_function_set_implicit_cast_cost(duckdb_cast_function cast_function, int64_t cost);
-  // TODO cast function
+  // function cast_function_set_implicit_cast_cost(cast_function: CastFunction, cost: number): void
+  Napi::Value cast_function_set_implicit_cast_cost(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto cast_function = GetCastFunctionFromExternal(env, info[0]);
+    auto cost = info[1].As<Napi::Number>().Int64Value();
+    duckdb_cast_function_set_implicit_cast_cost(cast_function, cost);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_cast_function_set_function(duckdb_cast_function cast_function, duckdb_cast_function_t function);
-  // TODO cast function
+  // function cast_function_set_function(cast_function: CastFunction, func: CastFunctionMainFunction): void
+  Napi::Value cast_function_set_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCastFunctionHolderFromExternal(env, info[0]);
+    auto func = info[1].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetMainFunction(env, func);
+    duckdb_cast_function_set_function(holder->cast_function, &CastFunctionMainFunction);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_cast_function_set_extra_info(duckdb_cast_function cast_function, void *extra_info, duckdb_delete_callback_t destroy);
-  // TODO cast function
+  // function cast_function_set_extra_info(cast_function: CastFunction, extra_info: object): void
+  Napi::Value cast_function_set_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCastFunctionHolderFromExternal(env, info[0]);
+    auto user_extra_info = info[1].As<Napi::Object>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetUserExtraInfo(ref_reaper, user_extra_info);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void *duckdb_cast_function_get_extra_info(duckdb_function_info info);
-  // TODO cast function
+  // function cast_function_get_extra_info(function_info: CastFunctionInfo): object | undefined
+  Napi::Value cast_function_get_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto function_info = GetCastFunctionInfoFromExternal(env, info[0]);
+    auto internal_extra_info = GetCastFunctionInternalExtraInfoFromFunctionInfo(function_info);
+    if (!internal_extra_info || !internal_extra_info->user_extra_info_ref) {
+      return env.Undefined();
+    }
+    return internal_extra_info->user_extra_info_ref->ref.Value();
+  }
 
   // DUCKDB_C_API duckdb_cast_mode duckdb_cast_function_get_cast_mode(duckdb_function_info info);
-  // TODO cast function
+  // function cast_function_get_cast_mode(function_info: CastFunctionInfo): CastMode
+  Napi::Value cast_function_get_cast_mode(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto function_info = GetCastFunctionInfoFromExternal(env, info[0]);
+    auto cast_mode = duckdb_cast_function_get_cast_mode(function_info);
+    return Napi::Number::New(env, cast_mode);
+  }
 
   // DUCKDB_C_API void duckdb_cast_function_set_error(duckdb_function_info info, const char *error);
-  // TODO cast function
+  // function cast_function_set_error(function_info: CastFunctionInfo, error: string): void
+  Napi::Value cast_function_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto function_info = GetCastFunctionInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_cast_function_set_error(function_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_cast_function_set_row_error(duckdb_function_info info, const char *error, idx_t row, duckdb_vector output);
-  // TODO cast function
+  // function cast_function_set_row_error(function_info: CastFunctionInfo, error: string, row: number, output: Vector): void
+  Napi::Value cast_function_set_row_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto function_info = GetCastFunctionInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    auto row = info[2].As<Napi::Number>().Uint32Value();
+    auto output = GetVectorFromExternal(env, info[3]);
+    duckdb_cast_function_set_row_error(function_info, error.c_str(), row, output);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_register_cast_function(duckdb_connection con, duckdb_cast_function cast_function);
-  // TODO cast function
+  // function register_cast_function(connection: Connection, cast_function: CastFunction): void
+  Napi::Value register_cast_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto connection = GetConnectionFromExternal(env, info[0]);
+    auto cast_function = GetCastFunctionFromExternal(env, info[1]);
+    if (duckdb_register_cast_function(connection, cast_function)) {
+      throw Napi::Error::New(env, "Failed to register cast function");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_destroy_cast_function(duckdb_cast_function *cast_function);
-  // TODO cast function
+  // function destroy_cast_function_sync(cast_function: CastFunction): void
+  Napi::Value destroy_cast_function_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCastFunctionHolderFromExternal(env, info[0]);
+    // duckdb_destroy_cast_function is a no-op if already destroyed
+    duckdb_destroy_cast_function(&holder->cast_function);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_destroy_expression(duckdb_expression *expr);
-  // TODO expression
+  // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_logical_type duckdb_expression_return_type(duckdb_expression expr);
-  // TODO expression
+  // function expression_return_type(expression: Expression): LogicalType
+  Napi::Value expression_return_type(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto expression = GetExpressionFromExternal(env, info[0]);
+    auto logical_type = duckdb_expression_return_type(expression);
+    return CreateExternalForLogicalType(env, logical_type);
+  }
 
   // DUCKDB_C_API bool duckdb_expression_is_foldable(duckdb_expression expr);
-  // TODO expression
+  // function expression_is_foldable(expression: Expression): boolean
+  Napi::Value expression_is_foldable(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto expression = GetExpressionFromExternal(env, info[0]);
+    auto is_foldable = duckdb_expression_is_foldable(expression);
+    return Napi::Boolean::New(env, is_foldable);
+  }
 
   // DUCKDB_C_API duckdb_error_data duckdb_expression_fold(duckdb_client_context context, duckdb_expression expr, duckdb_value *out_value);
-  // TODO expression
+  // function expression_fold(client_context: ClientContext, expression: Expression): Value
+  Napi::Value expression_fold(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto client_context = GetClientContextFromExternal(env, info[0]);
+    auto expression = GetExpressionFromExternal(env, info[1]);
+    duckdb_value value = nullptr;
+    auto error_data = duckdb_expression_fold(client_context, expression, &value);
+    if (error_data) {
+      auto has_error = duckdb_error_data_has_error(error_data);
+      std::string message = has_error ? duckdb_error_data_message(error_data) : "";
+      duckdb_destroy_error_data(&error_data);
+      if (has_error) {
+        throw Napi::Error::New(env, message);
+      }
+    }
+    if (!value) {
+      throw Napi::Error::New(env, "Failed to fold expression");
+    }
+    return CreateExternalForValue(env, value);
+  }
 
   // DUCKDB_C_API duckdb_file_system duckdb_client_context_get_file_system(duckdb_client_context context);
-  // TODO file system
+  // function client_context_get_file_system(client_context: ClientContext): FileSystem
+  Napi::Value client_context_get_file_system(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto client_context = GetClientContextFromExternal(env, info[0]);
+    auto file_system = duckdb_client_context_get_file_system(client_context);
+    if (!file_system) {
+      throw Napi::Error::New(env, "Failed to get file system");
+    }
+    return CreateExternalForFileSystem(env, file_system);
+  }
 
   // DUCKDB_C_API void duckdb_destroy_file_system(duckdb_file_system *file_system);
-  // TODO file system
+  // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_error_data duckdb_file_system_error_data(duckdb_file_system file_system);
-  // TODO file system
+  // function file_system_error_data(file_system: FileSystem): ErrorData
+  Napi::Value file_system_error_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_system = GetFileSystemFromExternal(env, info[0]);
+    auto error_data = duckdb_file_system_error_data(file_system);
+    return CreateExternalForErrorData(env, error_data);
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_file_system_open(duckdb_file_system file_system, const char *path, duckdb_file_open_options options, duckdb_file_handle *out_file);
-  // TODO file system
+  // function file_system_open_sync(file_system: FileSystem, path: string, options: FileOpenOptions): FileHandle
+  Napi::Value file_system_open_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_system = GetFileSystemFromExternal(env, info[0]);
+    std::string path = info[1].As<Napi::String>();
+    auto options = GetFileOpenOptionsFromExternal(env, info[2]);
+    duckdb_file_handle file_handle = nullptr;
+    if (duckdb_file_system_open(file_system, path.c_str(), options, &file_handle)) {
+      ThrowErrorData(env, duckdb_file_system_error_data(file_system), "Failed to open file");
+    }
+    return CreateExternalForFileHandle(env, file_handle);
+  }
 
   // DUCKDB_C_API duckdb_file_open_options duckdb_create_file_open_options();
-  // TODO file system
+  // function create_file_open_options(): FileOpenOptions
+  Napi::Value create_file_open_options(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto options = duckdb_create_file_open_options();
+    return CreateExternalForFileOpenOptions(env, options);
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_file_open_options_set_flag(duckdb_file_open_options options, duckdb_file_flag flag, bool value);
-  // TODO file system
+  // function file_open_options_set_flag(options: FileOpenOptions, flag: FileFlag, value: boolean): void
+  Napi::Value file_open_options_set_flag(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto options = GetFileOpenOptionsFromExternal(env, info[0]);
+    auto flag = static_cast<duckdb_file_flag>(info[1].As<Napi::Number>().Uint32Value());
+    auto value = info[2].As<Napi::Boolean>().Value();
+    if (duckdb_file_open_options_set_flag(options, flag, value)) {
+      throw Napi::Error::New(env, "Failed to set file open flag");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_destroy_file_open_options(duckdb_file_open_options *options);
-  // TODO file system
+  // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API void duckdb_destroy_file_handle(duckdb_file_handle *file_handle);
-  // TODO file system
+  // not exposed: destroyed in finalizer
 
   // DUCKDB_C_API duckdb_error_data duckdb_file_handle_error_data(duckdb_file_handle file_handle);
-  // TODO file system
+  // function file_handle_error_data(file_handle: FileHandle): ErrorData
+  Napi::Value file_handle_error_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    auto error_data = duckdb_file_handle_error_data(file_handle);
+    return CreateExternalForErrorData(env, error_data);
+  }
 
   // DUCKDB_C_API int64_t duckdb_file_handle_read(duckdb_file_handle file_handle, void *buffer, int64_t size);
-  // TODO file system
+  // function file_handle_read_sync(file_handle: FileHandle, buffer: Uint8Array): number
+  Napi::Value file_handle_read_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    auto array = info[1].As<Napi::Uint8Array>();
+    auto bytes_read = duckdb_file_handle_read(file_handle, array.Data(), array.ByteLength());
+    if (bytes_read < 0) {
+      ThrowErrorData(env, duckdb_file_handle_error_data(file_handle), "Failed to read file");
+    }
+    return Napi::Number::New(env, bytes_read);
+  }
 
   // DUCKDB_C_API int64_t duckdb_file_handle_write(duckdb_file_handle file_handle, const void *buffer, int64_t size);
-  // TODO file system
+  // function file_handle_write_sync(file_handle: FileHandle, data: Uint8Array): number
+  Napi::Value file_handle_write_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    auto array = info[1].As<Napi::Uint8Array>();
+    auto bytes_written = duckdb_file_handle_write(file_handle, array.Data(), array.ByteLength());
+    if (bytes_written < 0) {
+      ThrowErrorData(env, duckdb_file_handle_error_data(file_handle), "Failed to write file");
+    }
+    return Napi::Number::New(env, bytes_written);
+  }
 
   // DUCKDB_C_API int64_t duckdb_file_handle_tell(duckdb_file_handle file_handle);
-  // TODO file system
+  // function file_handle_tell(file_handle: FileHandle): number
+  Napi::Value file_handle_tell(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    auto position = duckdb_file_handle_tell(file_handle);
+    if (position < 0) {
+      ThrowErrorData(env, duckdb_file_handle_error_data(file_handle), "Failed to get file position");
+    }
+    return Napi::Number::New(env, position);
+  }
 
   // DUCKDB_C_API int64_t duckdb_file_handle_size(duckdb_file_handle file_handle);
-  // TODO file system
+  // function file_handle_size(file_handle: FileHandle): number
+  Napi::Value file_handle_size(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    auto size = duckdb_file_handle_size(file_handle);
+    if (size < 0) {
+      ThrowErrorData(env, duckdb_file_handle_error_data(file_handle), "Failed to get file size");
+    }
+    return Napi::Number::New(env, size);
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_file_handle_seek(duckdb_file_handle file_handle, int64_t position);
-  // TODO file system
+  // function file_handle_seek(file_handle: FileHandle, position: number): void
+  Napi::Value file_handle_seek(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    auto position = info[1].As<Napi::Number>().Int64Value();
+    if (duckdb_file_handle_seek(file_handle, position)) {
+      ThrowErrorData(env, duckdb_file_handle_error_data(file_handle), "Failed to seek file");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_file_handle_sync(duckdb_file_handle file_handle);
-  // TODO file system
+  // function file_handle_sync(file_handle: FileHandle): void
+  Napi::Value file_handle_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    if (duckdb_file_handle_sync(file_handle)) {
+      ThrowErrorData(env, duckdb_file_handle_error_data(file_handle), "Failed to sync file");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_file_handle_close(duckdb_file_handle file_handle);
-  // TODO file system
+  // function file_handle_close_sync(file_handle: FileHandle): void
+  Napi::Value file_handle_close_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto file_handle = GetFileHandleFromExternal(env, info[0]);
+    if (duckdb_file_handle_close(file_handle)) {
+      ThrowErrorData(env, duckdb_file_handle_error_data(file_handle), "Failed to close file");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_config_option duckdb_create_config_option();
   // TODO config option
@@ -4371,112 +5088,416 @@ private:
   // TODO config option
 
   // DUCKDB_C_API duckdb_copy_function duckdb_create_copy_function();
-  // TODO copy function
+  // function create_copy_function(): CopyFunction
+  Napi::Value create_copy_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto copy_function = duckdb_create_copy_function();
+    return CreateExternalForCopyFunction(env, copy_function);
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_set_name(duckdb_copy_function copy_function, const char *name);
-  // TODO copy function
+  // function copy_function_set_name(copy_function: CopyFunction, name: string): void
+  Napi::Value copy_function_set_name(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto copy_function = GetCopyFunctionFromExternal(env, info[0]);
+    std::string name = info[1].As<Napi::String>();
+    duckdb_copy_function_set_name(copy_function, name.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_set_extra_info(duckdb_copy_function copy_function, void *extra_info, duckdb_delete_callback_t destructor);
-  // TODO copy function
+  // function copy_function_set_extra_info(copy_function: CopyFunction, extra_info: object): void
+  Napi::Value copy_function_set_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCopyFunctionHolderFromExternal(env, info[0]);
+    auto user_extra_info = info[1].As<Napi::Object>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetUserExtraInfo(user_extra_info);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API duckdb_state duckdb_register_copy_function(duckdb_connection connection, duckdb_copy_function copy_function);
-  // TODO copy function
+  // function register_copy_function(connection: Connection, copy_function: CopyFunction): void
+  Napi::Value register_copy_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto connection = GetConnectionFromExternal(env, info[0]);
+    auto copy_function = GetCopyFunctionFromExternal(env, info[1]);
+    if (duckdb_register_copy_function(connection, copy_function)) {
+      throw Napi::Error::New(env, "Failed to register copy function");
+    }
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_destroy_copy_function(duckdb_copy_function *copy_function);
-  // TODO copy function
+  // function destroy_copy_function_sync(copy_function: CopyFunction): void
+  Napi::Value destroy_copy_function_sync(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCopyFunctionHolderFromExternal(env, info[0]);
+    // duckdb_destroy_copy_function is a no-op if already destroyed
+    duckdb_destroy_copy_function(&holder->copy_function);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_set_bind(duckdb_copy_function copy_function, duckdb_copy_function_bind_t bind);
-  // TODO copy function
+  // function copy_function_set_bind(copy_function: CopyFunction, func: CopyFunctionBindFunction): void
+  Napi::Value copy_function_set_bind(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCopyFunctionHolderFromExternal(env, info[0]);
+    auto func = info[1].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetBindFunction(env, func);
+    duckdb_copy_function_set_bind(holder->copy_function, &CopyFunctionBindFunction);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_bind_set_error(duckdb_copy_function_bind_info info, const char *error);
-  // TODO copy function
+  // function copy_function_bind_set_error(bind_info: CopyFunctionBindInfo, error: string): void
+  Napi::Value copy_function_bind_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetCopyFunctionBindInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_copy_function_bind_set_error(bind_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_bind_get_extra_info(duckdb_copy_function_bind_info info);
-  // TODO copy function
+  // function copy_function_bind_get_extra_info(bind_info: CopyFunctionBindInfo): object | undefined
+  Napi::Value copy_function_bind_get_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetCopyFunctionBindInfoFromExternal(env, info[0]);
+    auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_bind_get_extra_info(bind_info));
+    if (!internal_extra_info || !internal_extra_info->user_extra_info_ref) {
+      return env.Undefined();
+    }
+    return internal_extra_info->user_extra_info_ref->ref.Value();
+  }
 
   // DUCKDB_C_API duckdb_client_context duckdb_copy_function_bind_get_client_context(duckdb_copy_function_bind_info info);
-  // TODO copy function
+  // function copy_function_bind_get_client_context(bind_info: CopyFunctionBindInfo): ClientContext
+  Napi::Value copy_function_bind_get_client_context(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetCopyFunctionBindInfoFromExternal(env, info[0]);
+    auto client_context = duckdb_copy_function_bind_get_client_context(bind_info);
+    if (!client_context) {
+      throw Napi::Error::New(env, "Failed to get client context");
+    }
+    return CreateExternalForClientContext(env, client_context);
+  }
 
   // DUCKDB_C_API idx_t duckdb_copy_function_bind_get_column_count(duckdb_copy_function_bind_info info);
-  // TODO copy function
+  // function copy_function_bind_get_column_count(bind_info: CopyFunctionBindInfo): number
+  Napi::Value copy_function_bind_get_column_count(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetCopyFunctionBindInfoFromExternal(env, info[0]);
+    auto column_count = duckdb_copy_function_bind_get_column_count(bind_info);
+    return Napi::Number::New(env, column_count);
+  }
 
   // DUCKDB_C_API duckdb_logical_type duckdb_copy_function_bind_get_column_type(duckdb_copy_function_bind_info info, idx_t col_idx);
-  // TODO copy function
+  // function copy_function_bind_get_column_type(bind_info: CopyFunctionBindInfo, column_index: number): LogicalType
+  Napi::Value copy_function_bind_get_column_type(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetCopyFunctionBindInfoFromExternal(env, info[0]);
+    auto column_index = info[1].As<Napi::Number>().Uint32Value();
+    auto logical_type = duckdb_copy_function_bind_get_column_type(bind_info, column_index);
+    if (!logical_type) {
+      throw Napi::Error::New(env, "Failed to get column type");
+    }
+    return CreateExternalForLogicalType(env, logical_type);
+  }
 
   // DUCKDB_C_API duckdb_value duckdb_copy_function_bind_get_options(duckdb_copy_function_bind_info info);
-  // TODO copy function
+  // function copy_function_bind_get_options(bind_info: CopyFunctionBindInfo): Value
+  Napi::Value copy_function_bind_get_options(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetCopyFunctionBindInfoFromExternal(env, info[0]);
+    auto options = duckdb_copy_function_bind_get_options(bind_info);
+    if (!options) {
+      throw Napi::Error::New(env, "Failed to get options");
+    }
+    return CreateExternalForValue(env, options);
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_bind_set_bind_data(duckdb_copy_function_bind_info info, void *bind_data, duckdb_delete_callback_t destructor);
-  // TODO copy function
+  // function copy_function_bind_set_bind_data(bind_info: CopyFunctionBindInfo, bind_data: object): void
+  Napi::Value copy_function_bind_set_bind_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetCopyFunctionBindInfoFromExternal(env, info[0]);
+    auto user_bind_data = info[1].As<Napi::Object>();
+    auto internal_bind_data = new CopyFunctionInternalBindData();
+    internal_bind_data->SetUserBindData(ref_reaper, user_bind_data);
+    duckdb_copy_function_bind_set_bind_data(bind_info, internal_bind_data, reinterpret_cast<duckdb_delete_callback_t>(DeleteCopyFunctionInternalBindData));
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_set_global_init(duckdb_copy_function copy_function, duckdb_copy_function_global_init_t init);
-  // TODO copy function
+  // function copy_function_set_global_init(copy_function: CopyFunction, func: CopyFunctionGlobalInitFunction): void
+  Napi::Value copy_function_set_global_init(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCopyFunctionHolderFromExternal(env, info[0]);
+    auto func = info[1].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetGlobalInitFunction(env, func);
+    duckdb_copy_function_set_global_init(holder->copy_function, &CopyFunctionGlobalInitFunction);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_global_init_set_error(duckdb_copy_function_global_init_info info, const char *error);
-  // TODO copy function
+  // function copy_function_global_init_set_error(global_init_info: CopyFunctionGlobalInitInfo, error: string): void
+  Napi::Value copy_function_global_init_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto global_init_info = GetCopyFunctionGlobalInitInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_copy_function_global_init_set_error(global_init_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_global_init_get_extra_info(duckdb_copy_function_global_init_info info);
-  // TODO copy function
+  // function copy_function_global_init_get_extra_info(global_init_info: CopyFunctionGlobalInitInfo): object | undefined
+  Napi::Value copy_function_global_init_get_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto global_init_info = GetCopyFunctionGlobalInitInfoFromExternal(env, info[0]);
+    auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_global_init_get_extra_info(global_init_info));
+    if (!internal_extra_info || !internal_extra_info->user_extra_info_ref) {
+      return env.Undefined();
+    }
+    return internal_extra_info->user_extra_info_ref->ref.Value();
+  }
 
   // DUCKDB_C_API duckdb_client_context duckdb_copy_function_global_init_get_client_context(duckdb_copy_function_global_init_info info);
-  // TODO copy function
+  // function copy_function_global_init_get_client_context(global_init_info: CopyFunctionGlobalInitInfo): ClientContext
+  Napi::Value copy_function_global_init_get_client_context(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto global_init_info = GetCopyFunctionGlobalInitInfoFromExternal(env, info[0]);
+    auto client_context = duckdb_copy_function_global_init_get_client_context(global_init_info);
+    if (!client_context) {
+      throw Napi::Error::New(env, "Failed to get client context");
+    }
+    return CreateExternalForClientContext(env, client_context);
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_global_init_get_bind_data(duckdb_copy_function_global_init_info info);
-  // TODO copy function
+  // function copy_function_global_init_get_bind_data(global_init_info: CopyFunctionGlobalInitInfo): object | undefined
+  Napi::Value copy_function_global_init_get_bind_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto global_init_info = GetCopyFunctionGlobalInitInfoFromExternal(env, info[0]);
+    auto internal_bind_data = reinterpret_cast<CopyFunctionInternalBindData*>(duckdb_copy_function_global_init_get_bind_data(global_init_info));
+    if (!internal_bind_data || !internal_bind_data->user_bind_data_ref) {
+      return env.Undefined();
+    }
+    return internal_bind_data->user_bind_data_ref->ref.Value();
+  }
 
   // DUCKDB_C_API const char *duckdb_copy_function_global_init_get_file_path(duckdb_copy_function_global_init_info info);
-  // TODO copy function
+  // function copy_function_global_init_get_file_path(global_init_info: CopyFunctionGlobalInitInfo): string
+  Napi::Value copy_function_global_init_get_file_path(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto global_init_info = GetCopyFunctionGlobalInitInfoFromExternal(env, info[0]);
+    auto file_path = duckdb_copy_function_global_init_get_file_path(global_init_info);
+    return Napi::String::New(env, file_path ? file_path : "");
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_global_init_set_global_state(duckdb_copy_function_global_init_info info, void *global_state, duckdb_delete_callback_t destructor);
-  // TODO copy function
+  // function copy_function_global_init_set_global_state(global_init_info: CopyFunctionGlobalInitInfo, global_state: object): void
+  Napi::Value copy_function_global_init_set_global_state(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto global_init_info = GetCopyFunctionGlobalInitInfoFromExternal(env, info[0]);
+    auto user_global_state = info[1].As<Napi::Object>();
+    auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_global_init_get_extra_info(global_init_info));
+    auto user_global_state_ref = user_global_state.IsUndefined() ? nullptr : MakeManagedObjectReference(ref_reaper, user_global_state);
+    // Replaces the empty global state set by CopyFunctionGlobalInitFunction,
+    // along with its writer, which has not been used yet.
+    auto internal_global_state = new CopyFunctionInternalGlobalState(internal_extra_info, user_global_state_ref);
+    duckdb_copy_function_global_init_set_global_state(global_init_info, internal_global_state, reinterpret_cast<duckdb_delete_callback_t>(DeleteCopyFunctionInternalGlobalState));
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_set_sink(duckdb_copy_function copy_function, duckdb_copy_function_sink_t function);
-  // TODO copy function
+  // function copy_function_set_sink(copy_function: CopyFunction, func: CopyFunctionSinkFunction): void
+  Napi::Value copy_function_set_sink(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCopyFunctionHolderFromExternal(env, info[0]);
+    auto func = info[1].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetSinkFunction(env, func);
+    duckdb_copy_function_set_sink(holder->copy_function, &CopyFunctionSinkFunction);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_sink_set_error(duckdb_copy_function_sink_info info, const char *error);
-  // TODO copy function
+  // function copy_function_sink_set_error(sink_info: CopyFunctionSinkInfo, error: string): void
+  Napi::Value copy_function_sink_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto sink_info = GetCopyFunctionSinkInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_copy_function_sink_set_error(sink_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_sink_get_extra_info(duckdb_copy_function_sink_info info);
-  // TODO copy function
+  // function copy_function_sink_get_extra_info(sink_info: CopyFunctionSinkInfo): object | undefined
+  Napi::Value copy_function_sink_get_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto sink_info = GetCopyFunctionSinkInfoFromExternal(env, info[0]);
+    auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_sink_get_extra_info(sink_info));
+    if (!internal_extra_info || !internal_extra_info->user_extra_info_ref) {
+      return env.Undefined();
+    }
+    return internal_extra_info->user_extra_info_ref->ref.Value();
+  }
 
   // DUCKDB_C_API duckdb_client_context duckdb_copy_function_sink_get_client_context(duckdb_copy_function_sink_info info);
-  // TODO copy function
+  // function copy_function_sink_get_client_context(sink_info: CopyFunctionSinkInfo): ClientContext
+  Napi::Value copy_function_sink_get_client_context(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto sink_info = GetCopyFunctionSinkInfoFromExternal(env, info[0]);
+    auto client_context = duckdb_copy_function_sink_get_client_context(sink_info);
+    if (!client_context) {
+      throw Napi::Error::New(env, "Failed to get client context");
+    }
+    return CreateExternalForClientContext(env, client_context);
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_sink_get_bind_data(duckdb_copy_function_sink_info info);
-  // TODO copy function
+  // function copy_function_sink_get_bind_data(sink_info: CopyFunctionSinkInfo): object | undefined
+  Napi::Value copy_function_sink_get_bind_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto sink_info = GetCopyFunctionSinkInfoFromExternal(env, info[0]);
+    auto internal_bind_data = reinterpret_cast<CopyFunctionInternalBindData*>(duckdb_copy_function_sink_get_bind_data(sink_info));
+    if (!internal_bind_data || !internal_bind_data->user_bind_data_ref) {
+      return env.Undefined();
+    }
+    return internal_bind_data->user_bind_data_ref->ref.Value();
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_sink_get_global_state(duckdb_copy_function_sink_info info);
-  // TODO copy function
+  // function copy_function_sink_get_global_state(sink_info: CopyFunctionSinkInfo): object | undefined
+  Napi::Value copy_function_sink_get_global_state(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto sink_info = GetCopyFunctionSinkInfoFromExternal(env, info[0]);
+    auto internal_global_state = reinterpret_cast<CopyFunctionInternalGlobalState*>(duckdb_copy_function_sink_get_global_state(sink_info));
+    if (!internal_global_state || !internal_global_state->user_global_state_ref) {
+      return env.Undefined();
+    }
+    return internal_global_state->user_global_state_ref->ref.Value();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_set_finalize(duckdb_copy_function copy_function, duckdb_copy_function_finalize_t finalize);
-  // TODO copy function
+  // function copy_function_set_finalize(copy_function: CopyFunction, func: CopyFunctionFinalizeFunction): void
+  Napi::Value copy_function_set_finalize(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCopyFunctionHolderFromExternal(env, info[0]);
+    auto func = info[1].As<Napi::Function>();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetFinalizeFunction(env, func);
+    duckdb_copy_function_set_finalize(holder->copy_function, &CopyFunctionFinalizeFunction);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_finalize_set_error(duckdb_copy_function_finalize_info info, const char *error);
-  // TODO copy function
+  // function copy_function_finalize_set_error(finalize_info: CopyFunctionFinalizeInfo, error: string): void
+  Napi::Value copy_function_finalize_set_error(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto finalize_info = GetCopyFunctionFinalizeInfoFromExternal(env, info[0]);
+    std::string error = info[1].As<Napi::String>();
+    duckdb_copy_function_finalize_set_error(finalize_info, error.c_str());
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_finalize_get_extra_info(duckdb_copy_function_finalize_info info);
-  // TODO copy function
+  // function copy_function_finalize_get_extra_info(finalize_info: CopyFunctionFinalizeInfo): object | undefined
+  Napi::Value copy_function_finalize_get_extra_info(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto finalize_info = GetCopyFunctionFinalizeInfoFromExternal(env, info[0]);
+    auto internal_extra_info = reinterpret_cast<CopyFunctionInternalExtraInfo*>(duckdb_copy_function_finalize_get_extra_info(finalize_info));
+    if (!internal_extra_info || !internal_extra_info->user_extra_info_ref) {
+      return env.Undefined();
+    }
+    return internal_extra_info->user_extra_info_ref->ref.Value();
+  }
 
   // DUCKDB_C_API duckdb_client_context duckdb_copy_function_finalize_get_client_context(duckdb_copy_function_finalize_info info);
-  // TODO copy function
+  // function copy_function_finalize_get_client_context(finalize_info: CopyFunctionFinalizeInfo): ClientContext
+  Napi::Value copy_function_finalize_get_client_context(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto finalize_info = GetCopyFunctionFinalizeInfoFromExternal(env, info[0]);
+    auto client_context = duckdb_copy_function_finalize_get_client_context(finalize_info);
+    if (!client_context) {
+      throw Napi::Error::New(env, "Failed to get client context");
+    }
+    return CreateExternalForClientContext(env, client_context);
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_finalize_get_bind_data(duckdb_copy_function_finalize_info info);
-  // TODO copy function
+  // function copy_function_finalize_get_bind_data(finalize_info: CopyFunctionFinalizeInfo): object | undefined
+  Napi::Value copy_function_finalize_get_bind_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto finalize_info = GetCopyFunctionFinalizeInfoFromExternal(env, info[0]);
+    auto internal_bind_data = reinterpret_cast<CopyFunctionInternalBindData*>(duckdb_copy_function_finalize_get_bind_data(finalize_info));
+    if (!internal_bind_data || !internal_bind_data->user_bind_data_ref) {
+      return env.Undefined();
+    }
+    return internal_bind_data->user_bind_data_ref->ref.Value();
+  }
 
   // DUCKDB_C_API void *duckdb_copy_function_finalize_get_global_state(duckdb_copy_function_finalize_info info);
-  // TODO copy function
+  // function copy_function_finalize_get_global_state(finalize_info: CopyFunctionFinalizeInfo): object | undefined
+  Napi::Value copy_function_finalize_get_global_state(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto finalize_info = GetCopyFunctionFinalizeInfoFromExternal(env, info[0]);
+    auto internal_global_state = reinterpret_cast<CopyFunctionInternalGlobalState*>(duckdb_copy_function_finalize_get_global_state(finalize_info));
+    if (!internal_global_state || !internal_global_state->user_global_state_ref) {
+      return env.Undefined();
+    }
+    return internal_global_state->user_global_state_ref->ref.Value();
+  }
 
   // DUCKDB_C_API void duckdb_copy_function_set_copy_from_function(duckdb_copy_function copy_function, duckdb_table_function table_function);
-  // TODO copy function
+  // function copy_function_set_copy_from_function(copy_function: CopyFunction, table_function: TableFunction): void
+  Napi::Value copy_function_set_copy_from_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto copy_function = GetCopyFunctionFromExternal(env, info[0]);
+    // The copy function keeps a copy of the table function, which shares its
+    // extra info, so the table function may be destroyed afterwards.
+    auto table_function = GetTableFunctionFromExternal(env, info[1]);
+    duckdb_copy_function_set_copy_from_function(copy_function, table_function);
+    return env.Undefined();
+  }
 
   // DUCKDB_C_API idx_t duckdb_table_function_bind_get_result_column_count(duckdb_bind_info info);
-  // TODO copy function
+  // function table_function_bind_get_result_column_count(bind_info: TableFunctionBindInfo): number
+  Napi::Value table_function_bind_get_result_column_count(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetTableFunctionBindInfoFromExternal(env, info[0]);
+    auto column_count = duckdb_table_function_bind_get_result_column_count(bind_info);
+    return Napi::Number::New(env, column_count);
+  }
 
   // DUCKDB_C_API const char *duckdb_table_function_bind_get_result_column_name(duckdb_bind_info info, idx_t col_idx);
-  // TODO copy function
+  // function table_function_bind_get_result_column_name(bind_info: TableFunctionBindInfo, column_index: number): string
+  Napi::Value table_function_bind_get_result_column_name(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetTableFunctionBindInfoFromExternal(env, info[0]);
+    auto column_index = info[1].As<Napi::Number>().Uint32Value();
+    auto column_name = duckdb_table_function_bind_get_result_column_name(bind_info, column_index);
+    if (!column_name) {
+      throw Napi::Error::New(env, "Failed to get result column name");
+    }
+    return Napi::String::New(env, column_name);
+  }
 
   // DUCKDB_C_API duckdb_logical_type duckdb_table_function_bind_get_result_column_type(duckdb_bind_info info, idx_t col_idx);
-  // TODO copy function
+  // function table_function_bind_get_result_column_type(bind_info: TableFunctionBindInfo, column_index: number): LogicalType
+  Napi::Value table_function_bind_get_result_column_type(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto bind_info = GetTableFunctionBindInfoFromExternal(env, info[0]);
+    auto column_index = info[1].As<Napi::Number>().Uint32Value();
+    auto logical_type = duckdb_table_function_bind_get_result_column_type(bind_info, column_index);
+    if (!logical_type) {
+      throw Napi::Error::New(env, "Failed to get result column type");
+    }
+    return CreateExternalForLogicalType(env, logical_type);
+  }
 
   // DUCKDB_C_API duckdb_catalog duckdb_client_context_get_catalog(duckdb_client_context context, const char *catalog_name);
   // TODO catalog
@@ -4571,6 +5592,416 @@ private:
     return env.Undefined();
   }
 
+  // ADDED
+  // function vector_set_null_mask(vector: Vector, null_mask: Uint8Array, row_count: number): void
+  Napi::Value vector_set_null_mask(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto vector = GetVectorFromExternal(env, info[0]);
+    auto null_mask_array = info[1].As<Napi::Uint8Array>();
+    auto row_count = info[2].As<Napi::Number>().Uint32Value();
+    if (null_mask_array.ElementLength() < row_count) {
+      throw Napi::Error::New(env, "Null mask is shorter than the row count");
+    }
+    auto null_mask = null_mask_array.Data();
+    // Validity is only allocated once a row is NULL, so a column with none
+    // stays without a mask. If one already exists, every row is written.
+    auto validity = duckdb_vector_get_validity(vector);
+    for (idx_t row = 0; row < row_count; row++) {
+      if (null_mask[row]) {
+        if (!validity) {
+          duckdb_vector_ensure_validity_writable(vector);
+          validity = duckdb_vector_get_validity(vector);
+        }
+        duckdb_validity_set_row_invalid(validity, row);
+      } else if (validity) {
+        duckdb_validity_set_row_valid(validity, row);
+      }
+    }
+    return env.Undefined();
+  }
+
+  typedef void (*AssignStringElementFunction)(duckdb_vector vector, idx_t index, const char *str, idx_t str_len);
+
+  static Napi::Value AssignStrings(const Napi::CallbackInfo& info, AssignStringElementFunction assign_string_element) {
+    auto env = info.Env();
+    auto vector = GetVectorFromExternal(env, info[0]);
+    auto start_index = info[1].As<Napi::Number>().Uint32Value();
+    auto array = info[2].As<Napi::Uint8Array>();
+    auto data = reinterpret_cast<const char *>(array.Data());
+    auto data_length = array.ByteLength();
+    auto offsets_array = info[3].As<Napi::Uint32Array>();
+    auto offsets = offsets_array.Data();
+    auto offset_count = offsets_array.ElementLength();
+    if (offset_count == 0) {
+      return env.Undefined();
+    }
+    // Validate all offsets before assigning any string, so a bad offset can
+    // neither read outside the data nor leave the vector partly assigned.
+    for (size_t i = 0; i < offset_count; i++) {
+      if (offsets[i] > data_length) {
+        throw Napi::Error::New(env, "Invalid offsets argument: offset exceeds data length");
+      }
+      if (i > 0 && offsets[i] < offsets[i - 1]) {
+        throw Napi::Error::New(env, "Invalid offsets argument: offsets must be non-decreasing");
+      }
+    }
+    for (size_t i = 0; i + 1 < offset_count; i++) {
+      assign_string_element(vector, start_index + i, data + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function vector_assign_strings(vector: Vector, start_index: number, data: Uint8Array, offsets: Uint32Array): void
+  Napi::Value vector_assign_strings(const Napi::CallbackInfo& info) {
+    return AssignStrings(info, duckdb_vector_assign_string_element_len);
+  }
+
+  // ADDED
+  // function unsafe_vector_assign_strings(vector: Vector, start_index: number, data: Uint8Array, offsets: Uint32Array): void
+  Napi::Value unsafe_vector_assign_strings(const Napi::CallbackInfo& info) {
+    return AssignStrings(info, duckdb_unsafe_vector_assign_string_element_len);
+  }
+
+  // ADDED
+  // function create_scalar_function_worker_pool(): ScalarFunctionWorkerPool
+  Napi::Value create_scalar_function_worker_pool(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    return CreateExternalForScalarFunctionWorkerPool(env, ScalarFunctionWorkerPool::Create());
+  }
+
+  // ADDED
+  // function scalar_function_worker_pool_get_id(pool: ScalarFunctionWorkerPool): number
+  Napi::Value scalar_function_worker_pool_get_id(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto pool = GetScalarFunctionWorkerPoolFromExternal(env, info[0]);
+    return Napi::Number::New(env, pool->Id());
+  }
+
+  // ADDED
+  // function scalar_function_worker_pool_attach(pool_id: number, func: ScalarFunctionWorkerMainFunction): void
+  Napi::Value scalar_function_worker_pool_attach(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto pool_id = info[0].As<Napi::Number>().Uint32Value();
+    auto func = info[1].As<Napi::Function>();
+    auto pool = ScalarFunctionWorkerPool::Find(pool_id);
+    if (!pool) {
+      throw Napi::Error::New(env, "Invalid pool id argument: no such scalar function worker pool");
+    }
+    pool->Attach(env, func);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function scalar_function_worker_pool_detach(pool_id: number): void
+  Napi::Value scalar_function_worker_pool_detach(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto pool_id = info[0].As<Napi::Number>().Uint32Value();
+    auto pool = ScalarFunctionWorkerPool::Find(pool_id);
+    if (pool) {
+      pool->Detach(env);
+    }
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function scalar_function_set_worker_pool(scalar_function: ScalarFunction, pool: ScalarFunctionWorkerPool): void
+  Napi::Value scalar_function_set_worker_pool(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetScalarFunctionHolderFromExternal(env, info[0]);
+    auto pool = GetScalarFunctionWorkerPoolFromExternal(env, info[1]);
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetWorkerPool(pool);
+    duckdb_scalar_function_set_function(holder->scalar_function, &ScalarFunctionMainFunction);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function load_native_library(path: string): NativeLibrary
+  Napi::Value load_native_library(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto path = info[0].As<Napi::String>().Utf8Value();
+    return CreateExternalForNativeLibrary(env, LoadNativeLibrary(env, path));
+  }
+
+  // ADDED
+  // function scalar_function_set_native_bind(scalar_function: ScalarFunction, library: NativeLibrary, symbol_name: string): void
+  Napi::Value scalar_function_set_native_bind(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto scalar_function = GetScalarFunctionFromExternal(env, info[0]);
+    auto bind = GetNativeLibraryFunction<duckdb_scalar_function_bind_t>(env, info[1], info[2]);
+    duckdb_scalar_function_set_bind(scalar_function, bind);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function scalar_function_set_native_function(scalar_function: ScalarFunction, library: NativeLibrary, symbol_name: string): void
+  Napi::Value scalar_function_set_native_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto scalar_function = GetScalarFunctionFromExternal(env, info[0]);
+    auto function = GetNativeLibraryFunction<duckdb_scalar_function_t>(env, info[1], info[2]);
+    duckdb_scalar_function_set_function(scalar_function, function);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_set_native_bind(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void
+  Napi::Value table_function_set_native_bind(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto table_function = GetTableFunctionFromExternal(env, info[0]);
+    auto bind = GetNativeLibraryFunction<duckdb_table_function_bind_t>(env, info[1], info[2]);
+    duckdb_table_function_set_bind(table_function, bind);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_set_native_init(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void
+  Napi::Value table_function_set_native_init(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto table_function = GetTableFunctionFromExternal(env, info[0]);
+    auto init = GetNativeLibraryFunction<duckdb_table_function_init_t>(env, info[1], info[2]);
+    duckdb_table_function_set_init(table_function, init);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_set_native_local_init(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void
+  Napi::Value table_function_set_native_local_init(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto table_function = GetTableFunctionFromExternal(env, info[0]);
+    auto init = GetNativeLibraryFunction<duckdb_table_function_init_t>(env, info[1], info[2]);
+    duckdb_table_function_set_local_init(table_function, init);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_set_native_function(table_function: TableFunction, library: NativeLibrary, symbol_name: string): void
+  Napi::Value table_function_set_native_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto table_function = GetTableFunctionFromExternal(env, info[0]);
+    auto function = GetNativeLibraryFunction<duckdb_table_function_t>(env, info[1], info[2]);
+    duckdb_table_function_set_function(table_function, function);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function cast_function_set_native_function(cast_function: CastFunction, library: NativeLibrary, symbol_name: string): void
+  Napi::Value cast_function_set_native_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto cast_function = GetCastFunctionFromExternal(env, info[0]);
+    auto function = GetNativeLibraryFunction<duckdb_cast_function_t>(env, info[1], info[2]);
+    duckdb_cast_function_set_function(cast_function, function);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function scalar_function_set_deduplicate_inputs(scalar_function: ScalarFunction, enabled: boolean): void
+  Napi::Value scalar_function_set_deduplicate_inputs(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetScalarFunctionHolderFromExternal(env, info[0]);
+    auto enabled = info[1].As<Napi::Boolean>().Value();
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetDeduplicateInputs(enabled);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function create_table_function_chunk_queue(capacity: number): TableFunctionChunkQueue
+  Napi::Value create_table_function_chunk_queue(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto capacity = info[0].As<Napi::Number>().Uint32Value();
+    return CreateExternalForTableFunctionChunkQueue(env, std::make_shared<TableFunctionChunkQueue>(ref_reaper, capacity));
+  }
+
+  // ADDED
+  // function table_function_chunk_queue_push(queue: TableFunctionChunkQueue, chunk: DataChunk): Promise<boolean>
+  Napi::Value table_function_chunk_queue_push(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto queue = GetTableFunctionChunkQueueFromExternal(env, info[0]);
+    auto chunk = GetDataChunkFromExternal(env, info[1]);
+    return queue->Push(env, chunk, info[1].As<Napi::Object>());
+  }
+
+  // ADDED
+  // function table_function_chunk_queue_close(queue: TableFunctionChunkQueue, error?: string): void
+  Napi::Value table_function_chunk_queue_close(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto queue = GetTableFunctionChunkQueueFromExternal(env, info[0]);
+    if (info.Length() > 1 && info[1].IsString()) {
+      std::string error = info[1].As<Napi::String>();
+      queue->Close(&error);
+    } else {
+      queue->Close(nullptr);
+    }
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function init_set_chunk_queue(init_info: TableFunctionInitInfo, queue: TableFunctionChunkQueue): void
+  Napi::Value init_set_chunk_queue(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto init_info = GetTableFunctionInitInfoFromExternal(env, info[0]);
+    auto queue = GetTableFunctionChunkQueueFromExternal(env, info[1]);
+    auto internal_init_data = new TableFunctionInternalInitData();
+    internal_init_data->chunk_queue = std::move(queue);
+    duckdb_init_set_init_data(init_info, internal_init_data, reinterpret_cast<duckdb_delete_callback_t>(DeleteTableFunctionInternalInitData));
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_set_chunk_queue_function(table_function: TableFunction): void
+  Napi::Value table_function_set_chunk_queue_function(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto table_function = GetTableFunctionFromExternal(env, info[0]);
+    duckdb_table_function_set_function(table_function, &TableFunctionChunkQueueMainFunction);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function create_table_function_worker_pool(): TableFunctionWorkerPool
+  Napi::Value create_table_function_worker_pool(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    return CreateExternalForTableFunctionWorkerPool(env, TableFunctionWorkerPool::Create());
+  }
+
+  // ADDED
+  // function table_function_worker_pool_get_id(pool: TableFunctionWorkerPool): number
+  Napi::Value table_function_worker_pool_get_id(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto pool = GetTableFunctionWorkerPoolFromExternal(env, info[0]);
+    return Napi::Number::New(env, pool->Id());
+  }
+
+  // ADDED
+  // function table_function_worker_pool_attach(pool_id: number, func: TableFunctionWorkerMainFunction): void
+  Napi::Value table_function_worker_pool_attach(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto pool_id = info[0].As<Napi::Number>().Uint32Value();
+    auto func = info[1].As<Napi::Function>();
+    auto pool = TableFunctionWorkerPool::Find(pool_id);
+    if (!pool) {
+      throw Napi::Error::New(env, "Invalid pool id argument: no such table function worker pool");
+    }
+    pool->Attach(env, func);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_worker_pool_detach(pool_id: number): void
+  Napi::Value table_function_worker_pool_detach(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto pool_id = info[0].As<Napi::Number>().Uint32Value();
+    auto pool = TableFunctionWorkerPool::Find(pool_id);
+    if (pool) {
+      pool->Detach(env);
+    }
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_set_worker_pool(table_function: TableFunction, pool: TableFunctionWorkerPool): void
+  Napi::Value table_function_set_worker_pool(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetTableFunctionHolderFromExternal(env, info[0]);
+    auto pool = GetTableFunctionWorkerPoolFromExternal(env, info[1]);
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetWorkerPool(pool);
+    duckdb_table_function_set_local_init(holder->table_function, &TableFunctionWorkerLocalInitFunction);
+    duckdb_table_function_set_function(holder->table_function, &TableFunctionWorkerMainFunction);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function init_set_worker_scan_data(init_info: TableFunctionInitInfo, data: string): void
+  Napi::Value init_set_worker_scan_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto init_info = GetTableFunctionInitInfoFromExternal(env, info[0]);
+    auto data = info[1].As<Napi::String>().Utf8Value();
+    auto internal_init_data = new TableFunctionInternalInitData();
+    internal_init_data->worker_scan_data = std::make_unique<std::string>(std::move(data));
+    duckdb_init_set_init_data(init_info, internal_init_data, reinterpret_cast<duckdb_delete_callback_t>(DeleteTableFunctionInternalInitData));
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_worker_scan_get_data(scan: TableFunctionWorkerScan): string | undefined
+  Napi::Value table_function_worker_scan_get_data(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto scan = GetTableFunctionWorkerScanFromExternal(env, info[0]);
+    if (!scan->global_init_data || !scan->global_init_data->worker_scan_data) {
+      return env.Undefined();
+    }
+    return Napi::String::New(env, *scan->global_init_data->worker_scan_data);
+  }
+
+  // ADDED
+  // function table_function_worker_scan_next_partition(scan: TableFunctionWorkerScan): number
+  Napi::Value table_function_worker_scan_next_partition(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto scan = GetTableFunctionWorkerScanFromExternal(env, info[0]);
+    if (!scan->global_init_data) {
+      throw Napi::Error::New(env, "No init data was set by the init function");
+    }
+    return Napi::Number::New(env, scan->global_init_data->next_partition++);
+  }
+
+  // ADDED
+  // function table_function_worker_scan_get_state(scan: TableFunctionWorkerScan): object | undefined
+  Napi::Value table_function_worker_scan_get_state(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto scan = GetTableFunctionWorkerScanFromExternal(env, info[0]);
+    if (!scan->user_state_ref) {
+      return env.Undefined();
+    }
+    return scan->user_state_ref->ref.Value();
+  }
+
+  // ADDED
+  // function table_function_worker_scan_set_state(scan: TableFunctionWorkerScan, state: object): void
+  Napi::Value table_function_worker_scan_set_state(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto scan = GetTableFunctionWorkerScanFromExternal(env, info[0]);
+    auto user_state = info[1].As<Napi::Object>();
+    scan->SetUserState(ref_reaper, user_state);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function table_function_set_typed_array_columns(table_function: TableFunction, columns: readonly TypedArrayTableColumn[]): void
+  Napi::Value table_function_set_typed_array_columns(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetTableFunctionHolderFromExternal(env, info[0]);
+    auto columns = info[1].As<Napi::Array>();
+    auto table = CreateTableFunctionTypedArrayTable(env, ref_reaper, columns);
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetTypedArrayTable(std::move(table));
+    duckdb_table_function_set_bind(holder->table_function, &TableFunctionTypedArrayBindFunction);
+    duckdb_table_function_set_init(holder->table_function, &TableFunctionTypedArrayInitFunction);
+    duckdb_table_function_set_function(holder->table_function, &TableFunctionTypedArrayMainFunction);
+    duckdb_table_function_supports_projection_pushdown(holder->table_function, true);
+    return env.Undefined();
+  }
+
+  // ADDED
+  // function copy_function_set_async_sink(copy_function: CopyFunction, sink: CopyFunctionAsyncSinkFunction, max_pending_chunks: number): void
+  Napi::Value copy_function_set_async_sink(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto holder = GetCopyFunctionHolderFromExternal(env, info[0]);
+    auto sink = info[1].As<Napi::Function>();
+    auto max_pending_chunks = info[2].As<Napi::Number>().Uint32Value();
+    if (max_pending_chunks == 0) {
+      throw Napi::Error::New(env, "max_pending_chunks must be positive");
+    }
+    holder->EnsureInternalExtraInfo(ref_reaper);
+    holder->internal_extra_info->SetAsyncSinkFunction(sink, max_pending_chunks);
+    // The native global init creates the global state the writer lives on, and
+    // the native finalize drains the writer before calling any JS finalize.
+    duckdb_copy_function_set_global_init(holder->copy_function, &CopyFunctionGlobalInitFunction);
+    duckdb_copy_function_set_sink(holder->copy_function, &CopyFunctionAsyncSinkFunction);
+    duckdb_copy_function_set_finalize(holder->copy_function, &CopyFunctionFinalizeFunction);
+    return env.Undefined();
+  }
+
 };
 
 NODE_API_ADDON(DuckDBNodeAddon)
@@ -4578,41 +6009,26 @@ NODE_API_ADDON(DuckDBNodeAddon)
 /*
 
 546 DUCKDB_C_API
-    306 function
-     26 not exposed
+    411 function
+     33 not exposed
      41 deprecated
-    173 TODO
+     61 TODO
         8 arrow
-        5 error data
-        2 utf8
+        1 utf8
         1 value to string
         1 register logical type
         3 vector manipulation
-        4 scalar function set
-        2 scalar function expression
-        7 scalar function init
         3 selection vector
-       12 aggregate function
-        4 aggregate function set
-        4 replacement scan
         5 profiling info
         1 appender create query
-        1 appender error data
-        1 appender clear
-        2 appender columns
-        1 appender default
         8 table description
         8 tasks
-       12 cast function
-        4 expression
-       16 file system
         9 config option
-       36 copy function
         7 catalog
         6 log storage
-  3 ADDED
+  37 ADDED
 ---
-549 total
+583 total
 
 regexes:
 // DUCKDB_C_API.*\n  // (function|not exposed|deprecated|TODO)
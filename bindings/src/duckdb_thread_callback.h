@@ -6,6 +6,7 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <string>
 
 // A JS function that DuckDB invokes from its own threads.
 //
@@ -30,10 +31,16 @@
 //  3. Replacing a callback releases the one it replaces, so repeatedly setting a
 //     callback does not accumulate thread-safe functions.
 //
+// A callback may return a promise, for I/O such as lookups against another
+// service. The DuckDB thread then keeps waiting until the promise settles, while
+// the JS thread returns to the event loop; calls from other DuckDB threads can
+// start in the meantime, so their I/O overlaps. A rejection is reported as the
+// call's error. A promise that never settles blocks its DuckDB thread for good.
+//
 // Traits supplies the per-callback details:
 //   using Payload = ...;                  // arguments for one call; copyable
 //   static const char *ResourceName();
-//   static void Call(Napi::Env, Napi::Function, const Payload &);
+//   static Napi::Value Call(Napi::Env, Napi::Function, const Payload &);
 //   static void SetError(const Payload &, const char *message);
 
 // One in-flight call, allocated by the calling DuckDB thread and freed by it once
@@ -46,27 +53,86 @@ struct DuckDBThreadCallbackCall {
   bool done;
 };
 
+template <typename Traits>
+void DuckDBThreadCallbackSignal(DuckDBThreadCallbackCall<Traits> *call) {
+  // Signal while still holding the lock. The waiting thread frees this call
+  // once it wakes, so notifying after releasing the lock would let it destroy
+  // the condition variable before notify_one touches it.
+  std::lock_guard<std::mutex> lock(*call->mutex);
+  call->done = true;
+  call->cv->notify_one();
+}
+
+inline std::string DuckDBThreadCallbackRejectionMessage(Napi::Value reason) {
+  try {
+    if (reason.IsObject()) {
+      auto message = reason.As<Napi::Object>().Get("message");
+      if (message.IsString()) {
+        return message.As<Napi::String>().Utf8Value();
+      }
+    }
+    return reason.ToString().Utf8Value();
+  } catch (const Napi::Error &) {
+    return "Promise rejected";
+  }
+}
+
+// Called on the JS thread. Signals the call once `promise` settles.
+template <typename Traits>
+void DuckDBThreadCallbackAwait(Napi::Env env, Napi::Object promise, DuckDBThreadCallbackCall<Traits> *call) {
+  auto on_fulfilled = Napi::Function::New(env, [call](const Napi::CallbackInfo &) {
+    DuckDBThreadCallbackSignal(call);
+  });
+  auto on_rejected = Napi::Function::New(env, [call](const Napi::CallbackInfo &info) {
+    Traits::SetError(call->payload, DuckDBThreadCallbackRejectionMessage(info[0]).c_str());
+    DuckDBThreadCallbackSignal(call);
+  });
+  promise.Get("then").As<Napi::Function>().Call(promise, { on_fulfilled, on_rejected });
+}
+
 template <typename Traits>
 void DuckDBThreadCallbackDispatch(Napi::Env env, Napi::Function callback, std::nullptr_t *,
                                   DuckDBThreadCallbackCall<Traits> *call) {
   // env is null when the thread-safe function is draining during teardown. The
   // JS function cannot run then, but the waiting DuckDB thread must still be
-  // released, so the signalling below is unconditional.
+  // released, so the signalling below is unconditional unless the call has
+  // been handed to a promise, which then signals instead.
   if (env != nullptr && callback != nullptr) {
     try {
-      Traits::Call(env, callback, call->payload);
+      auto result = Traits::Call(env, callback, call->payload);
+      if (result.IsPromise()) {
+        DuckDBThreadCallbackAwait<Traits>(env, result.As<Napi::Object>(), call);
+        return;
+      }
     } catch (const Napi::Error &error) {
       Traits::SetError(call->payload, error.Message().c_str());
     }
   }
-  {
-    // Signal while still holding the lock. The waiting thread frees this call
-    // once it wakes, so notifying after releasing the lock would let it destroy
-    // the condition variable before notify_one touches it.
-    std::lock_guard<std::mutex> lock(*call->mutex);
-    call->done = true;
-    call->cv->notify_one();
+  DuckDBThreadCallbackSignal(call);
+}
+
+// Called on a DuckDB thread. Hands one call to `queue`, which returns whether it
+// queued the call on a thread-safe function, and if it did, blocks until the call
+// has completed. Returns what `queue` returned.
+template <typename Traits, typename Queue>
+bool DuckDBThreadCallbackRun(const typename Traits::Payload &payload, Queue queue) {
+  auto call = reinterpret_cast<DuckDBThreadCallbackCall<Traits>*>(duckdb_malloc(sizeof(DuckDBThreadCallbackCall<Traits>)));
+  call->payload = payload;
+  call->cv = new std::condition_variable;
+  call->mutex = new std::mutex;
+  call->done = false;
+  // The "blocking" part of BlockingCall only waits for queue space, and the
+  // queue is unlimited, so it never actually blocks. Waiting for the JS
+  // function to run is the wait below.
+  auto queued = queue(call);
+  if (queued) {
+    std::unique_lock<std::mutex> lock(*call->mutex);
+    call->cv->wait(lock, [call] { return call->done; });
   }
+  delete call->cv;
+  delete call->mutex;
+  duckdb_free(call);
+  return queued;
 }
 
 template <typename Traits>
@@ -103,23 +169,12 @@ public:
     if (!tsfn) {
       return;
     }
-    auto call = reinterpret_cast<DuckDBThreadCallbackCall<Traits>*>(duckdb_malloc(sizeof(DuckDBThreadCallbackCall<Traits>)));
-    call->payload = payload;
-    call->cv = new std::condition_variable;
-    call->mutex = new std::mutex;
-    call->done = false;
-    // The "blocking" part of BlockingCall only waits for queue space, and the
-    // queue is unlimited, so it never actually blocks. Waiting for the JS
-    // function to run is the wait below.
-    if (tsfn->BlockingCall(call) == napi_ok) {
-      std::unique_lock<std::mutex> lock(*call->mutex);
-      call->cv->wait(lock, [call] { return call->done; });
-    } else {
+    auto queued = DuckDBThreadCallbackRun<Traits>(payload, [this](DuckDBThreadCallbackCall<Traits> *call) {
+      return tsfn->BlockingCall(call) == napi_ok;
+    });
+    if (!queued) {
       Traits::SetError(payload, "BlockingCall returned not ok");
     }
-    delete call->cv;
-    delete call->mutex;
-    duckdb_free(call);
   }
 
 private:
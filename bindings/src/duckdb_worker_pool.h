@@ -0,0 +1,223 @@
+#pragma once
+
+#include "napi_setup.h"
+#include "duckdb_thread_callback.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Worker pools
+//
+// A callback runs on the JS thread of the env that set it, so however many
+// threads DuckDB scans with, the JS work of one function uses one core. A worker
+// pool hands calls to functions attached from other envs -- in practice,
+// worker_threads -- each of which runs on its own thread.
+//
+// The pool is created on the JS thread that registers the function. An external
+// cannot cross into a worker, so pools are also registered process-wide by a
+// numeric id, which is what a worker passes to attach its function. Each Traits
+// type has its own registry and ids.
+//
+// Each attached function gets a thread-safe function created in the worker's env.
+// The rules in duckdb_thread_callback.h apply, with two differences:
+//
+//  - Rule 1 is inverted: the thread-safe function stays referenced. A worker that
+//    has attached exists to serve calls, so it should stay alive until it
+//    detaches, rather than exit as soon as its own script has run.
+//  - Rule 2 is enforced per member rather than per env, because the pool
+//    outlives the worker envs attached to it. A cleanup hook in the worker's env
+//    closes its members before Node destroys their thread-safe functions. Closing
+//    takes the same lock that calls are queued under, so no call is queued after
+//    that point; calls already queued are drained by Node, which releases the
+//    DuckDB threads waiting on them.
+//
+// Traits is as for DuckDBThreadCallback.
+
+template <typename Traits>
+class DuckDBWorkerPoolMember {
+
+public:
+
+  using TSFN = typename DuckDBThreadCallback<Traits>::TSFN;
+
+  // Called on the worker's JS thread.
+  DuckDBWorkerPoolMember(Napi::Env env, Napi::Function func)
+    : env(env), tsfn(TSFN::New(env, func, Traits::ResourceName(), 0, 1)), open(true) {}
+
+  DuckDBWorkerPoolMember(const DuckDBWorkerPoolMember &) = delete;
+  DuckDBWorkerPoolMember &operator=(const DuckDBWorkerPoolMember &) = delete;
+
+  napi_env Env() const {
+    return env;
+  }
+
+  // Called on a DuckDB thread. Returns false if the member is closed.
+  bool Queue(DuckDBThreadCallbackCall<Traits> *call) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return open && tsfn.BlockingCall(call) == napi_ok;
+  }
+
+  // Called on a DuckDB thread. Blocks until this member's worker has run the
+  // call. Returns false, without calling, if the member is closed.
+  bool Invoke(const typename Traits::Payload &payload) {
+    return DuckDBThreadCallbackRun<Traits>(payload, [this](DuckDBThreadCallbackCall<Traits> *call) {
+      return Queue(call);
+    });
+  }
+
+  // Called from any thread; releasing a thread-safe function is thread-safe, and
+  // the lock orders this against the worker's cleanup hook.
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!open) {
+      return;
+    }
+    open = false;
+    tsfn.Release();
+  }
+
+private:
+
+  napi_env env;
+  std::mutex mutex;
+  TSFN tsfn;
+  bool open;
+
+};
+
+template <typename Traits>
+class DuckDBWorkerPool : public std::enable_shared_from_this<DuckDBWorkerPool<Traits>> {
+
+public:
+
+  using Member = DuckDBWorkerPoolMember<Traits>;
+
+  explicit DuckDBWorkerPool(uint32_t id_in) : id(id_in), next_member(0) {}
+
+  ~DuckDBWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(RegistryMutex());
+      Registry().erase(id);
+    }
+    for (auto &member : members) {
+      member->Close();
+    }
+  }
+
+  DuckDBWorkerPool(const DuckDBWorkerPool &) = delete;
+  DuckDBWorkerPool &operator=(const DuckDBWorkerPool &) = delete;
+
+  // Called on the registering JS thread.
+  static std::shared_ptr<DuckDBWorkerPool> Create() {
+    static std::atomic<uint32_t> next_id(1);
+    auto pool = std::make_shared<DuckDBWorkerPool>(next_id++);
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    Registry()[pool->id] = pool;
+    return pool;
+  }
+
+  // Called on any JS thread. Returns null if no live pool has this id.
+  static std::shared_ptr<DuckDBWorkerPool> Find(uint32_t id) {
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    auto it = Registry().find(id);
+    return it == Registry().end() ? nullptr : it->second.lock();
+  }
+
+  uint32_t Id() const {
+    return id;
+  }
+
+  // Called on the worker's JS thread.
+  void Attach(Napi::Env env, Napi::Function func) {
+    auto member = std::make_shared<Member>(env, func);
+    std::weak_ptr<DuckDBWorkerPool> weak_pool = this->weak_from_this();
+    // Registered after the thread-safe function was created, so it runs before
+    // Node's own cleanup of it: hooks run in reverse order of registration.
+    env.AddCleanupHook([weak_pool, member]() {
+      member->Close();
+      if (auto pool = weak_pool.lock()) {
+        pool->Remove(member.get());
+      }
+    });
+    std::lock_guard<std::mutex> lock(mutex);
+    members.push_back(member);
+  }
+
+  // Called on the worker's JS thread. Detaches every function that env attached.
+  void Detach(napi_env env) {
+    std::vector<std::shared_ptr<Member>> detached;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto it = members.begin(); it != members.end();) {
+        if ((*it)->Env() == env) {
+          detached.push_back(*it);
+          it = members.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    for (auto &member : detached) {
+      member->Close();
+    }
+  }
+
+  // Called on a DuckDB thread. Returns the next member round-robin, or null if
+  // none is attached.
+  std::shared_ptr<Member> NextMember() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (members.empty()) {
+      return nullptr;
+    }
+    return members[next_member++ % members.size()];
+  }
+
+  // Called on a DuckDB thread. Blocks until some worker has run the call.
+  // Returns false, without calling, if no worker is attached.
+  bool Invoke(const typename Traits::Payload &payload) {
+    return DuckDBThreadCallbackRun<Traits>(payload, [this](DuckDBThreadCallbackCall<Traits> *call) {
+      // A member can close between being picked and being called, when its
+      // worker exits, so move on to the next one until a call is queued or
+      // every member has been tried.
+      std::shared_ptr<Member> member;
+      while ((member = NextMember())) {
+        if (member->Queue(call)) {
+          return true;
+        }
+        Remove(member.get());
+      }
+      return false;
+    });
+  }
+
+private:
+
+  static std::mutex &RegistryMutex() {
+    static std::mutex registry_mutex;
+    return registry_mutex;
+  }
+
+  static std::map<uint32_t, std::weak_ptr<DuckDBWorkerPool>> &Registry() {
+    static std::map<uint32_t, std::weak_ptr<DuckDBWorkerPool>> registry;
+    return registry;
+  }
+
+  void Remove(Member *member) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = members.begin(); it != members.end(); ++it) {
+      if (it->get() == member) {
+        members.erase(it);
+        return;
+      }
+    }
+  }
+
+  uint32_t id;
+  std::mutex mutex;
+  std::vector<std::shared_ptr<Member>> members;
+  size_t next_member;
+
+};
@@ -3,6 +3,7 @@
 #include "napi_setup.h"
 #include "duckdb.h"
 #include "type_tags.h"
+#include <string>
 
 // Externals
 
@@ -146,6 +147,52 @@ inline duckdb_data_chunk GetDataChunkFromExternal(Napi::Env env, Napi::Value val
   return GetDataFromExternal<_duckdb_data_chunk>(env, DataChunkTypeTag, value, "Invalid data chunk argument");
 }
 
+inline void FinalizeErrorData(Napi::BasicEnv, duckdb_error_data error_data) {
+  if (error_data) {
+    duckdb_destroy_error_data(&error_data);
+    error_data = nullptr;
+  }
+}
+
+inline Napi::External<_duckdb_error_data> CreateExternalForErrorData(Napi::Env env, duckdb_error_data error_data) {
+  return CreateExternal<_duckdb_error_data>(env, ErrorDataTypeTag, error_data, FinalizeErrorData);
+}
+
+inline duckdb_error_data GetErrorDataFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_error_data>(env, ErrorDataTypeTag, value, "Invalid error data argument");
+}
+
+// Throws the error in error_data, or fallback_message if it holds none. Takes
+// ownership of error_data, which may be null.
+[[noreturn]] inline void ThrowErrorData(Napi::Env env, duckdb_error_data error_data, const char *fallback_message) {
+  std::string message = fallback_message;
+  if (error_data) {
+    if (duckdb_error_data_has_error(error_data)) {
+      message = duckdb_error_data_message(error_data);
+    }
+    duckdb_destroy_error_data(&error_data);
+  }
+  throw Napi::Error::New(env, message);
+}
+
+// An expression handle wraps a reference to an expression owned by the binder,
+// so it is only meaningful during the bind callback it was obtained in.
+// Destroying it frees just the wrapper, which is safe at any time.
+inline void FinalizeExpression(Napi::BasicEnv, duckdb_expression expression) {
+  if (expression) {
+    duckdb_destroy_expression(&expression);
+    expression = nullptr;
+  }
+}
+
+inline Napi::External<_duckdb_expression> CreateExternalForExpression(Napi::Env env, duckdb_expression expression) {
+  return CreateExternal<_duckdb_expression>(env, ExpressionTypeTag, expression, FinalizeExpression);
+}
+
+inline duckdb_expression GetExpressionFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_expression>(env, ExpressionTypeTag, value, "Invalid expression argument");
+}
+
 inline void FinalizeExtractedStatements(Napi::BasicEnv, duckdb_extracted_statements extracted_statements) {
   if (extracted_statements) {
     duckdb_destroy_extracted(&extracted_statements);
@@ -161,6 +208,51 @@ inline duckdb_extracted_statements GetExtractedStatementsFromExternal(Napi::Env
   return GetDataFromExternal<_duckdb_extracted_statements>(env, ExtractedStatementsTypeTag, value, "Invalid extracted statements argument");
 }
 
+inline void FinalizeFileHandle(Napi::BasicEnv, duckdb_file_handle file_handle) {
+  if (file_handle) {
+    duckdb_destroy_file_handle(&file_handle);
+    file_handle = nullptr;
+  }
+}
+
+inline Napi::External<_duckdb_file_handle> CreateExternalForFileHandle(Napi::Env env, duckdb_file_handle file_handle) {
+  return CreateExternal<_duckdb_file_handle>(env, FileHandleTypeTag, file_handle, FinalizeFileHandle);
+}
+
+inline duckdb_file_handle GetFileHandleFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_file_handle>(env, FileHandleTypeTag, value, "Invalid file handle argument");
+}
+
+inline void FinalizeFileOpenOptions(Napi::BasicEnv, duckdb_file_open_options file_open_options) {
+  if (file_open_options) {
+    duckdb_destroy_file_open_options(&file_open_options);
+    file_open_options = nullptr;
+  }
+}
+
+inline Napi::External<_duckdb_file_open_options> CreateExternalForFileOpenOptions(Napi::Env env, duckdb_file_open_options file_open_options) {
+  return CreateExternal<_duckdb_file_open_options>(env, FileOpenOptionsTypeTag, file_open_options, FinalizeFileOpenOptions);
+}
+
+inline duckdb_file_open_options GetFileOpenOptionsFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_file_open_options>(env, FileOpenOptionsTypeTag, value, "Invalid file open options argument");
+}
+
+inline void FinalizeFileSystem(Napi::BasicEnv, duckdb_file_system file_system) {
+  if (file_system) {
+    duckdb_destroy_file_system(&file_system);
+    file_system = nullptr;
+  }
+}
+
+inline Napi::External<_duckdb_file_system> CreateExternalForFileSystem(Napi::Env env, duckdb_file_system file_system) {
+  return CreateExternal<_duckdb_file_system>(env, FileSystemTypeTag, file_system, FinalizeFileSystem);
+}
+
+inline duckdb_file_system GetFileSystemFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_file_system>(env, FileSystemTypeTag, value, "Invalid file system argument");
+}
+
 inline void FinalizeInstanceCache(Napi::BasicEnv, duckdb_instance_cache instance_cache) {
   duckdb_destroy_instance_cache(&instance_cache);
 }
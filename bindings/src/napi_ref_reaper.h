@@ -147,6 +147,33 @@ public:
     }
   }
 
+  // Runs work(env) on the JS thread at some later point. Safe to call from any
+  // thread, including the JS thread itself, and from finalizers. This is for
+  // cleanup that has to call into JS, which neither a DuckDB thread nor a
+  // finalizer can do directly. Work posted once the env is going away is dropped
+  // without running, as are references in that case. Work must not throw.
+  template <typename Work>
+  void Post(Work work) {
+    auto work_ptr = new Work(std::move(work));
+    {
+      // See Destroy for why the call is made under the lock.
+      std::lock_guard<std::mutex> lock(mutex);
+      if (alive) {
+        auto status = tsfn.NonBlockingCall([work_ptr](Napi::Env env, Napi::Function) {
+          (*work_ptr)(env);
+          delete work_ptr;
+        });
+        if (status == napi_ok) {
+          return;
+        }
+        alive = false;
+      }
+    }
+    // Outside the lock: what the work captures may include managed references,
+    // and destroying the last of those calls Destroy, which takes the lock.
+    delete work_ptr;
+  }
+
 private:
 
   // The reference can no longer be deleted safely from any thread, so leaking it
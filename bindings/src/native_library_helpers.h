@@ -0,0 +1,63 @@
+#pragma once
+
+#include "napi_setup.h"
+#include "externals.h"
+#include "type_tags.h"
+#include <string>
+#include <uv.h>
+
+// Native libraries
+//
+// Shared libraries whose exported C functions are handed to DuckDB directly as
+// function callbacks. DuckDB then calls them on its own threads, without the
+// thread-safe function hop to the JS thread that JS callbacks take.
+//
+// Loading goes through libuv, which is what Node uses to load addons, so paths
+// and errors behave the same on every platform.
+//
+// A library is never unloaded. A function registered with a connection keeps
+// its callbacks long after the JS object for the library is collected, and
+// nothing tracks when the last of them goes away, so closing the library from
+// the finalizer could leave DuckDB calling into unmapped code. The finalizer
+// frees only the holder.
+
+struct NativeLibraryHolder {
+  uv_lib_t lib;
+};
+
+inline void FinalizeNativeLibraryHolder(Napi::BasicEnv, NativeLibraryHolder *holder) {
+  delete holder;
+}
+
+inline Napi::External<NativeLibraryHolder> CreateExternalForNativeLibrary(Napi::Env env, NativeLibraryHolder *holder) {
+  return CreateExternal<NativeLibraryHolder>(env, NativeLibraryTypeTag, holder, FinalizeNativeLibraryHolder);
+}
+
+inline NativeLibraryHolder *GetNativeLibraryHolderFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<NativeLibraryHolder>(env, NativeLibraryTypeTag, value, "Invalid native library argument");
+}
+
+inline NativeLibraryHolder *LoadNativeLibrary(Napi::Env env, const std::string &path) {
+  auto holder = new NativeLibraryHolder();
+  if (uv_dlopen(path.c_str(), &holder->lib)) {
+    std::string message = std::string("Failed to load native library: ") + uv_dlerror(&holder->lib);
+    uv_dlclose(&holder->lib); // frees the error message
+    delete holder;
+    throw Napi::Error::New(env, message);
+  }
+  return holder;
+}
+
+// Looks up `symbol_name` in the library and casts it to the callback type T. The
+// cast cannot be checked: a symbol with the wrong signature is undefined behavior
+// when DuckDB calls it.
+template<typename T>
+T GetNativeLibraryFunction(Napi::Env env, Napi::Value library_value, Napi::Value symbol_name_value) {
+  auto holder = GetNativeLibraryHolderFromExternal(env, library_value);
+  auto symbol_name = symbol_name_value.As<Napi::String>().Utf8Value();
+  void *symbol = nullptr;
+  if (uv_dlsym(&holder->lib, symbol_name.c_str(), &symbol) || !symbol) {
+    throw Napi::Error::New(env, std::string("Symbol not found in native library: ") + symbol_name);
+  }
+  return reinterpret_cast<T>(symbol);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "externals.h"
+#include "duckdb_thread_callback.h"
+#include "type_tags.h"
+#include "napi_ref_reaper.h"
+#include <string>
+
+// Replacement scans
+//
+// A replacement scan is called while a query is bound, with the name of each
+// table the catalog cannot find, and may replace it with a call to a table
+// function. Binding happens on whatever thread runs the query, so the JS
+// callback goes through DuckDBThreadCallback like a function family's bind.
+//
+// Replacement scans are registered on a database and cannot be removed. The
+// extra data holding the callback is deleted when the database closes.
+
+// Info external
+//
+// Only valid during the callback it is passed to.
+
+inline Napi::External<_duckdb_replacement_scan_info> CreateExternalForReplacementScanInfo(Napi::Env env, duckdb_replacement_scan_info info) {
+  return CreateExternalWithoutFinalizer<_duckdb_replacement_scan_info>(env, ReplacementScanInfoTypeTag, info);
+}
+
+inline duckdb_replacement_scan_info GetReplacementScanInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_replacement_scan_info>(env, ReplacementScanInfoTypeTag, value, "Invalid replacement scan info argument");
+}
+
+// Callback
+
+struct ReplacementScanCallbackTraits {
+  struct Payload {
+    duckdb_replacement_scan_info info;
+    // Owned by DuckDB, and valid until the waiting thread returns.
+    const char *table_name;
+  };
+
+  static const char *ResourceName() {
+    return "ReplacementScan";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForReplacementScanInfo(env, payload.info),
+        Napi::String::New(env, payload.table_name)
+      }
+    );
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_replacement_scan_set_error(payload.info, message);
+  }
+};
+
+// Extra data
+
+struct ReplacementScanInternalExtraData {
+  DuckDBThreadCallback<ReplacementScanCallbackTraits> callback;
+
+  explicit ReplacementScanInternalExtraData(const std::shared_ptr<NapiRefReaper> &env_state)
+    : callback(env_state) {}
+};
+
+inline void DeleteReplacementScanInternalExtraData(ReplacementScanInternalExtraData *internal_extra_data) {
+  delete internal_extra_data;
+}
+
+// Entry point handed to DuckDB
+
+inline void ReplacementScanFunction(duckdb_replacement_scan_info info, const char *table_name, void *data) {
+  reinterpret_cast<ReplacementScanInternalExtraData*>(data)->callback.Invoke({info, table_name});
+}
@@ -2,9 +2,14 @@
 
 #include "externals.h"
 #include "duckdb_thread_callback.h"
+#include "duckdb_worker_pool.h"
 #include "type_tags.h"
 #include "napi_ref_reaper.h"
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // Scalar functions
 //
@@ -15,13 +20,13 @@
 
 // Info externals
 //
-// These wrap duckdb_bind_info and duckdb_function_info, which the C API also
-// reuses for other function families. The struct behind each handle differs per
-// family and is reinterpret_cast with no check, so a scalar handle passed to a
-// table function accessor would corrupt memory. The per-family tags make that a
-// thrown error instead.
+// These wrap duckdb_bind_info, duckdb_init_info and duckdb_function_info, which
+// the C API also reuses for other function families. The struct behind each
+// handle differs per family and is reinterpret_cast with no check, so a scalar
+// handle passed to a table function accessor would corrupt memory. The
+// per-family tags make that a thrown error instead.
 //
-// Neither is ever created explicitly; both are passed in to callbacks.
+// None is ever created explicitly; all are passed in to callbacks.
 
 inline Napi::External<_duckdb_bind_info> CreateExternalForScalarFunctionBindInfo(Napi::Env env, duckdb_bind_info bind_info) {
   return CreateExternalWithoutFinalizer<_duckdb_bind_info>(env, ScalarFunctionBindInfoTypeTag, bind_info);
@@ -31,6 +36,14 @@ inline duckdb_bind_info GetScalarFunctionBindInfoFromExternal(Napi::Env env, Nap
   return GetDataFromExternal<_duckdb_bind_info>(env, ScalarFunctionBindInfoTypeTag, value, "Invalid scalar function bind info argument");
 }
 
+inline Napi::External<_duckdb_init_info> CreateExternalForScalarFunctionInitInfo(Napi::Env env, duckdb_init_info init_info) {
+  return CreateExternalWithoutFinalizer<_duckdb_init_info>(env, ScalarFunctionInitInfoTypeTag, init_info);
+}
+
+inline duckdb_init_info GetScalarFunctionInitInfoFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_init_info>(env, ScalarFunctionInitInfoTypeTag, value, "Invalid scalar function init info argument");
+}
+
 inline Napi::External<_duckdb_function_info> CreateExternalForScalarFunctionInfo(Napi::Env env, duckdb_function_info function_info) {
   return CreateExternalWithoutFinalizer<_duckdb_function_info>(env, ScalarFunctionInfoTypeTag, function_info);
 }
@@ -48,8 +61,8 @@ struct ScalarFunctionBindCallbackTraits {
     return "ScalarFunctionBind";
   }
 
-  static void Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
-    callback.Call(
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
       env.Undefined(),
       {
         CreateExternalForScalarFunctionBindInfo(env, payload)
@@ -62,6 +75,27 @@ struct ScalarFunctionBindCallbackTraits {
   }
 };
 
+struct ScalarFunctionInitCallbackTraits {
+  using Payload = duckdb_init_info;
+
+  static const char *ResourceName() {
+    return "ScalarFunctionInit";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForScalarFunctionInitInfo(env, payload)
+      }
+    );
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_scalar_function_init_set_error(payload, message);
+  }
+};
+
 struct ScalarFunctionMainCallbackTraits {
   struct Payload {
     duckdb_function_info info;
@@ -73,8 +107,8 @@ struct ScalarFunctionMainCallbackTraits {
     return "ScalarFunctionMain";
   }
 
-  static void Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
-    callback.Call(
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
       env.Undefined(),
       {
         CreateExternalForScalarFunctionInfo(env, payload.info),
@@ -89,22 +123,87 @@ struct ScalarFunctionMainCallbackTraits {
   }
 };
 
+// Worker pools
+//
+// A worker pool spreads main calls round-robin over functions attached from
+// worker_threads; see duckdb_worker_pool.h.
+//
+// A worker's function receives only the input chunk and output vector. The
+// function info is not passed because its extra info and bind data are
+// references into the registering env, which cannot be used from another.
+
+struct ScalarFunctionWorkerCallbackTraits {
+  using Payload = ScalarFunctionMainCallbackTraits::Payload;
+
+  static const char *ResourceName() {
+    return "ScalarFunctionWorker";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
+      env.Undefined(),
+      {
+        CreateExternalForDataChunkWithoutFinalizer(env, payload.input),
+        CreateExternalForVectorWithoutFinalizer(env, payload.output)
+      }
+    );
+  }
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_scalar_function_set_error(payload.info, message);
+  }
+};
+
+using ScalarFunctionWorkerPool = DuckDBWorkerPool<ScalarFunctionWorkerCallbackTraits>;
+
+struct ScalarFunctionWorkerPoolHolder {
+  std::shared_ptr<ScalarFunctionWorkerPool> pool;
+};
+
+inline void FinalizeScalarFunctionWorkerPoolHolder(Napi::BasicEnv, ScalarFunctionWorkerPoolHolder *holder) {
+  delete holder;
+}
+
+inline Napi::External<ScalarFunctionWorkerPoolHolder> CreateExternalForScalarFunctionWorkerPool(Napi::Env env, std::shared_ptr<ScalarFunctionWorkerPool> pool) {
+  return CreateExternal<ScalarFunctionWorkerPoolHolder>(env, ScalarFunctionWorkerPoolTypeTag, new ScalarFunctionWorkerPoolHolder{std::move(pool)}, FinalizeScalarFunctionWorkerPoolHolder);
+}
+
+inline std::shared_ptr<ScalarFunctionWorkerPool> GetScalarFunctionWorkerPoolFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<ScalarFunctionWorkerPoolHolder>(env, ScalarFunctionWorkerPoolTypeTag, value, "Invalid scalar function worker pool argument")->pool;
+}
+
 // Extra info
 
 struct ScalarFunctionInternalExtraInfo {
   DuckDBThreadCallback<ScalarFunctionBindCallbackTraits> bind_callback;
+  DuckDBThreadCallback<ScalarFunctionInitCallbackTraits> init_callback;
   DuckDBThreadCallback<ScalarFunctionMainCallbackTraits> main_callback;
+  std::shared_ptr<ScalarFunctionWorkerPool> worker_pool;
   std::shared_ptr<ManagedObjectReference> user_extra_info_ref;
+  bool deduplicate_inputs = false;
 
   explicit ScalarFunctionInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state)
-    : bind_callback(env_state), main_callback(env_state) {}
+    : bind_callback(env_state), init_callback(env_state), main_callback(env_state) {}
 
   void SetBindFunction(Napi::Env env, Napi::Function func) {
     bind_callback.Set(env, func);
   }
 
+  void SetInitFunction(Napi::Env env, Napi::Function func) {
+    init_callback.Set(env, func);
+  }
+
   void SetMainFunction(Napi::Env env, Napi::Function func) {
     main_callback.Set(env, func);
+    worker_pool.reset();
+  }
+
+  void SetWorkerPool(std::shared_ptr<ScalarFunctionWorkerPool> pool) {
+    worker_pool = std::move(pool);
+  }
+
+  void SetDeduplicateInputs(bool enabled) {
+    deduplicate_inputs = enabled;
   }
 
   void SetUserExtraInfo(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_extra_info) {
@@ -158,6 +257,25 @@ inline duckdb_scalar_function GetScalarFunctionFromExternal(Napi::Env env, Napi:
   return GetScalarFunctionHolderFromExternal(env, value)->scalar_function;
 }
 
+// Set external
+//
+// Adding a function to a set copies it, and the copy shares the function's
+// internal extra info, so each overload keeps its own callbacks. Parameter and
+// return types are fixed when the function is added, but callbacks and extra
+// info set on the function afterwards still reach the copy.
+
+inline void FinalizeScalarFunctionSet(Napi::BasicEnv, duckdb_scalar_function_set scalar_function_set) {
+  duckdb_destroy_scalar_function_set(&scalar_function_set);
+}
+
+inline Napi::External<_duckdb_scalar_function_set> CreateExternalForScalarFunctionSet(Napi::Env env, duckdb_scalar_function_set scalar_function_set) {
+  return CreateExternal<_duckdb_scalar_function_set>(env, ScalarFunctionSetTypeTag, scalar_function_set, FinalizeScalarFunctionSet);
+}
+
+inline duckdb_scalar_function_set GetScalarFunctionSetFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<_duckdb_scalar_function_set>(env, ScalarFunctionSetTypeTag, value, "Invalid scalar function set argument");
+}
+
 // Bind data
 
 struct ScalarFunctionInternalBindData {
@@ -193,6 +311,209 @@ inline ScalarFunctionInternalBindData *CopyScalarFunctionInternalBindData(Scalar
   return new_internal_bind_data;
 }
 
+// State
+//
+// Set by the init function, which DuckDB calls once per thread executing the
+// bound expression, so unlike bind data each thread gets its own and no copy
+// callback is needed. Deleted on whatever thread tears the state down; dropping
+// the reference hands it to the reaper, as for bind data.
+
+struct ScalarFunctionInternalState {
+  std::shared_ptr<ManagedObjectReference> user_state_ref;
+
+  void SetUserState(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_state) {
+    user_state_ref = user_state.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_state);
+  }
+};
+
+inline void DeleteScalarFunctionInternalState(ScalarFunctionInternalState *internal_state) {
+  delete internal_state;
+}
+
+// Deduplicated inputs
+//
+// DuckDB flattens the input chunk before calling a C API scalar function, so a
+// constant or dictionary input arrives as its values repeated row by row, and
+// which it was is not visible here. A function that opts in has its input rows
+// deduplicated instead: the main function is called with only the distinct rows
+// and a scratch output, whose results are then copied out to every row. For
+// low-cardinality inputs -- constants, enums, status strings -- that is one JS
+// call per distinct value rather than per row.
+//
+// Rows are compared by their bytes, so only types whose values are held entirely
+// in the vector or in the string they point to are supported. With any other
+// column type, or once more than half the rows turn out distinct, the chunk is
+// passed through as it is.
+
+// Returns the size of a value of the given type, 0 for strings, or -1 if values
+// of the type cannot be compared by their bytes.
+inline int64_t GetDeduplicatedInputValueSize(duckdb_type type_id) {
+  switch (type_id) {
+    case DUCKDB_TYPE_BOOLEAN:
+    case DUCKDB_TYPE_TINYINT:
+    case DUCKDB_TYPE_UTINYINT:
+      return 1;
+    case DUCKDB_TYPE_SMALLINT:
+    case DUCKDB_TYPE_USMALLINT:
+      return 2;
+    case DUCKDB_TYPE_INTEGER:
+    case DUCKDB_TYPE_UINTEGER:
+    case DUCKDB_TYPE_FLOAT:
+    case DUCKDB_TYPE_DATE:
+      return 4;
+    case DUCKDB_TYPE_BIGINT:
+    case DUCKDB_TYPE_UBIGINT:
+    case DUCKDB_TYPE_DOUBLE:
+    case DUCKDB_TYPE_TIME:
+    case DUCKDB_TYPE_TIME_TZ:
+    case DUCKDB_TYPE_TIMESTAMP:
+    case DUCKDB_TYPE_TIMESTAMP_S:
+    case DUCKDB_TYPE_TIMESTAMP_MS:
+    case DUCKDB_TYPE_TIMESTAMP_NS:
+    case DUCKDB_TYPE_TIMESTAMP_TZ:
+      return 8;
+    case DUCKDB_TYPE_INTERVAL:
+    case DUCKDB_TYPE_HUGEINT:
+    case DUCKDB_TYPE_UHUGEINT:
+    case DUCKDB_TYPE_UUID:
+      return 16;
+    case DUCKDB_TYPE_VARCHAR:
+    case DUCKDB_TYPE_BLOB:
+      return 0;
+    default:
+      return -1;
+  }
+}
+
+inline int64_t GetDeduplicatedInputValueSize(duckdb_logical_type logical_type) {
+  auto type_id = duckdb_get_type_id(logical_type);
+  switch (type_id) {
+    case DUCKDB_TYPE_DECIMAL:
+      return GetDeduplicatedInputValueSize(duckdb_decimal_internal_type(logical_type));
+    case DUCKDB_TYPE_ENUM:
+      return GetDeduplicatedInputValueSize(duckdb_enum_internal_type(logical_type));
+    default:
+      return GetDeduplicatedInputValueSize(type_id);
+  }
+}
+
+// Owns the C API objects used while deduplicating one chunk.
+struct DeduplicatedInputs {
+  std::vector<duckdb_logical_type> column_types;
+  duckdb_selection_vector distinct_rows = nullptr;
+  duckdb_selection_vector row_indexes = nullptr;
+  duckdb_data_chunk input = nullptr;
+  duckdb_logical_type output_type = nullptr;
+  duckdb_vector output = nullptr;
+
+  ~DeduplicatedInputs() {
+    for (auto &column_type : column_types) {
+      duckdb_destroy_logical_type(&column_type);
+    }
+    if (distinct_rows) {
+      duckdb_destroy_selection_vector(distinct_rows);
+    }
+    if (row_indexes) {
+      duckdb_destroy_selection_vector(row_indexes);
+    }
+    if (input) {
+      duckdb_destroy_data_chunk(&input);
+    }
+    if (output_type) {
+      duckdb_destroy_logical_type(&output_type);
+    }
+    if (output) {
+      duckdb_destroy_vector(&output);
+    }
+  }
+};
+
+// Calls `invoke` with the distinct rows of `input` and a scratch output, then
+// copies each row's result from the scratch output to `output`. Returns false,
+// without calling `invoke`, if the chunk is passed through instead.
+template<typename Invoke>
+bool InvokeWithDeduplicatedInputs(duckdb_data_chunk input, duckdb_vector output, Invoke invoke) {
+  auto row_count = duckdb_data_chunk_get_size(input);
+  auto column_count = duckdb_data_chunk_get_column_count(input);
+  if (row_count < 2 || column_count == 0) {
+    return false;
+  }
+
+  struct Column {
+    duckdb_vector vector;
+    char *data;
+    uint64_t *validity;
+    int64_t value_size;
+  };
+  DeduplicatedInputs deduplicated;
+  std::vector<Column> columns;
+  columns.reserve(column_count);
+  for (idx_t column_index = 0; column_index < column_count; column_index++) {
+    auto vector = duckdb_data_chunk_get_vector(input, column_index);
+    auto column_type = duckdb_vector_get_column_type(vector);
+    deduplicated.column_types.push_back(column_type);
+    auto value_size = GetDeduplicatedInputValueSize(column_type);
+    if (value_size < 0) {
+      return false;
+    }
+    columns.push_back({
+      vector,
+      reinterpret_cast<char*>(duckdb_vector_get_data(vector)),
+      duckdb_vector_get_validity(vector),
+      value_size
+    });
+  }
+
+  deduplicated.distinct_rows = duckdb_create_selection_vector(row_count);
+  deduplicated.row_indexes = duckdb_create_selection_vector(row_count);
+  auto distinct_rows = duckdb_selection_vector_get_data_ptr(deduplicated.distinct_rows);
+  auto row_indexes = duckdb_selection_vector_get_data_ptr(deduplicated.row_indexes);
+  std::unordered_map<std::string, sel_t> distinct_indexes;
+  distinct_indexes.reserve(row_count);
+  idx_t distinct_count = 0;
+  std::string key;
+  for (idx_t row_index = 0; row_index < row_count; row_index++) {
+    key.clear();
+    for (auto &column : columns) {
+      if (column.validity && !duckdb_validity_row_is_valid(column.validity, row_index)) {
+        key.push_back('\0');
+        continue;
+      }
+      key.push_back('\1');
+      if (column.value_size > 0) {
+        key.append(column.data + row_index * column.value_size, column.value_size);
+      } else {
+        auto string = reinterpret_cast<duckdb_string_t*>(column.data) + row_index;
+        auto length = duckdb_string_t_length(*string);
+        key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        key.append(duckdb_string_t_data(string), length);
+      }
+    }
+    auto emplaced = distinct_indexes.emplace(key, static_cast<sel_t>(distinct_count));
+    if (emplaced.second) {
+      if (++distinct_count * 2 > row_count) {
+        return false;
+      }
+      distinct_rows[distinct_count - 1] = static_cast<sel_t>(row_index);
+    }
+    row_indexes[row_index] = emplaced.first->second;
+  }
+
+  deduplicated.input = duckdb_create_data_chunk(deduplicated.column_types.data(), column_count);
+  for (idx_t column_index = 0; column_index < column_count; column_index++) {
+    auto distinct_vector = duckdb_data_chunk_get_vector(deduplicated.input, column_index);
+    duckdb_vector_copy_sel(columns[column_index].vector, distinct_vector, deduplicated.distinct_rows, distinct_count, 0, 0);
+  }
+  duckdb_data_chunk_set_size(deduplicated.input, distinct_count);
+  deduplicated.output_type = duckdb_vector_get_column_type(output);
+  deduplicated.output = duckdb_create_vector(deduplicated.output_type, distinct_count);
+
+  invoke(deduplicated.input, deduplicated.output);
+
+  duckdb_vector_copy_sel(deduplicated.output, output, deduplicated.row_indexes, row_count, 0, 0);
+  return true;
+}
+
 // Entry points handed to DuckDB
 
 inline ScalarFunctionInternalExtraInfo *GetScalarFunctionInternalExtraInfoFromBindInfo(duckdb_bind_info bind_info) {
@@ -203,10 +524,31 @@ inline void ScalarFunctionBindFunction(duckdb_bind_info info) {
   GetScalarFunctionInternalExtraInfoFromBindInfo(info)->bind_callback.Invoke(info);
 }
 
+inline ScalarFunctionInternalExtraInfo *GetScalarFunctionInternalExtraInfoFromInitInfo(duckdb_init_info init_info) {
+  return reinterpret_cast<ScalarFunctionInternalExtraInfo*>(duckdb_scalar_function_init_get_extra_info(init_info));
+}
+
+inline void ScalarFunctionInitFunction(duckdb_init_info info) {
+  GetScalarFunctionInternalExtraInfoFromInitInfo(info)->init_callback.Invoke(info);
+}
+
 inline ScalarFunctionInternalExtraInfo *GetScalarFunctionInternalExtraInfoFromFunctionInfo(duckdb_function_info function_info) {
   return reinterpret_cast<ScalarFunctionInternalExtraInfo*>(duckdb_scalar_function_get_extra_info(function_info));
 }
 
 inline void ScalarFunctionMainFunction(duckdb_function_info info, duckdb_data_chunk input, duckdb_vector output) {
-  GetScalarFunctionInternalExtraInfoFromFunctionInfo(info)->main_callback.Invoke({info, input, output});
+  auto internal_extra_info = GetScalarFunctionInternalExtraInfoFromFunctionInfo(info);
+  auto invoke = [internal_extra_info, info](duckdb_data_chunk input, duckdb_vector output) {
+    if (internal_extra_info->worker_pool) {
+      if (!internal_extra_info->worker_pool->Invoke({info, input, output})) {
+        duckdb_scalar_function_set_error(info, "No workers attached to scalar function worker pool");
+      }
+    } else {
+      internal_extra_info->main_callback.Invoke({info, input, output});
+    }
+  };
+  if (internal_extra_info->deduplicate_inputs && InvokeWithDeduplicatedInputs(input, output, invoke)) {
+    return;
+  }
+  invoke(input, output);
 }
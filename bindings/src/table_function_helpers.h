@@ -2,9 +2,18 @@
 
 #include "externals.h"
 #include "duckdb_thread_callback.h"
+#include "duckdb_worker_pool.h"
 #include "type_tags.h"
 #include "napi_ref_reaper.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 // Table functions
 //
@@ -59,8 +68,8 @@ struct TableFunctionBindCallbackTraits {
     return "TableFunctionBind";
   }
 
-  static void Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
-    callback.Call(
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
       env.Undefined(),
       {
         CreateExternalForTableFunctionBindInfo(env, payload)
@@ -80,8 +89,8 @@ struct TableFunctionInitCallbackTraits {
     return "TableFunctionInit";
   }
 
-  static void Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
-    callback.Call(
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
       env.Undefined(),
       {
         CreateExternalForTableFunctionInitInfo(env, payload)
@@ -101,8 +110,8 @@ struct TableFunctionLocalInitCallbackTraits {
     return "TableFunctionLocalInit";
   }
 
-  static void Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
-    callback.Call(
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
       env.Undefined(),
       {
         CreateExternalForTableFunctionInitInfo(env, payload)
@@ -125,8 +134,8 @@ struct TableFunctionMainCallbackTraits {
     return "TableFunctionMain";
   }
 
-  static void Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
-    callback.Call(
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+    return callback.Call(
       env.Undefined(),
       {
         CreateExternalForTableFunctionInfo(env, payload.info),
@@ -140,6 +149,259 @@ struct TableFunctionMainCallbackTraits {
   }
 };
 
+// Worker pools
+//
+// Every main call of a scan runs on the registering JS thread, so setting max
+// threads above one only overlaps the waits of async main functions. A table
+// function given a worker pool (see duckdb_worker_pool.h) instead binds each
+// DuckDB thread of the scan to one worker when that thread's local init runs, and
+// runs all of that thread's main calls on that worker, so a partitioned source is
+// read on as many cores as there are workers.
+//
+// Local init and main become native entry points. Bind and the global init still
+// run on the registering thread; the init sets max threads, and the scan data: a
+// string every worker can read. Workers share no JS state, so they divide the
+// work by claiming partition numbers from a counter in the global init data.
+//
+// A worker keeps per-thread state, such as an open file, on its scan. The state
+// is referenced through the worker's own reaper, so that deleting the local init
+// data on a DuckDB thread destroys it on the worker's JS thread.
+
+struct TableFunctionInternalInitData;
+struct TableFunctionWorkerScan;
+
+struct TableFunctionWorkerCallbackTraits {
+  struct Payload {
+    duckdb_function_info info;
+    duckdb_data_chunk output;
+    TableFunctionWorkerScan *scan;
+  };
+
+  static const char *ResourceName() {
+    return "TableFunctionWorker";
+  }
+
+  static Napi::Value Call(Napi::Env env, Napi::Function callback, const Payload &payload);
+
+  static void SetError(const Payload &payload, const char *message) {
+    duckdb_function_set_error(payload.info, message);
+  }
+};
+
+using TableFunctionWorkerPool = DuckDBWorkerPool<TableFunctionWorkerCallbackTraits>;
+
+struct TableFunctionWorkerPoolHolder {
+  std::shared_ptr<TableFunctionWorkerPool> pool;
+};
+
+inline void FinalizeTableFunctionWorkerPoolHolder(Napi::BasicEnv, TableFunctionWorkerPoolHolder *holder) {
+  delete holder;
+}
+
+inline Napi::External<TableFunctionWorkerPoolHolder> CreateExternalForTableFunctionWorkerPool(Napi::Env env, std::shared_ptr<TableFunctionWorkerPool> pool) {
+  return CreateExternal<TableFunctionWorkerPoolHolder>(env, TableFunctionWorkerPoolTypeTag, new TableFunctionWorkerPoolHolder{std::move(pool)}, FinalizeTableFunctionWorkerPoolHolder);
+}
+
+inline std::shared_ptr<TableFunctionWorkerPool> GetTableFunctionWorkerPoolFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<TableFunctionWorkerPoolHolder>(env, TableFunctionWorkerPoolTypeTag, value, "Invalid table function worker pool argument")->pool;
+}
+
+// The local init data of one DuckDB thread of the scan. Its external is only
+// valid during the main call it is passed to.
+struct TableFunctionWorkerScan {
+  std::shared_ptr<TableFunctionWorkerPool::Member> member;
+  // Set before each main call. DuckDB deletes the global init data after every
+  // thread's local init data, so this is valid while the scan is.
+  TableFunctionInternalInitData *global_init_data = nullptr;
+  std::shared_ptr<ManagedObjectReference> user_state_ref;
+
+  void SetUserState(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_state) {
+    user_state_ref = user_state.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_state);
+  }
+};
+
+inline void DeleteTableFunctionWorkerScan(TableFunctionWorkerScan *scan) {
+  delete scan;
+}
+
+inline Napi::External<TableFunctionWorkerScan> CreateExternalForTableFunctionWorkerScan(Napi::Env env, TableFunctionWorkerScan *scan) {
+  return CreateExternalWithoutFinalizer<TableFunctionWorkerScan>(env, TableFunctionWorkerScanTypeTag, scan);
+}
+
+inline TableFunctionWorkerScan *GetTableFunctionWorkerScanFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<TableFunctionWorkerScan>(env, TableFunctionWorkerScanTypeTag, value, "Invalid table function worker scan argument");
+}
+
+inline Napi::Value TableFunctionWorkerCallbackTraits::Call(Napi::Env env, Napi::Function callback, const Payload &payload) {
+  return callback.Call(
+    env.Undefined(),
+    {
+      CreateExternalForTableFunctionWorkerScan(env, payload.scan),
+      CreateExternalForDataChunkWithoutFinalizer(env, payload.output)
+    }
+  );
+}
+
+// Typed array tables
+//
+// A table whose columns are typed arrays already in memory needs no JS to scan
+// it, so all three callbacks are native and run on DuckDB's own threads, with no
+// hop to the JS thread at all. Each main call claims the next vector-sized range
+// of rows from a counter in the global init data, and copies that range of each
+// projected column straight from the array into the output vector.
+//
+// The arrays are referenced through the reaper for as long as the table function
+// is, which keeps their buffers alive. Getting an array's data pointer also moves
+// any data V8 kept on its heap into a buffer of its own, so the pointer stays
+// valid. What cannot be prevented is JS transferring or resizing a buffer, or
+// writing to it during a scan; callers must not.
+//
+// Numeric columns take their type from the array's element type. VARCHAR columns
+// are UTF-8 bytes in a Uint8Array and a Uint32Array of one more offset than there
+// are rows, as for vector_assign_strings. Any column can have a null mask, with
+// one byte per row, nonzero for NULL.
+
+struct TableFunctionTypedArrayColumn {
+  std::string name;
+  duckdb_type type;
+  const uint8_t *data;
+  size_t element_size;
+  // VARCHAR only.
+  const uint32_t *offsets;
+  // Optional.
+  const uint8_t *null_mask;
+
+  // Called on a DuckDB thread.
+  void Write(duckdb_vector vector, idx_t start, idx_t count) const {
+    if (type == DUCKDB_TYPE_VARCHAR) {
+      for (idx_t row = 0; row < count; row++) {
+        if (null_mask && null_mask[start + row]) {
+          continue;
+        }
+        auto begin = offsets[start + row];
+        auto end = offsets[start + row + 1];
+        duckdb_vector_assign_string_element_len(vector, row, reinterpret_cast<const char *>(data) + begin, end - begin);
+      }
+    } else {
+      memcpy(duckdb_vector_get_data(vector), data + start * element_size, count * element_size);
+    }
+    if (null_mask) {
+      uint64_t *validity = nullptr;
+      for (idx_t row = 0; row < count; row++) {
+        if (null_mask[start + row]) {
+          if (!validity) {
+            duckdb_vector_ensure_validity_writable(vector);
+            validity = duckdb_vector_get_validity(vector);
+          }
+          duckdb_validity_set_row_invalid(validity, row);
+        }
+      }
+    }
+  }
+};
+
+struct TableFunctionTypedArrayTable {
+  std::vector<TableFunctionTypedArrayColumn> columns;
+  idx_t row_count = 0;
+  std::vector<std::shared_ptr<ManagedObjectReference>> array_refs;
+};
+
+inline const uint8_t *GetTypedArrayData(Napi::TypedArray array) {
+  return static_cast<const uint8_t *>(array.ArrayBuffer().Data()) + array.ByteOffset();
+}
+
+inline duckdb_type GetTypedArrayElementType(napi_typedarray_type typedarray_type) {
+  switch (typedarray_type) {
+    case napi_int8_array: return DUCKDB_TYPE_TINYINT;
+    case napi_uint8_array: return DUCKDB_TYPE_UTINYINT;
+    case napi_uint8_clamped_array: return DUCKDB_TYPE_UTINYINT;
+    case napi_int16_array: return DUCKDB_TYPE_SMALLINT;
+    case napi_uint16_array: return DUCKDB_TYPE_USMALLINT;
+    case napi_int32_array: return DUCKDB_TYPE_INTEGER;
+    case napi_uint32_array: return DUCKDB_TYPE_UINTEGER;
+    case napi_float32_array: return DUCKDB_TYPE_FLOAT;
+    case napi_float64_array: return DUCKDB_TYPE_DOUBLE;
+    case napi_bigint64_array: return DUCKDB_TYPE_BIGINT;
+    case napi_biguint64_array: return DUCKDB_TYPE_UBIGINT;
+    default: return DUCKDB_TYPE_INVALID;
+  }
+}
+
+// Called on the JS thread. Throws if a column is malformed, or if the columns
+// have different row counts.
+inline std::shared_ptr<TableFunctionTypedArrayTable> CreateTableFunctionTypedArrayTable(Napi::Env env, const std::shared_ptr<NapiRefReaper> &reaper, Napi::Array columns_array) {
+  auto table = std::make_shared<TableFunctionTypedArrayTable>();
+  auto column_count = columns_array.Length();
+  if (column_count == 0) {
+    throw Napi::Error::New(env, "Typed array table must have at least one column");
+  }
+  for (uint32_t i = 0; i < column_count; i++) {
+    auto column_object = columns_array.Get(i).As<Napi::Object>();
+    TableFunctionTypedArrayColumn column;
+    column.name = column_object.Get("name").As<Napi::String>().Utf8Value();
+    auto data_value = column_object.Get("data");
+    if (!data_value.IsTypedArray()) {
+      throw Napi::Error::New(env, "Invalid typed array column '" + column.name + "': data must be a typed array");
+    }
+    auto data_array = data_value.As<Napi::TypedArray>();
+    column.data = GetTypedArrayData(data_array);
+    column.element_size = data_array.ElementSize();
+    table->array_refs.push_back(MakeManagedObjectReference(reaper, data_array));
+    idx_t row_count;
+    auto offsets_value = column_object.Get("offsets");
+    if (offsets_value.IsUndefined()) {
+      column.type = GetTypedArrayElementType(data_array.TypedArrayType());
+      if (column.type == DUCKDB_TYPE_INVALID) {
+        throw Napi::Error::New(env, "Invalid typed array column '" + column.name + "': unsupported typed array type");
+      }
+      column.offsets = nullptr;
+      row_count = data_array.ElementLength();
+    } else {
+      if (data_array.TypedArrayType() != napi_uint8_array || !offsets_value.IsTypedArray()
+          || offsets_value.As<Napi::TypedArray>().TypedArrayType() != napi_uint32_array) {
+        throw Napi::Error::New(env, "Invalid typed array column '" + column.name + "': strings must be a Uint8Array with Uint32Array offsets");
+      }
+      auto offsets_array = offsets_value.As<Napi::Uint32Array>();
+      if (offsets_array.ElementLength() == 0) {
+        throw Napi::Error::New(env, "Invalid typed array column '" + column.name + "': offsets must not be empty");
+      }
+      // Checked once here, so the scan can trust them.
+      auto offsets = offsets_array.Data();
+      auto offset_count = offsets_array.ElementLength();
+      for (size_t offset = 0; offset + 1 < offset_count; offset++) {
+        if (offsets[offset + 1] < offsets[offset]) {
+          throw Napi::Error::New(env, "Invalid typed array column '" + column.name + "': offsets must be non-decreasing");
+        }
+      }
+      if (offsets[offset_count - 1] > data_array.ByteLength()) {
+        throw Napi::Error::New(env, "Invalid typed array column '" + column.name + "': end offset exceeds data length");
+      }
+      column.type = DUCKDB_TYPE_VARCHAR;
+      column.offsets = offsets;
+      table->array_refs.push_back(MakeManagedObjectReference(reaper, offsets_array));
+      row_count = offset_count - 1;
+    }
+    auto null_mask_value = column_object.Get("null_mask");
+    if (null_mask_value.IsUndefined()) {
+      column.null_mask = nullptr;
+    } else {
+      auto null_mask_array = null_mask_value.As<Napi::Uint8Array>();
+      if (null_mask_array.ElementLength() < row_count) {
+        throw Napi::Error::New(env, "Invalid typed array column '" + column.name + "': null mask is shorter than the row count");
+      }
+      column.null_mask = null_mask_array.Data();
+      table->array_refs.push_back(MakeManagedObjectReference(reaper, null_mask_array));
+    }
+    if (i == 0) {
+      table->row_count = row_count;
+    } else if (row_count != table->row_count) {
+      throw Napi::Error::New(env, "Typed array columns have different row counts");
+    }
+    table->columns.push_back(std::move(column));
+  }
+  return table;
+}
+
 // Extra info
 
 struct TableFunctionInternalExtraInfo {
@@ -147,6 +409,8 @@ struct TableFunctionInternalExtraInfo {
   DuckDBThreadCallback<TableFunctionInitCallbackTraits> init_callback;
   DuckDBThreadCallback<TableFunctionLocalInitCallbackTraits> local_init_callback;
   DuckDBThreadCallback<TableFunctionMainCallbackTraits> main_callback;
+  std::shared_ptr<TableFunctionWorkerPool> worker_pool;
+  std::shared_ptr<const TableFunctionTypedArrayTable> typed_array_table;
   std::shared_ptr<ManagedObjectReference> user_extra_info_ref;
 
   explicit TableFunctionInternalExtraInfo(const std::shared_ptr<NapiRefReaper> &env_state)
@@ -168,6 +432,14 @@ struct TableFunctionInternalExtraInfo {
     main_callback.Set(env, func);
   }
 
+  void SetWorkerPool(std::shared_ptr<TableFunctionWorkerPool> pool) {
+    worker_pool = std::move(pool);
+  }
+
+  void SetTypedArrayTable(std::shared_ptr<const TableFunctionTypedArrayTable> table) {
+    typed_array_table = std::move(table);
+  }
+
   void SetUserExtraInfo(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_extra_info) {
     user_extra_info_ref = user_extra_info.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_extra_info);
   }
@@ -219,6 +491,262 @@ inline duckdb_table_function GetTableFunctionFromExternal(Napi::Env env, Napi::V
   return GetTableFunctionHolderFromExternal(env, value)->table_function;
 }
 
+// Chunk queues
+//
+// A main callback blocks its DuckDB thread until JS has filled the chunk, so a
+// scan runs no faster than JS answers each call in turn. A chunk queue lets JS
+// produce ahead instead: JS pushes filled chunks into it at its own pace, and a
+// native main function pops them without calling into JS at all. DuckDB only
+// waits when the queue is empty, and JS only when it is full.
+//
+// Pushing takes a reference to the chunk's external rather than copying it.
+// Popping references the chunk's vectors from the output chunk, which shares
+// their buffers, so the chunk's memory lives on after the JS object is
+// collected, and the reference is then dropped through the reaper.
+//
+// The init function hands the queue to DuckDB as the scan's init data. When the
+// scan ends, early or not, deleting the init data cancels the queue, and the
+// producer's pending and later pushes resolve to false.
+
+// Whether two logical types have the same layout in a vector. Comparing type ids
+// is not enough: a DECIMAL's width picks its physical type, an ENUM's dictionary
+// size picks its index type, and nested types lay out their children by their
+// own types. Referencing a vector of another layout would read its buffers wrong.
+inline bool LogicalTypesMatch(duckdb_logical_type a, duckdb_logical_type b);
+
+// Compares the child types returned by get_child for a and b, destroying them.
+template <typename GetChild>
+inline bool ChildLogicalTypesMatch(duckdb_logical_type a, duckdb_logical_type b, GetChild get_child) {
+  auto a_child = get_child(a);
+  auto b_child = get_child(b);
+  auto match = LogicalTypesMatch(a_child, b_child);
+  duckdb_destroy_logical_type(&a_child);
+  duckdb_destroy_logical_type(&b_child);
+  return match;
+}
+
+// Compares two names returned by the C API, freeing them.
+inline bool LogicalTypeNamesMatch(char *a_name, char *b_name) {
+  auto match = a_name && b_name && strcmp(a_name, b_name) == 0;
+  duckdb_free(a_name);
+  duckdb_free(b_name);
+  return match;
+}
+
+inline bool LogicalTypesMatch(duckdb_logical_type a, duckdb_logical_type b) {
+  auto type_id = duckdb_get_type_id(a);
+  if (duckdb_get_type_id(b) != type_id) {
+    return false;
+  }
+  switch (type_id) {
+  case DUCKDB_TYPE_DECIMAL:
+    return duckdb_decimal_width(a) == duckdb_decimal_width(b) && duckdb_decimal_scale(a) == duckdb_decimal_scale(b);
+  case DUCKDB_TYPE_ENUM: {
+    auto size = duckdb_enum_dictionary_size(a);
+    if (duckdb_enum_dictionary_size(b) != size) {
+      return false;
+    }
+    for (uint32_t index = 0; index < size; index++) {
+      if (!LogicalTypeNamesMatch(duckdb_enum_dictionary_value(a, index), duckdb_enum_dictionary_value(b, index))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  case DUCKDB_TYPE_LIST:
+    return ChildLogicalTypesMatch(a, b, duckdb_list_type_child_type);
+  case DUCKDB_TYPE_ARRAY:
+    return duckdb_array_type_array_size(a) == duckdb_array_type_array_size(b)
+      && ChildLogicalTypesMatch(a, b, duckdb_array_type_child_type);
+  case DUCKDB_TYPE_MAP:
+    return ChildLogicalTypesMatch(a, b, duckdb_map_type_key_type)
+      && ChildLogicalTypesMatch(a, b, duckdb_map_type_value_type);
+  case DUCKDB_TYPE_STRUCT: {
+    auto count = duckdb_struct_type_child_count(a);
+    if (duckdb_struct_type_child_count(b) != count) {
+      return false;
+    }
+    for (idx_t index = 0; index < count; index++) {
+      if (!LogicalTypeNamesMatch(duckdb_struct_type_child_name(a, index), duckdb_struct_type_child_name(b, index))
+        || !ChildLogicalTypesMatch(a, b, [index](duckdb_logical_type type) { return duckdb_struct_type_child_type(type, index); })) {
+        return false;
+      }
+    }
+    return true;
+  }
+  case DUCKDB_TYPE_UNION: {
+    auto count = duckdb_union_type_member_count(a);
+    if (duckdb_union_type_member_count(b) != count) {
+      return false;
+    }
+    for (idx_t index = 0; index < count; index++) {
+      if (!LogicalTypeNamesMatch(duckdb_union_type_member_name(a, index), duckdb_union_type_member_name(b, index))
+        || !ChildLogicalTypesMatch(a, b, [index](duckdb_logical_type type) { return duckdb_union_type_member_type(type, index); })) {
+        return false;
+      }
+    }
+    return true;
+  }
+  default:
+    return true;
+  }
+}
+
+class TableFunctionChunkQueue {
+
+public:
+
+  TableFunctionChunkQueue(std::shared_ptr<NapiRefReaper> reaper_in, size_t capacity_in)
+    : reaper(std::move(reaper_in)), capacity(capacity_in > 0 ? capacity_in : 1) {}
+
+  // Called on the JS thread. Resolves to true once there is room for another
+  // chunk, or to false if the scan no longer wants chunks.
+  Napi::Value Push(Napi::Env env, duckdb_data_chunk chunk, Napi::Object chunk_external) {
+    auto deferred = Napi::Promise::Deferred::New(env);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (space_waiter) {
+      throw Napi::Error::New(env, "Previous push has not resolved");
+    }
+    if (cancelled || closed) {
+      deferred.Resolve(Napi::Boolean::New(env, false));
+      return deferred.Promise();
+    }
+    entries.push_back({chunk, MakeManagedObjectReference(reaper, chunk_external)});
+    cv.notify_one();
+    if (entries.size() < capacity) {
+      deferred.Resolve(Napi::Boolean::New(env, true));
+    } else {
+      space_waiter = std::make_unique<Napi::Promise::Deferred>(deferred);
+    }
+    return deferred.Promise();
+  }
+
+  // Called on the JS thread. Chunks already pushed are still returned; after
+  // them, the scan ends, or fails if an error is given.
+  void Close(const std::string *error) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (closed) {
+      return;
+    }
+    closed = true;
+    if (error) {
+      has_error = true;
+      error_message = *error;
+    }
+    cv.notify_all();
+  }
+
+  // Called on a DuckDB thread, from the main function.
+  void Pop(duckdb_function_info info, duckdb_data_chunk output) {
+    Entry entry;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [this]() { return !entries.empty() || closed; });
+      if (entries.empty()) {
+        if (has_error) {
+          duckdb_function_set_error(info, error_message.c_str());
+        } else {
+          duckdb_data_chunk_set_size(output, 0);
+        }
+        return;
+      }
+      entry = std::move(entries.front());
+      entries.pop_front();
+      if (space_waiter && entries.size() < capacity) {
+        ResolveSpaceWaiter(true);
+      }
+    }
+    // The entry's reference, dropped on return, goes through the reaper, so
+    // neither this nor the reference below calls into JS.
+    std::string error;
+    if (!ReferenceChunk(output, entry.chunk, error)) {
+      duckdb_function_set_error(info, error.c_str());
+    }
+  }
+
+  // Called on whatever thread deletes the init data.
+  void Cancel() {
+    std::deque<Entry> dropped;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      cancelled = true;
+      dropped.swap(entries);
+      if (space_waiter) {
+        ResolveSpaceWaiter(false);
+      }
+    }
+  }
+
+private:
+
+  struct Entry {
+    duckdb_data_chunk chunk = nullptr;
+    std::shared_ptr<ManagedObjectReference> chunk_ref;
+  };
+
+  // Called with the mutex held.
+  void ResolveSpaceWaiter(bool value) {
+    std::shared_ptr<Napi::Promise::Deferred> waiter(std::move(space_waiter));
+    reaper->Post([waiter, value](Napi::Env env) {
+      Napi::HandleScope scope(env);
+      waiter->Resolve(Napi::Boolean::New(env, value));
+    });
+  }
+
+  static bool ReferenceChunk(duckdb_data_chunk output, duckdb_data_chunk chunk, std::string &error) {
+    auto column_count = duckdb_data_chunk_get_column_count(output);
+    if (duckdb_data_chunk_get_column_count(chunk) != column_count) {
+      error = "Queued chunk has " + std::to_string(duckdb_data_chunk_get_column_count(chunk))
+        + " columns, but the scan expects " + std::to_string(column_count);
+      return false;
+    }
+    for (idx_t column_index = 0; column_index < column_count; column_index++) {
+      auto output_vector = duckdb_data_chunk_get_vector(output, column_index);
+      auto chunk_vector = duckdb_data_chunk_get_vector(chunk, column_index);
+      auto output_type = duckdb_vector_get_column_type(output_vector);
+      auto chunk_type = duckdb_vector_get_column_type(chunk_vector);
+      auto types_match = LogicalTypesMatch(output_type, chunk_type);
+      duckdb_destroy_logical_type(&output_type);
+      duckdb_destroy_logical_type(&chunk_type);
+      if (!types_match) {
+        error = "Queued chunk column " + std::to_string(column_index) + " has the wrong type";
+        return false;
+      }
+      duckdb_vector_reference_vector(output_vector, chunk_vector);
+    }
+    duckdb_data_chunk_set_size(output, duckdb_data_chunk_get_size(chunk));
+    return true;
+  }
+
+  std::shared_ptr<NapiRefReaper> reaper;
+  size_t capacity;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<Entry> entries;
+  std::unique_ptr<Napi::Promise::Deferred> space_waiter;
+  bool closed = false;
+  bool cancelled = false;
+  bool has_error = false;
+  std::string error_message;
+
+};
+
+struct TableFunctionChunkQueueHolder {
+  std::shared_ptr<TableFunctionChunkQueue> queue;
+};
+
+inline void FinalizeTableFunctionChunkQueueHolder(Napi::BasicEnv, TableFunctionChunkQueueHolder *holder) {
+  delete holder;
+}
+
+inline Napi::External<TableFunctionChunkQueueHolder> CreateExternalForTableFunctionChunkQueue(Napi::Env env, std::shared_ptr<TableFunctionChunkQueue> queue) {
+  return CreateExternal<TableFunctionChunkQueueHolder>(env, TableFunctionChunkQueueTypeTag, new TableFunctionChunkQueueHolder{std::move(queue)}, FinalizeTableFunctionChunkQueueHolder);
+}
+
+inline std::shared_ptr<TableFunctionChunkQueue> GetTableFunctionChunkQueueFromExternal(Napi::Env env, Napi::Value value) {
+  return GetDataFromExternal<TableFunctionChunkQueueHolder>(env, TableFunctionChunkQueueTypeTag, value, "Invalid table function chunk queue argument")->queue;
+}
+
 // Bind data and init data
 //
 // Both hold a user object through the reaper, so that the reference is destroyed
@@ -227,10 +755,15 @@ inline duckdb_table_function GetTableFunctionFromExternal(Napi::Env env, Napi::V
 // never copied by the C API.
 //
 // Init data is used for both the global init and the per-thread local init, which
-// DuckDB keeps separate but stores the same way.
+// DuckDB keeps separate but stores the same way. Global init data can instead
+// hold a chunk queue, which is cancelled when the scan deletes it, or the scan
+// data and partition counter of a scan run by a worker pool. A typed array table
+// keeps its table in the bind data, so a scan is unaffected by setting another
+// table afterwards, and its projection and row counter in the init data.
 
 struct TableFunctionInternalBindData {
   std::shared_ptr<ManagedObjectReference> user_bind_data_ref;
+  std::shared_ptr<const TableFunctionTypedArrayTable> typed_array_table;
 
   void SetUserBindData(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_bind_data) {
     user_bind_data_ref = user_bind_data.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_bind_data);
@@ -243,6 +776,10 @@ inline void DeleteTableFunctionInternalBindData(TableFunctionInternalBindData *i
 
 struct TableFunctionInternalInitData {
   std::shared_ptr<ManagedObjectReference> user_init_data_ref;
+  std::shared_ptr<TableFunctionChunkQueue> chunk_queue;
+  std::unique_ptr<std::string> worker_scan_data;
+  std::atomic<uint64_t> next_partition{0};
+  std::vector<idx_t> column_indexes;
 
   void SetUserInitData(const std::shared_ptr<NapiRefReaper> &reaper, Napi::Object user_init_data) {
     user_init_data_ref = user_init_data.IsUndefined() ? nullptr : MakeManagedObjectReference(reaper, user_init_data);
@@ -250,6 +787,9 @@ struct TableFunctionInternalInitData {
 };
 
 inline void DeleteTableFunctionInternalInitData(TableFunctionInternalInitData *internal_init_data) {
+  if (internal_init_data->chunk_queue) {
+    internal_init_data->chunk_queue->Cancel();
+  }
   delete internal_init_data;
 }
 
@@ -282,3 +822,88 @@ inline void TableFunctionLocalInitFunction(duckdb_init_info info) {
 inline void TableFunctionMainFunction(duckdb_function_info info, duckdb_data_chunk output) {
   GetTableFunctionInternalExtraInfoFromFunctionInfo(info)->main_callback.Invoke({info, output});
 }
+
+inline void TableFunctionChunkQueueMainFunction(duckdb_function_info info, duckdb_data_chunk output) {
+  auto internal_init_data = reinterpret_cast<TableFunctionInternalInitData*>(duckdb_function_get_init_data(info));
+  if (!internal_init_data || !internal_init_data->chunk_queue) {
+    duckdb_function_set_error(info, "No chunk queue was set by the init function");
+    return;
+  }
+  internal_init_data->chunk_queue->Pop(info, output);
+}
+
+inline void TableFunctionWorkerLocalInitFunction(duckdb_init_info info) {
+  auto internal_extra_info = GetTableFunctionInternalExtraInfoFromInitInfo(info);
+  auto member = internal_extra_info->worker_pool ? internal_extra_info->worker_pool->NextMember() : nullptr;
+  if (!member) {
+    duckdb_init_set_error(info, "No workers attached to table function worker pool");
+    return;
+  }
+  auto scan = new TableFunctionWorkerScan();
+  scan->member = std::move(member);
+  duckdb_init_set_init_data(info, scan, reinterpret_cast<duckdb_delete_callback_t>(DeleteTableFunctionWorkerScan));
+}
+
+inline void TableFunctionWorkerMainFunction(duckdb_function_info info, duckdb_data_chunk output) {
+  auto scan = reinterpret_cast<TableFunctionWorkerScan*>(duckdb_function_get_local_init_data(info));
+  scan->global_init_data = reinterpret_cast<TableFunctionInternalInitData*>(duckdb_function_get_init_data(info));
+  // The thread stays with the worker its local init picked, because the scan's
+  // state lives in that worker's env. If the worker has gone, the scan fails.
+  if (!scan->member->Invoke({info, output, scan})) {
+    duckdb_function_set_error(info, "Worker serving this scan detached from table function worker pool");
+  }
+}
+
+inline void TableFunctionTypedArrayBindFunction(duckdb_bind_info info) {
+  auto table = GetTableFunctionInternalExtraInfoFromBindInfo(info)->typed_array_table;
+  for (auto &column : table->columns) {
+    auto logical_type = duckdb_create_logical_type(column.type);
+    duckdb_bind_add_result_column(info, column.name.c_str(), logical_type);
+    duckdb_destroy_logical_type(&logical_type);
+  }
+  duckdb_bind_set_cardinality(info, table->row_count, true);
+  auto internal_bind_data = new TableFunctionInternalBindData();
+  internal_bind_data->typed_array_table = std::move(table);
+  duckdb_bind_set_bind_data(info, internal_bind_data, reinterpret_cast<duckdb_delete_callback_t>(DeleteTableFunctionInternalBindData));
+}
+
+inline void TableFunctionTypedArrayInitFunction(duckdb_init_info info) {
+  auto internal_bind_data = reinterpret_cast<TableFunctionInternalBindData*>(duckdb_init_get_bind_data(info));
+  auto internal_init_data = new TableFunctionInternalInitData();
+  auto column_count = duckdb_init_get_column_count(info);
+  for (idx_t i = 0; i < column_count; i++) {
+    internal_init_data->column_indexes.push_back(duckdb_init_get_column_index(info, i));
+  }
+  auto vector_size = duckdb_vector_size();
+  auto range_count = (internal_bind_data->typed_array_table->row_count + vector_size - 1) / vector_size;
+  duckdb_init_set_max_threads(info, range_count > 0 ? range_count : 1);
+  duckdb_init_set_init_data(info, internal_init_data, reinterpret_cast<duckdb_delete_callback_t>(DeleteTableFunctionInternalInitData));
+}
+
+inline void TableFunctionTypedArrayMainFunction(duckdb_function_info info, duckdb_data_chunk output) {
+  auto internal_bind_data = reinterpret_cast<TableFunctionInternalBindData*>(duckdb_function_get_bind_data(info));
+  auto internal_init_data = reinterpret_cast<TableFunctionInternalInitData*>(duckdb_function_get_init_data(info));
+  auto &table = *internal_bind_data->typed_array_table;
+  auto vector_size = duckdb_vector_size();
+  auto start = internal_init_data->next_partition++ * vector_size;
+  if (start >= table.row_count) {
+    duckdb_data_chunk_set_size(output, 0);
+    return;
+  }
+  auto count = table.row_count - start < vector_size ? table.row_count - start : vector_size;
+  auto &column_indexes = internal_init_data->column_indexes;
+  for (idx_t i = 0; i < column_indexes.size(); i++) {
+    auto vector = duckdb_data_chunk_get_vector(output, i);
+    if (column_indexes[i] < table.columns.size()) {
+      table.columns[column_indexes[i]].Write(vector, start, count);
+    } else {
+      // A column DuckDB adds itself, such as a row id; this table has none.
+      duckdb_vector_ensure_validity_writable(vector);
+      auto validity = duckdb_vector_get_validity(vector);
+      for (idx_t row = 0; row < count; row++) {
+        duckdb_validity_set_row_invalid(validity, row);
+      }
+    }
+  }
+  duckdb_data_chunk_set_size(output, count);
+}
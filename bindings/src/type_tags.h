@@ -19,10 +19,30 @@
 // copy per unit. Tags are compared by value, so either works, but there is no
 // reason to have more than one.
 
+inline constexpr napi_type_tag AggregateFunctionInfoTypeTag = {
+  0x708EE4B3C5EF4E38, 0x8E5E645D14AAA8EE
+};
+
+inline constexpr napi_type_tag AggregateFunctionSetTypeTag = {
+  0xD68BC35B765346D4, 0x8F1D14D02E40435A
+};
+
+inline constexpr napi_type_tag AggregateFunctionTypeTag = {
+  0x500D6843288249BA, 0xA9FC562B80F3AE69
+};
+
 inline constexpr napi_type_tag AppenderTypeTag = {
   0x32E0AB3B83F74A89, 0xB785905D92D54996
 };
 
+inline constexpr napi_type_tag CastFunctionInfoTypeTag = {
+  0x17884B713A814FEF, 0x9914FA3886661E71
+};
+
+inline constexpr napi_type_tag CastFunctionTypeTag = {
+  0x479867CE69BA4AC4, 0xB0CEF1892A012ACD
+};
+
 inline constexpr napi_type_tag ClientContextTypeTag = {
   0x1E1738782ED94232, 0x867B024D1858DF3A
 };
@@ -35,6 +55,26 @@ inline constexpr napi_type_tag ConnectionTypeTag = {
   0x922B9BF54AB04DFC, 0x8A258578D371DB71
 };
 
+inline constexpr napi_type_tag CopyFunctionBindInfoTypeTag = {
+  0x8D620393358043DE, 0xA9D33FBCE5433D55
+};
+
+inline constexpr napi_type_tag CopyFunctionFinalizeInfoTypeTag = {
+  0x4EC127AA3E0C4DD0, 0xA22B68924966FC48
+};
+
+inline constexpr napi_type_tag CopyFunctionGlobalInitInfoTypeTag = {
+  0x7CC8E67A0A024FF7, 0x92DB045EBE8DACB7
+};
+
+inline constexpr napi_type_tag CopyFunctionSinkInfoTypeTag = {
+  0x0119900C716E4154, 0xB94795343A10585A
+};
+
+inline constexpr napi_type_tag CopyFunctionTypeTag = {
+  0x3F94360D06034D1D, 0x9321634E21F0A772
+};
+
 inline constexpr napi_type_tag DataChunkTypeTag = {
   0x2C7537AB063A4296, 0xB1E70F08B0BBD1A3
 };
@@ -43,10 +83,30 @@ inline constexpr napi_type_tag DatabaseTypeTag = {
   0x835A8533653C40D1, 0x83B3BE2B233BA8F3
 };
 
+inline constexpr napi_type_tag ErrorDataTypeTag = {
+  0x6F40600A3C3C413C, 0x9D37CD5A04E8C9CA
+};
+
+inline constexpr napi_type_tag ExpressionTypeTag = {
+  0x73FA4E9E88D44D6E, 0x9B637EE1C16626B1
+};
+
 inline constexpr napi_type_tag ExtractedStatementsTypeTag = {
   0x59288E1C60C44EEB, 0xBFA35376EE0F04DD
 };
 
+inline constexpr napi_type_tag FileHandleTypeTag = {
+  0xA9268451EF3346EC, 0x9AF28057FA475B02
+};
+
+inline constexpr napi_type_tag FileOpenOptionsTypeTag = {
+  0x5B96CE15E0F14C77, 0x954538607750C4B5
+};
+
+inline constexpr napi_type_tag FileSystemTypeTag = {
+  0x00F2A936E9D84B8C, 0x938AE384B4E5C2D1
+};
+
 inline constexpr napi_type_tag InstanceCacheTypeTag = {
   0x2F3346E30FB5457C, 0xB9201EE5112EEF9F
 };
@@ -55,6 +115,10 @@ inline constexpr napi_type_tag LogicalTypeTypeTag = {
   0x78AF202191ED4A23, 0x8093715369592A2B
 };
 
+inline constexpr napi_type_tag NativeLibraryTypeTag = {
+  0xF0F68903E92D482F, 0xA595C791F8946B92
+};
+
 inline constexpr napi_type_tag PendingResultTypeTag = {
   0x257E88ECE8294FEC, 0xB64963BBBD1DBB41
 };
@@ -63,6 +127,10 @@ inline constexpr napi_type_tag PreparedStatementTypeTag = {
   0xA8B03DAD16D34416, 0x9735A7E1F2A1240C
 };
 
+inline constexpr napi_type_tag ReplacementScanInfoTypeTag = {
+  0xF3E5CBC0A4B74120, 0xBD239B6D3437CE6A
+};
+
 inline constexpr napi_type_tag ResultTypeTag = {
   0x08F7FE3AE12345E5, 0x8733310DC29372D9
 };
@@ -75,14 +143,30 @@ inline constexpr napi_type_tag ScalarFunctionInfoTypeTag = {
   0xB0E6739D698048EA, 0x9E79734E3E137AC3
 };
 
+inline constexpr napi_type_tag ScalarFunctionInitInfoTypeTag = {
+  0x6120EEB9A57746A1, 0x8A2D28F183D5AD49
+};
+
+inline constexpr napi_type_tag ScalarFunctionSetTypeTag = {
+  0x855D71E520554C8E, 0x9F294F4C9775F68C
+};
+
 inline constexpr napi_type_tag ScalarFunctionTypeTag = {
   0x95D48B7051D14994, 0x9F883D7DF5DEA86D
 };
 
+inline constexpr napi_type_tag ScalarFunctionWorkerPoolTypeTag = {
+  0xB0D540695B5944E9, 0xB3CE0DBD0B2EE34F
+};
+
 inline constexpr napi_type_tag TableFunctionBindInfoTypeTag = {
   0xFF9280FBDC3341E3, 0xAE7F563D67540007
 };
 
+inline constexpr napi_type_tag TableFunctionChunkQueueTypeTag = {
+  0xBDCFDEA6AFEB4AAB, 0xB458F17A56C9DC81
+};
+
 inline constexpr napi_type_tag TableFunctionInfoTypeTag = {
   0xA8CFE12055EE470C, 0xB37877D9FDD36A98
 };
@@ -95,6 +179,14 @@ inline constexpr napi_type_tag TableFunctionTypeTag = {
   0xBECF7A8CEBA84520, 0xBFC47C84A51544EF
 };
 
+inline constexpr napi_type_tag TableFunctionWorkerPoolTypeTag = {
+  0x6A3A6185646C48C7, 0x8DA3FCF5F8A1125A
+};
+
+inline constexpr napi_type_tag TableFunctionWorkerScanTypeTag = {
+  0x67F3CA0D60044D56, 0xB74BDBBA4D95CE18
+};
+
 inline constexpr napi_type_tag ValueTypeTag = {
   0xC60F36613BF14E93, 0xBAA92848936FAA25
 };
@@ -0,0 +1,242 @@
+import duckdb from '@duckdb/node-bindings';
+import { expect, suite, test } from 'vitest';
+import { data } from './utils/expectedVectors';
+import { expectResult } from './utils/expectResult';
+import { sleep } from './utils/sleep';
+import { withConnection } from './utils/withConnection';
+
+function readInt32Column(input: duckdb.DataChunk, columnIndex: number) {
+  const rowCount = duckdb.data_chunk_get_size(input);
+  const bytes = duckdb.vector_get_data(
+    duckdb.data_chunk_get_vector(input, columnIndex),
+    rowCount * 4,
+  );
+  const dataView = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+  const values: number[] = [];
+  for (let row = 0; row < rowCount; row++) {
+    values.push(dataView.getInt32(row * 4, true));
+  }
+  return values;
+}
+
+function createSumFunction(name: string, sums: Map<number, number>) {
+  const aggregate_function = duckdb.create_aggregate_function();
+  duckdb.aggregate_function_set_name(aggregate_function, name);
+  const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+  duckdb.aggregate_function_add_parameter(aggregate_function, int_type);
+  duckdb.aggregate_function_set_return_type(aggregate_function, int_type);
+  duckdb.aggregate_function_set_functions(
+    aggregate_function,
+    (_info, input, state_ids) => {
+      const values = readInt32Column(input, 0);
+      for (let row = 0; row < values.length; row++) {
+        const state_id = state_ids[row];
+        sums.set(state_id, (sums.get(state_id) ?? 0) + values[row]);
+      }
+    },
+    (_info, source_state_ids, target_state_ids) => {
+      for (let i = 0; i < source_state_ids.length; i++) {
+        const source = sums.get(source_state_ids[i]) ?? 0;
+        const target = sums.get(target_state_ids[i]) ?? 0;
+        sums.set(target_state_ids[i], source + target);
+      }
+    },
+    (_info, state_ids, output, offset) => {
+      const results = new Int32Array(state_ids.length);
+      for (let i = 0; i < state_ids.length; i++) {
+        results[i] = sums.get(state_ids[i]) ?? 0;
+      }
+      duckdb.copy_data_to_vector(
+        output,
+        offset * 4,
+        results.buffer,
+        0,
+        results.byteLength,
+      );
+    },
+  );
+  return aggregate_function;
+}
+
+const groupedQuery = (name: string) =>
+  `select ${name}(v::integer) as s from range(10) t(v) group by v % 3 order by v % 3`;
+
+suite('aggregate functions', () => {
+  test('create', () => {
+    const aggregate_function = duckdb.create_aggregate_function();
+    expect(aggregate_function).toBeTruthy();
+  });
+  test('register & run (grouped)', async () => {
+    await withConnection(async (connection) => {
+      const sums = new Map<number, number>();
+      const aggregate_function = createSumFunction('my_sum', sums);
+      duckdb.register_aggregate_function(connection, aggregate_function);
+      duckdb.destroy_aggregate_function_sync(aggregate_function);
+
+      const result = await duckdb.query(connection, groupedQuery('my_sum'));
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 3,
+        columns: [{ name: 's', logicalType: { typeId: duckdb.Type.INTEGER } }],
+        chunks: [
+          {
+            rowCount: 3,
+            vectors: [data(4, [true, true, true], [18, 12, 15])],
+          },
+        ],
+      });
+    });
+  });
+  test('register & run (one update call per chunk)', async () => {
+    await withConnection(async (connection) => {
+      const aggregate_function = duckdb.create_aggregate_function();
+      duckdb.aggregate_function_set_name(aggregate_function, 'my_count');
+      const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+      duckdb.aggregate_function_add_parameter(aggregate_function, int_type);
+      duckdb.aggregate_function_set_return_type(aggregate_function, int_type);
+      let updateCalls = 0;
+      const counts = new Map<number, number>();
+      duckdb.aggregate_function_set_functions(
+        aggregate_function,
+        (_info, _input, state_ids) => {
+          updateCalls++;
+          for (const state_id of state_ids) {
+            counts.set(state_id, (counts.get(state_id) ?? 0) + 1);
+          }
+        },
+        (_info, source_state_ids, target_state_ids) => {
+          for (let i = 0; i < source_state_ids.length; i++) {
+            counts.set(
+              target_state_ids[i],
+              (counts.get(source_state_ids[i]) ?? 0) +
+                (counts.get(target_state_ids[i]) ?? 0),
+            );
+          }
+        },
+        (_info, state_ids, output, offset) => {
+          const results = Int32Array.from(state_ids, (id) => counts.get(id) ?? 0);
+          duckdb.copy_data_to_vector(
+            output,
+            offset * 4,
+            results.buffer,
+            0,
+            results.byteLength,
+          );
+        },
+      );
+      duckdb.register_aggregate_function(connection, aggregate_function);
+
+      const result = await duckdb.query(
+        connection,
+        'select my_count(1) as c from range(2048)',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 'c', logicalType: { typeId: duckdb.Type.INTEGER } }],
+        chunks: [{ rowCount: 1, vectors: [data(4, [true], [2048])] }],
+      });
+      expect(updateCalls).toBe(1);
+    });
+  });
+  test('register & run (extra info)', async () => {
+    await withConnection(async (connection) => {
+      const aggregate_function = createSumFunction('my_sum', new Map());
+      duckdb.aggregate_function_set_extra_info(aggregate_function, {
+        'my_extra_info_key': 'my_extra_info_value',
+      });
+      let extra_info: object | undefined;
+      duckdb.aggregate_function_set_functions(
+        aggregate_function,
+        (info) => {
+          extra_info = duckdb.aggregate_function_get_extra_info(info);
+        },
+        () => {},
+        () => {},
+      );
+      duckdb.register_aggregate_function(connection, aggregate_function);
+
+      await duckdb.query(connection, 'select my_sum(1)');
+      expect(extra_info).toEqual({ 'my_extra_info_key': 'my_extra_info_value' });
+    });
+  });
+  test('register & run (destructor)', async () => {
+    await withConnection(async (connection) => {
+      const sums = new Map<number, number>();
+      const aggregate_function = createSumFunction('my_sum', sums);
+      const destroyed: number[] = [];
+      duckdb.aggregate_function_set_destructor(aggregate_function, (state_ids) => {
+        for (const state_id of state_ids) {
+          destroyed.push(state_id);
+          sums.delete(state_id);
+        }
+      });
+      duckdb.register_aggregate_function(connection, aggregate_function);
+
+      await duckdb.query(connection, groupedQuery('my_sum'));
+      // The destructor is posted to the main thread, so let it run.
+      await sleep(10);
+      expect(destroyed.length).toBeGreaterThan(0);
+      expect(sums.size).toBe(0);
+    });
+  });
+  test('register & run (set)', async () => {
+    await withConnection(async (connection) => {
+      const aggregate_function_set = duckdb.create_aggregate_function_set('my_sum');
+      duckdb.add_aggregate_function_to_set(
+        aggregate_function_set,
+        createSumFunction('my_sum', new Map()),
+      );
+      duckdb.register_aggregate_function_set(connection, aggregate_function_set);
+
+      const result = await duckdb.query(connection, groupedQuery('my_sum'));
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 3,
+        columns: [{ name: 's', logicalType: { typeId: duckdb.Type.INTEGER } }],
+        chunks: [
+          {
+            rowCount: 3,
+            vectors: [data(4, [true, true, true], [18, 12, 15])],
+          },
+        ],
+      });
+    });
+  });
+  test('error handling (exception in update func)', async () => {
+    await withConnection(async (connection) => {
+      const aggregate_function = createSumFunction('my_sum', new Map());
+      duckdb.aggregate_function_set_functions(
+        aggregate_function,
+        () => {
+          throw new Error('my_error');
+        },
+        () => {},
+        () => {},
+      );
+      duckdb.register_aggregate_function(connection, aggregate_function);
+
+      await expect(
+        duckdb.query(connection, 'select my_sum(1)'),
+      ).rejects.toThrow('my_error');
+    });
+  });
+  test('error handling (set error in finalize func)', async () => {
+    await withConnection(async (connection) => {
+      const aggregate_function = createSumFunction('my_sum', new Map());
+      duckdb.aggregate_function_set_functions(
+        aggregate_function,
+        () => {},
+        () => {},
+        (info) => {
+          duckdb.aggregate_function_set_error(info, 'my_error');
+        },
+      );
+      duckdb.register_aggregate_function(connection, aggregate_function);
+
+      await expect(
+        duckdb.query(connection, 'select my_sum(1)'),
+      ).rejects.toThrow('my_error');
+    });
+  });
+});
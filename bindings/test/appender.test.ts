@@ -341,4 +341,169 @@ suite('appender', () => {
       });
     });
   });
+  test('column subset', async () => {
+    await withConnection(async (connection) => {
+      await duckdb.query(
+        connection,
+        'create table appender_target(i integer, d integer default 42, v varchar)'
+      );
+
+      const appender = duckdb.appender_create_ext(
+        connection,
+        'memory',
+        'main',
+        'appender_target'
+      );
+      expect(duckdb.appender_column_count(appender)).toBe(3);
+
+      duckdb.appender_add_column(appender, 'i');
+      duckdb.appender_add_column(appender, 'v');
+      expect(duckdb.appender_column_count(appender)).toBe(2);
+      expectLogicalType(duckdb.appender_column_type(appender, 1), VARCHAR);
+
+      duckdb.append_int32(appender, 11);
+      duckdb.append_varchar(appender, 'eleven');
+      duckdb.appender_end_row(appender);
+
+      duckdb.appender_clear_columns(appender);
+      expect(duckdb.appender_column_count(appender)).toBe(3);
+
+      duckdb.append_int32(appender, 22);
+      duckdb.append_int32(appender, 7);
+      duckdb.append_varchar(appender, 'twenty-two');
+      duckdb.appender_end_row(appender);
+      duckdb.appender_flush_sync(appender);
+
+      const result = await duckdb.query(connection, 'from appender_target');
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 2,
+        columns: [
+          { name: 'i', logicalType: INTEGER },
+          { name: 'd', logicalType: INTEGER },
+          { name: 'v', logicalType: VARCHAR },
+        ],
+        chunks: [
+          {
+            rowCount: 2,
+            vectors: [
+              data(4, [true, true], [11, 22]),
+              data(4, [true, true], [42, 7]),
+              data(16, [true, true], ['eleven', 'twenty-two']),
+            ],
+          },
+        ],
+      });
+    });
+  });
+  test('error: add unknown column', async () => {
+    await withConnection(async (connection) => {
+      await duckdb.query(connection, 'create table appender_target(i integer)');
+      const appender = duckdb.appender_create_ext(
+        connection,
+        'memory',
+        'main',
+        'appender_target'
+      );
+      expect(() =>
+        duckdb.appender_add_column(appender, 'bogus_column')
+      ).toThrowError();
+    });
+  });
+  test('default to chunk', async () => {
+    await withConnection(async (connection) => {
+      await duckdb.query(
+        connection,
+        'create table appender_target(i integer, d integer default 42)'
+      );
+
+      const appender = duckdb.appender_create_ext(
+        connection,
+        'memory',
+        'main',
+        'appender_target'
+      );
+      const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+      const chunk = duckdb.create_data_chunk([int_type, int_type]);
+      duckdb.data_chunk_set_size(chunk, 2);
+      const i_data = duckdb.vector_get_data(
+        duckdb.data_chunk_get_vector(chunk, 0),
+        2 * 4
+      );
+      const i_dv = new DataView(i_data.buffer, i_data.byteOffset, i_data.byteLength);
+      i_dv.setInt32(0, 11, true);
+      i_dv.setInt32(4, 22, true);
+      duckdb.append_default_to_chunk(appender, chunk, 1, 0);
+      duckdb.append_default_to_chunk(appender, chunk, 1, 1);
+      duckdb.append_data_chunk(appender, chunk);
+      duckdb.appender_flush_sync(appender);
+
+      const result = await duckdb.query(connection, 'from appender_target');
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 2,
+        columns: [
+          { name: 'i', logicalType: INTEGER },
+          { name: 'd', logicalType: INTEGER },
+        ],
+        chunks: [
+          {
+            rowCount: 2,
+            vectors: [
+              data(4, [true, true], [11, 22]),
+              data(4, [true, true], [42, 42]),
+            ],
+          },
+        ],
+      });
+    });
+  });
+  test('error data & clear', async () => {
+    await withConnection(async (connection) => {
+      await duckdb.query(
+        connection,
+        'create table appender_target(i integer primary key)'
+      );
+
+      const appender = duckdb.appender_create_ext(
+        connection,
+        'memory',
+        'main',
+        'appender_target'
+      );
+      expect(
+        duckdb.error_data_has_error(duckdb.appender_error_data(appender))
+      ).toBe(false);
+
+      duckdb.append_int32(appender, 11);
+      duckdb.appender_end_row(appender);
+      duckdb.append_int32(appender, 11);
+      duckdb.appender_end_row(appender);
+      expect(() => duckdb.appender_flush_sync(appender)).toThrowError(
+        /violates primary key constraint/
+      );
+
+      const error_data = duckdb.appender_error_data(appender);
+      expect(duckdb.error_data_has_error(error_data)).toBe(true);
+      expect(duckdb.error_data_error_type(error_data)).toBe(
+        duckdb.ErrorType.CONSTRAINT
+      );
+      expect(duckdb.error_data_message(error_data)).toMatch(
+        /violates primary key constraint/
+      );
+
+      duckdb.appender_clear(appender);
+      duckdb.append_int32(appender, 22);
+      duckdb.appender_end_row(appender);
+      duckdb.appender_flush_sync(appender);
+
+      const result = await duckdb.query(connection, 'from appender_target');
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 'i', logicalType: INTEGER }],
+        chunks: [{ rowCount: 1, vectors: [data(4, [true], [22])] }],
+      });
+    });
+  });
 });
@@ -0,0 +1,152 @@
+import duckdb from '@duckdb/node-bindings';
+import { expect, suite, test } from 'vitest';
+import { data } from './utils/expectedVectors';
+import { expectResult } from './utils/expectResult';
+import { sleep } from './utils/sleep';
+import { withConnection } from './utils/withConnection';
+
+function createUTinyIntToVarcharCast(
+  func: duckdb.CastFunctionMainFunction,
+): duckdb.CastFunction {
+  const cast_function = duckdb.create_cast_function();
+  duckdb.cast_function_set_source_type(
+    cast_function,
+    duckdb.create_logical_type(duckdb.Type.UTINYINT),
+  );
+  duckdb.cast_function_set_target_type(
+    cast_function,
+    duckdb.create_logical_type(duckdb.Type.VARCHAR),
+  );
+  duckdb.cast_function_set_function(cast_function, func);
+  return cast_function;
+}
+
+const prefixCast: duckdb.CastFunctionMainFunction = (
+  _info,
+  count,
+  input,
+  output,
+) => {
+  const values = duckdb.vector_get_data(input, count);
+  for (let row = 0; row < count; row++) {
+    duckdb.vector_assign_string_element(output, row, `u${values[row]}`);
+  }
+};
+
+suite('cast functions', () => {
+  test('create', () => {
+    const cast_function = duckdb.create_cast_function();
+    expect(cast_function).toBeTruthy();
+  });
+  test('register & run', async () => {
+    await withConnection(async (connection) => {
+      const cast_function = createUTinyIntToVarcharCast(prefixCast);
+      duckdb.register_cast_function(connection, cast_function);
+      duckdb.destroy_cast_function_sync(cast_function);
+
+      const result = await duckdb.query(
+        connection,
+        'select 7::utinyint::varchar as v',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 'v', logicalType: { typeId: duckdb.Type.VARCHAR } }],
+        chunks: [{ rowCount: 1, vectors: [data(16, [true], ['u7'])] }],
+      });
+    });
+  });
+  test('register & run (async, extra info)', async () => {
+    await withConnection(async (connection) => {
+      const cast_function = createUTinyIntToVarcharCast(
+        async (info, count, _input, output) => {
+          await sleep(1);
+          const { prefix } = duckdb.cast_function_get_extra_info(info) as {
+            prefix: string;
+          };
+          for (let row = 0; row < count; row++) {
+            duckdb.vector_assign_string_element(output, row, prefix);
+          }
+        },
+      );
+      duckdb.cast_function_set_extra_info(cast_function, { prefix: 'x' });
+      duckdb.register_cast_function(connection, cast_function);
+
+      const result = await duckdb.query(
+        connection,
+        'select 7::utinyint::varchar as v',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 'v', logicalType: { typeId: duckdb.Type.VARCHAR } }],
+        chunks: [{ rowCount: 1, vectors: [data(16, [true], ['x'])] }],
+      });
+    });
+  });
+  test('register & run (try cast with row error)', async () => {
+    await withConnection(async (connection) => {
+      let cast_mode: duckdb.CastMode | undefined;
+      const cast_function = createUTinyIntToVarcharCast(
+        (info, count, _input, output) => {
+          cast_mode = duckdb.cast_function_get_cast_mode(info);
+          for (let row = 0; row < count; row++) {
+            duckdb.cast_function_set_row_error(info, 'my_error', row, output);
+          }
+          return cast_mode === duckdb.CastMode.TRY;
+        },
+      );
+      duckdb.register_cast_function(connection, cast_function);
+
+      const result = await duckdb.query(
+        connection,
+        'select try_cast(7::utinyint as varchar) as v',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 'v', logicalType: { typeId: duckdb.Type.VARCHAR } }],
+        chunks: [{ rowCount: 1, vectors: [data(16, [false], [null])] }],
+      });
+      expect(cast_mode).toBe(duckdb.CastMode.TRY);
+    });
+  });
+  test('error handling (return false)', async () => {
+    await withConnection(async (connection) => {
+      const cast_function = createUTinyIntToVarcharCast((info) => {
+        duckdb.cast_function_set_error(info, 'my_error');
+        return false;
+      });
+      duckdb.register_cast_function(connection, cast_function);
+
+      await expect(
+        duckdb.query(connection, 'select 7::utinyint::varchar'),
+      ).rejects.toThrow('my_error');
+    });
+  });
+  test('error handling (exception)', async () => {
+    await withConnection(async (connection) => {
+      const cast_function = createUTinyIntToVarcharCast(() => {
+        throw new Error('my_error');
+      });
+      duckdb.register_cast_function(connection, cast_function);
+
+      await expect(
+        duckdb.query(connection, 'select 7::utinyint::varchar'),
+      ).rejects.toThrow('my_error');
+    });
+  });
+  test('error handling (rejection)', async () => {
+    await withConnection(async (connection) => {
+      const cast_function = createUTinyIntToVarcharCast(async () => {
+        await sleep(1);
+        throw new Error('my_error');
+      });
+      duckdb.register_cast_function(connection, cast_function);
+
+      await expect(
+        duckdb.query(connection, 'select 7::utinyint::varchar'),
+      ).rejects.toThrow('my_error');
+    });
+  });
+});
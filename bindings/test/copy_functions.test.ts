@@ -0,0 +1,258 @@
+import duckdb from '@duckdb/node-bindings';
+import { expect, suite, test } from 'vitest';
+import { VARCHAR } from './utils/expectedLogicalTypes';
+import { data } from './utils/expectedVectors';
+import { expectResult } from './utils/expectResult';
+import { sleep } from './utils/sleep';
+import { withConnection } from './utils/withConnection';
+
+function sumIntegers(chunk: duckdb.DataChunk): number {
+  const rowCount = duckdb.data_chunk_get_size(chunk);
+  const vec0 = duckdb.data_chunk_get_vector(chunk, 0);
+  const data0 = duckdb.vector_get_data(vec0, rowCount * 4);
+  const dv0 = new DataView(data0.buffer, data0.byteOffset);
+  let sum = 0;
+  for (let i = 0; i < rowCount; i++) {
+    sum += dv0.getInt32(i * 4, true);
+  }
+  return sum;
+}
+
+function createCopyFunction(name: string): duckdb.CopyFunction {
+  const copy_function = duckdb.create_copy_function();
+  duckdb.copy_function_set_name(copy_function, name);
+  duckdb.copy_function_set_bind(copy_function, () => {});
+  duckdb.copy_function_set_global_init(copy_function, () => {});
+  duckdb.copy_function_set_finalize(copy_function, () => {});
+  return copy_function;
+}
+
+const copySql = `copy (select range::integer as i from range(5000)) to 'my_file.my' (format my_format)`;
+
+suite('copy functions', () => {
+  test('create', () => {
+    const copy_function = duckdb.create_copy_function();
+    expect(copy_function).toBeTruthy();
+  });
+  test('register & run', async () => {
+    await withConnection(async (connection) => {
+      const events: string[] = [];
+      const copy_function = duckdb.create_copy_function();
+      duckdb.copy_function_set_name(copy_function, 'my_format');
+      duckdb.copy_function_set_extra_info(copy_function, { prefix: 'my' });
+      duckdb.copy_function_set_bind(copy_function, (info) => {
+        const columnCount = duckdb.copy_function_bind_get_column_count(info);
+        const columnType = duckdb.get_type_id(
+          duckdb.copy_function_bind_get_column_type(info, 0),
+        );
+        events.push(`bind ${columnCount} ${columnType}`);
+        duckdb.copy_function_bind_set_bind_data(info, { scale: 2 });
+      });
+      duckdb.copy_function_set_global_init(copy_function, (info) => {
+        const { prefix } = duckdb.copy_function_global_init_get_extra_info(
+          info,
+        ) as { prefix: string };
+        const path = duckdb.copy_function_global_init_get_file_path(info);
+        events.push(`init ${prefix} ${path}`);
+        duckdb.copy_function_global_init_set_global_state(info, { sum: 0 });
+      });
+      duckdb.copy_function_set_sink(copy_function, (info, input) => {
+        const { scale } = duckdb.copy_function_sink_get_bind_data(info) as {
+          scale: number;
+        };
+        const state = duckdb.copy_function_sink_get_global_state(info) as {
+          sum: number;
+        };
+        state.sum += scale * sumIntegers(input);
+      });
+      duckdb.copy_function_set_finalize(copy_function, (info) => {
+        const state = duckdb.copy_function_finalize_get_global_state(info) as {
+          sum: number;
+        };
+        events.push(`finalize ${state.sum}`);
+      });
+      duckdb.register_copy_function(connection, copy_function);
+      duckdb.destroy_copy_function_sync(copy_function);
+
+      await duckdb.query(connection, copySql);
+      expect(events).toEqual([
+        `bind 1 ${duckdb.Type.INTEGER}`,
+        'init my my_file.my',
+        `finalize ${2 * 12497500}`,
+      ]);
+    });
+  });
+  test('error handling', async () => {
+    await withConnection(async (connection) => {
+      const copy_function = createCopyFunction('my_format');
+      duckdb.copy_function_set_bind(copy_function, (info) => {
+        duckdb.copy_function_bind_set_error(info, 'my_bind_error');
+      });
+      duckdb.copy_function_set_sink(copy_function, () => {});
+      duckdb.register_copy_function(connection, copy_function);
+
+      await expect(duckdb.query(connection, copySql)).rejects.toThrow(
+        'my_bind_error',
+      );
+    });
+  });
+  test('error handling (throw)', async () => {
+    await withConnection(async (connection) => {
+      const copy_function = createCopyFunction('my_format');
+      duckdb.copy_function_set_sink(copy_function, () => {
+        throw new Error('my_sink_error');
+      });
+      duckdb.register_copy_function(connection, copy_function);
+
+      await expect(duckdb.query(connection, copySql)).rejects.toThrow(
+        'my_sink_error',
+      );
+    });
+  });
+  test('async sink', async () => {
+    await withConnection(async (connection) => {
+      const events: string[] = [];
+      let sum = 0;
+      let batches = 0;
+      const copy_function = createCopyFunction('my_format');
+      duckdb.copy_function_set_async_sink(
+        copy_function,
+        async (chunks, global_state) => {
+          expect(global_state).toBeUndefined();
+          batches++;
+          await sleep(1);
+          for (const chunk of chunks) {
+            sum += sumIntegers(chunk);
+          }
+        },
+        4,
+      );
+      duckdb.copy_function_set_finalize(copy_function, () => {
+        events.push(`finalize ${sum}`);
+      });
+      duckdb.register_copy_function(connection, copy_function);
+
+      await duckdb.query(connection, copySql);
+      expect(events).toEqual(['finalize 12497500']);
+      expect(batches).toBeGreaterThan(0);
+    });
+  });
+  test('async sink (global state)', async () => {
+    await withConnection(async (connection) => {
+      const copy_function = createCopyFunction('my_format');
+      const states: { sum: number }[] = [];
+      duckdb.copy_function_set_async_sink(
+        copy_function,
+        (chunks, global_state) => {
+          const state = global_state as { sum: number };
+          for (const chunk of chunks) {
+            state.sum += sumIntegers(chunk);
+          }
+        },
+        1,
+      );
+      duckdb.copy_function_set_global_init(copy_function, (info) => {
+        const state = { sum: 0 };
+        states.push(state);
+        duckdb.copy_function_global_init_set_global_state(info, state);
+      });
+      duckdb.register_copy_function(connection, copy_function);
+
+      await duckdb.query(connection, copySql);
+      expect(states).toEqual([{ sum: 12497500 }]);
+    });
+  });
+  test('async sink error handling', async () => {
+    await withConnection(async (connection) => {
+      const copy_function = createCopyFunction('my_format');
+      duckdb.copy_function_set_async_sink(
+        copy_function,
+        async () => {
+          await sleep(1);
+          throw new Error('my_async_sink_error');
+        },
+        2,
+      );
+      duckdb.register_copy_function(connection, copy_function);
+
+      await expect(duckdb.query(connection, copySql)).rejects.toThrow(
+        'my_async_sink_error',
+      );
+    });
+  });
+  test('copy from', async () => {
+    await withConnection(async (connection) => {
+      const columns: string[] = [];
+      const table_function = duckdb.create_table_function();
+      duckdb.table_function_set_name(table_function, 'my_format_reader');
+      duckdb.table_function_add_parameter(
+        table_function,
+        duckdb.create_logical_type(duckdb.Type.VARCHAR),
+      );
+      duckdb.table_function_set_bind(table_function, (info) => {
+        const column_count =
+          duckdb.table_function_bind_get_result_column_count(info);
+        for (let i = 0; i < column_count; i++) {
+          const name = duckdb.table_function_bind_get_result_column_name(
+            info,
+            i,
+          );
+          const logical_type =
+            duckdb.table_function_bind_get_result_column_type(info, i);
+          columns.push(`${name} ${duckdb.get_type_id(logical_type)}`);
+          duckdb.bind_add_result_column(info, name, logical_type);
+        }
+        const path = duckdb.get_varchar(duckdb.bind_get_parameter(info, 0));
+        duckdb.bind_set_bind_data(info, { path });
+      });
+      duckdb.table_function_set_init(table_function, (info) => {
+        duckdb.init_set_init_data(info, { done: false });
+      });
+      duckdb.table_function_set_function(table_function, (info, output) => {
+        const { path } = duckdb.function_get_bind_data(info) as {
+          path: string;
+        };
+        const init_data = duckdb.function_get_init_data(info) as {
+          done: boolean;
+        };
+        if (init_data.done) {
+          duckdb.data_chunk_set_size(output, 0);
+          return;
+        }
+        const vector = duckdb.data_chunk_get_vector(output, 0);
+        duckdb.vector_assign_string_element(vector, 0, `${path}_0`);
+        duckdb.vector_assign_string_element(vector, 1, `${path}_1`);
+        duckdb.data_chunk_set_size(output, 2);
+        init_data.done = true;
+      });
+      const copy_function = createCopyFunction('my_format');
+      duckdb.copy_function_set_copy_from_function(
+        copy_function,
+        table_function,
+      );
+      duckdb.destroy_table_function_sync(table_function);
+      duckdb.register_copy_function(connection, copy_function);
+
+      await duckdb.query(connection, 'create table t (s varchar)');
+      await duckdb.query(
+        connection,
+        `copy t from 'my_file.my' (format my_format)`,
+      );
+      expect(columns).toEqual([`s ${duckdb.Type.VARCHAR}`]);
+      const result = await duckdb.query(connection, 'select s from t');
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 2,
+        columns: [{ name: 's', logicalType: VARCHAR }],
+        chunks: [
+          {
+            rowCount: 2,
+            vectors: [
+              data(16, [true, true], ['my_file.my_0', 'my_file.my_1']),
+            ],
+          },
+        ],
+      });
+    });
+  });
+});
@@ -54,6 +54,21 @@ suite('data chunk', () => {
     const validity_array = new BigUint64Array(validity_bytes.buffer, validity_bytes.byteOffset, 1);
     expect(validity_array[0]).toBe(0xfedcba9876543210n);
   });
+  test('write vector validity from null mask', () => {
+    const integer_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+    const chunk = duckdb.create_data_chunk([integer_type]);
+    duckdb.data_chunk_set_size(chunk, 3);
+    const vector = duckdb.data_chunk_get_vector(chunk, 0);
+    duckdb.vector_set_null_mask(vector, new Uint8Array([0, 0, 0]), 3);
+    expect(duckdb.vector_get_validity(vector, 8)).toBeNull();
+    duckdb.vector_set_null_mask(vector, new Uint8Array([0, 1, 0]), 3);
+    expect(duckdb.vector_get_validity(vector, 8)[0] & 0b111).toBe(0b101);
+    duckdb.vector_set_null_mask(vector, new Uint8Array([1, 0, 0]), 3);
+    expect(duckdb.vector_get_validity(vector, 8)[0] & 0b111).toBe(0b110);
+    expect(() => duckdb.vector_set_null_mask(vector, new Uint8Array(2), 3)).toThrow(
+      'Null mask is shorter than the row count',
+    );
+  });
   test('write integer vector', () => {
     const source_buffer = new ArrayBuffer(3 * 4);
     const source_dv = new DataView(source_buffer);
@@ -90,6 +105,72 @@ suite('data chunk', () => {
     expect(dv.getUint32(32, true)).toBe('longer than twelve characters'.length);
     expect([data[36], data[37], data[38], data[39]]).toStrictEqual([0x6c, 0x6f, 0x6e, 0x67]); // l, o, n, g
   });
+  test('write string vector bulk', () => {
+    const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+    const chunk = duckdb.create_data_chunk([varchar_type]);
+    duckdb.data_chunk_set_size(chunk, 4);
+    const vector = duckdb.data_chunk_get_vector(chunk, 0);
+    const strings = ['ABC', 'abcdefghijkl', 'longer than twelve characters'];
+    const bytes = new TextEncoder().encode(strings.join(''));
+    const offsets = new Uint32Array([0, 3, 15, 15 + strings[2].length]);
+    duckdb.vector_assign_strings(vector, 1, bytes, offsets);
+    const data = duckdb.vector_get_data(vector, 4 * 16);
+    const dv = new DataView(data.buffer);
+    expect(dv.getUint32(16, true)).toBe(3);
+    expect([data[20], data[21], data[22]]).toStrictEqual([0x41, 0x42, 0x43]); // A, B, C
+    expect(dv.getUint32(32, true)).toBe(12);
+    expect([data[36], data[47]]).toStrictEqual([0x61, 0x6c]); // a, l
+    expect(dv.getUint32(48, true)).toBe(strings[2].length);
+    expect([data[52], data[53], data[54], data[55]]).toStrictEqual([0x6c, 0x6f, 0x6e, 0x67]); // l, o, n, g
+  });
+  test('write string vector bulk (invalid offsets)', () => {
+    const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+    const chunk = duckdb.create_data_chunk([varchar_type]);
+    duckdb.data_chunk_set_size(chunk, 2);
+    const vector = duckdb.data_chunk_get_vector(chunk, 0);
+    const bytes = new TextEncoder().encode('abc');
+    expect(() =>
+      duckdb.vector_assign_strings(vector, 0, bytes, new Uint32Array([0, 4]))
+    ).toThrowError('Invalid offsets argument: offset exceeds data length');
+    expect(() =>
+      duckdb.vector_assign_strings(vector, 0, bytes, new Uint32Array([2, 1, 3]))
+    ).toThrowError('Invalid offsets argument: offsets must be non-decreasing');
+  });
+  test('write string vector bulk (out of range offsets before an in range end)', () => {
+    const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+    const chunk = duckdb.create_data_chunk([varchar_type]);
+    duckdb.data_chunk_set_size(chunk, 2);
+    const vector = duckdb.data_chunk_get_vector(chunk, 0);
+    const encoder = new TextEncoder();
+    duckdb.vector_assign_string_element_len(vector, 0, encoder.encode('ABC'));
+    const bytes = encoder.encode('abcdefghijklmnopqrst');
+    expect(() =>
+      duckdb.vector_assign_strings(vector, 0, bytes, new Uint32Array([100, 200, 10]))
+    ).toThrowError('Invalid offsets argument: offset exceeds data length');
+    expect(() =>
+      duckdb.unsafe_vector_assign_strings(vector, 0, bytes, new Uint32Array([100, 200, 10]))
+    ).toThrowError('Invalid offsets argument: offset exceeds data length');
+    // Nothing was assigned before the offsets were rejected.
+    const data = duckdb.vector_get_data(vector, 2 * 16);
+    const dv = new DataView(data.buffer);
+    expect(dv.getUint32(0, true)).toBe(3);
+    expect([data[4], data[5], data[6]]).toStrictEqual([0x41, 0x42, 0x43]); // A, B, C
+  });
+  test('write string vector (unsafe)', () => {
+    const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+    const chunk = duckdb.create_data_chunk([varchar_type]);
+    duckdb.data_chunk_set_size(chunk, 2);
+    const vector = duckdb.data_chunk_get_vector(chunk, 0);
+    const encoder = new TextEncoder();
+    duckdb.unsafe_vector_assign_string_element_len(vector, 0, encoder.encode('ABC'));
+    duckdb.unsafe_vector_assign_strings(vector, 1, encoder.encode('abcdefghijklm'), new Uint32Array([0, 13]));
+    const data = duckdb.vector_get_data(vector, 2 * 16);
+    const dv = new DataView(data.buffer);
+    expect(dv.getUint32(0, true)).toBe(3);
+    expect([data[4], data[5], data[6]]).toStrictEqual([0x41, 0x42, 0x43]); // A, B, C
+    expect(dv.getUint32(16, true)).toBe(13);
+    expect([data[20], data[21], data[22], data[23]]).toStrictEqual([0x61, 0x62, 0x63, 0x64]); // a, b, c, d
+  });
   test('write blob vector', () => {
     const blob_type = duckdb.create_logical_type(duckdb.Type.BLOB);
     const chunk = duckdb.create_data_chunk([blob_type]);
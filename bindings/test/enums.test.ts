@@ -2,6 +2,37 @@ import duckdb from '@duckdb/node-bindings';
 import { expect, suite, test } from 'vitest';
 
 suite('enums', () => {
+  test('CastMode', () => {
+    expect(duckdb.CastMode.NORMAL).toBe(0);
+    expect(duckdb.CastMode.TRY).toBe(1);
+
+    expect(duckdb.CastMode[duckdb.CastMode.NORMAL]).toBe('NORMAL');
+    expect(duckdb.CastMode[duckdb.CastMode.TRY]).toBe('TRY');
+  });
+  test('ErrorType', () => {
+    expect(duckdb.ErrorType.INVALID).toBe(0);
+    expect(duckdb.ErrorType.OUT_OF_RANGE).toBe(1);
+    expect(duckdb.ErrorType.CONVERSION).toBe(2);
+    expect(duckdb.ErrorType.CONSTRAINT).toBe(18);
+    expect(duckdb.ErrorType.INVALID_INPUT).toBe(32);
+    expect(duckdb.ErrorType.INVALID_CONFIGURATION).toBe(42);
+
+    expect(duckdb.ErrorType[duckdb.ErrorType.INVALID]).toBe('INVALID');
+    expect(duckdb.ErrorType[duckdb.ErrorType.CONSTRAINT]).toBe('CONSTRAINT');
+    expect(duckdb.ErrorType[duckdb.ErrorType.INVALID_CONFIGURATION]).toBe('INVALID_CONFIGURATION');
+  });
+  test('FileFlag', () => {
+    expect(duckdb.FileFlag.INVALID).toBe(0);
+    expect(duckdb.FileFlag.READ).toBe(1);
+    expect(duckdb.FileFlag.WRITE).toBe(2);
+    expect(duckdb.FileFlag.DIRECT_IO).toBe(3);
+    expect(duckdb.FileFlag.CREATE).toBe(4);
+    expect(duckdb.FileFlag.CREATE_NEW).toBe(5);
+    expect(duckdb.FileFlag.APPEND).toBe(6);
+
+    expect(duckdb.FileFlag[duckdb.FileFlag.READ]).toBe('READ');
+    expect(duckdb.FileFlag[duckdb.FileFlag.APPEND]).toBe('APPEND');
+  });
   test('ResultType', () => {
     expect(duckdb.ResultType.INVALID).toBe(0);
     expect(duckdb.ResultType.CHANGED_ROWS).toBe(1);
@@ -10,4 +10,10 @@ suite('errors', () => {
       ).toThrowError(/^Invalid connection argument$/);
     });
   });
+  test('error data', () => {
+    const error_data = duckdb.create_error_data(duckdb.ErrorType.CONSTRAINT, 'my_error');
+    expect(duckdb.error_data_has_error(error_data)).toBe(true);
+    expect(duckdb.error_data_error_type(error_data)).toBe(duckdb.ErrorType.CONSTRAINT);
+    expect(duckdb.error_data_message(error_data)).toBe('my_error');
+  });
 });
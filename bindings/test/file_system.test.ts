@@ -0,0 +1,71 @@
+import duckdb from '@duckdb/node-bindings';
+import fs from 'node:fs';
+import os from 'node:os';
+import path from 'node:path';
+import { expect, suite, test } from 'vitest';
+import { withConnection } from './utils/withConnection';
+
+function openOptions(...flags: duckdb.FileFlag[]): duckdb.FileOpenOptions {
+  const options = duckdb.create_file_open_options();
+  for (const flag of flags) {
+    duckdb.file_open_options_set_flag(options, flag, true);
+  }
+  return options;
+}
+
+suite('file system', () => {
+  test('write & read', async () => {
+    await withConnection(async (connection) => {
+      const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'duckdb-fs-'));
+      try {
+        const filePath = path.join(dir, 'my_file.txt');
+        const client_context = duckdb.connection_get_client_context(connection);
+        const file_system =
+          duckdb.client_context_get_file_system(client_context);
+
+        const writer = duckdb.file_system_open_sync(
+          file_system,
+          filePath,
+          openOptions(duckdb.FileFlag.WRITE, duckdb.FileFlag.CREATE),
+        );
+        const written = duckdb.file_handle_write_sync(
+          writer,
+          new TextEncoder().encode('hello file'),
+        );
+        expect(written).toBe(10);
+        duckdb.file_handle_sync(writer);
+        duckdb.file_handle_close_sync(writer);
+
+        const reader = duckdb.file_system_open_sync(
+          file_system,
+          filePath,
+          openOptions(duckdb.FileFlag.READ),
+        );
+        expect(duckdb.file_handle_size(reader)).toBe(10);
+        duckdb.file_handle_seek(reader, 6);
+        expect(duckdb.file_handle_tell(reader)).toBe(6);
+        const buffer = new Uint8Array(16);
+        const read = duckdb.file_handle_read_sync(reader, buffer);
+        expect(new TextDecoder().decode(buffer.subarray(0, read))).toBe(
+          'file',
+        );
+        duckdb.file_handle_close_sync(reader);
+      } finally {
+        fs.rmSync(dir, { recursive: true, force: true });
+      }
+    });
+  });
+  test('open error', async () => {
+    await withConnection(async (connection) => {
+      const client_context = duckdb.connection_get_client_context(connection);
+      const file_system = duckdb.client_context_get_file_system(client_context);
+      expect(() =>
+        duckdb.file_system_open_sync(
+          file_system,
+          path.join(os.tmpdir(), 'duckdb-no-such-dir', 'no_such_file'),
+          openOptions(duckdb.FileFlag.READ),
+        ),
+      ).toThrow();
+    });
+  });
+});
@@ -0,0 +1,72 @@
+// Native function callbacks for the native library tests, built by binding.gyp
+// as native_functions_fixture. Links against the same libduckdb as the
+// bindings, so the C API calls here act on the bindings' database.
+
+#include "duckdb.h"
+
+#ifdef _WIN32
+#define FIXTURE_EXPORT __declspec(dllexport)
+#else
+#define FIXTURE_EXPORT __attribute__((visibility("default")))
+#endif
+
+// my_native_add(a INTEGER, b INTEGER) -> INTEGER, NULL if either is NULL.
+FIXTURE_EXPORT void my_native_add(duckdb_function_info info, duckdb_data_chunk input, duckdb_vector output) {
+  (void)info;
+  idx_t row_count = duckdb_data_chunk_get_size(input);
+  duckdb_vector a = duckdb_data_chunk_get_vector(input, 0);
+  duckdb_vector b = duckdb_data_chunk_get_vector(input, 1);
+  int32_t *a_data = (int32_t *)duckdb_vector_get_data(a);
+  int32_t *b_data = (int32_t *)duckdb_vector_get_data(b);
+  uint64_t *a_validity = duckdb_vector_get_validity(a);
+  uint64_t *b_validity = duckdb_vector_get_validity(b);
+  int32_t *output_data = (int32_t *)duckdb_vector_get_data(output);
+  for (idx_t row = 0; row < row_count; row++) {
+    if (!duckdb_validity_row_is_valid(a_validity, row) || !duckdb_validity_row_is_valid(b_validity, row)) {
+      duckdb_vector_ensure_validity_writable(output);
+      duckdb_validity_set_row_invalid(duckdb_vector_get_validity(output), row);
+      continue;
+    }
+    output_data[row] = a_data[row] + b_data[row];
+  }
+}
+
+// my_native_range(count BIGINT) -> table(i BIGINT), with i from 0 to count - 1.
+
+typedef struct {
+  int64_t count;
+} my_native_range_bind_data;
+
+typedef struct {
+  int64_t next;
+} my_native_range_init_data;
+
+FIXTURE_EXPORT void my_native_range_bind(duckdb_bind_info info) {
+  duckdb_value count_value = duckdb_bind_get_parameter(info, 0);
+  my_native_range_bind_data *bind_data = (my_native_range_bind_data *)duckdb_malloc(sizeof(my_native_range_bind_data));
+  bind_data->count = duckdb_get_int64(count_value);
+  duckdb_destroy_value(&count_value);
+  duckdb_bind_set_bind_data(info, bind_data, duckdb_free);
+  duckdb_logical_type type = duckdb_create_logical_type(DUCKDB_TYPE_BIGINT);
+  duckdb_bind_add_result_column(info, "i", type);
+  duckdb_destroy_logical_type(&type);
+  duckdb_bind_set_cardinality(info, (idx_t)bind_data->count, true);
+}
+
+FIXTURE_EXPORT void my_native_range_init(duckdb_init_info info) {
+  my_native_range_init_data *init_data = (my_native_range_init_data *)duckdb_malloc(sizeof(my_native_range_init_data));
+  init_data->next = 0;
+  duckdb_init_set_init_data(info, init_data, duckdb_free);
+}
+
+FIXTURE_EXPORT void my_native_range(duckdb_function_info info, duckdb_data_chunk output) {
+  my_native_range_bind_data *bind_data = (my_native_range_bind_data *)duckdb_function_get_bind_data(info);
+  my_native_range_init_data *init_data = (my_native_range_init_data *)duckdb_function_get_init_data(info);
+  int64_t *output_data = (int64_t *)duckdb_vector_get_data(duckdb_data_chunk_get_vector(output, 0));
+  idx_t max_rows = duckdb_vector_size();
+  idx_t row = 0;
+  while (row < max_rows && init_data->next < bind_data->count) {
+    output_data[row++] = init_data->next++;
+  }
+  duckdb_data_chunk_set_size(output, row);
+}
@@ -0,0 +1,62 @@
+import duckdb from '@duckdb/node-bindings';
+import { expect, suite, test } from 'vitest';
+import { VARCHAR } from './utils/expectedLogicalTypes';
+import { data } from './utils/expectedVectors';
+import { expectResult } from './utils/expectResult';
+import { withConnection } from './utils/withConnection';
+
+suite('replacement scans', () => {
+  test('replace a missing table with a table function call', async () => {
+    await withConnection(async (connection, db) => {
+      const seen: string[] = [];
+      duckdb.add_replacement_scan(db, (info, table_name) => {
+        seen.push(table_name);
+        if (table_name === 'my_numbers') {
+          duckdb.replacement_scan_set_function_name(info, 'range');
+          duckdb.replacement_scan_add_parameter(info, duckdb.create_int64(3n));
+        }
+      });
+      const result = await duckdb.query(
+        connection,
+        'select sum(range)::varchar as total from my_numbers',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [
+          { name: 'total', logicalType: VARCHAR },
+        ],
+        chunks: [{ rowCount: 1, vectors: [data(16, [true], ['3'])] }],
+      });
+      expect(seen).toContain('my_numbers');
+    });
+  });
+  test('leave a table unresolved', async () => {
+    await withConnection(async (connection, db) => {
+      duckdb.add_replacement_scan(db, () => {});
+      await expect(
+        duckdb.query(connection, 'select * from not_a_table'),
+      ).rejects.toThrow('not_a_table');
+    });
+  });
+  test('error handling', async () => {
+    await withConnection(async (connection, db) => {
+      duckdb.add_replacement_scan(db, (info, table_name) => {
+        duckdb.replacement_scan_set_error(info, `my_error for ${table_name}`);
+      });
+      await expect(
+        duckdb.query(connection, 'select * from my_table'),
+      ).rejects.toThrow('my_error for my_table');
+    });
+  });
+  test('error handling (throw)', async () => {
+    await withConnection(async (connection, db) => {
+      duckdb.add_replacement_scan(db, () => {
+        throw new Error('my_thrown_error');
+      });
+      await expect(
+        duckdb.query(connection, 'select * from my_table'),
+      ).rejects.toThrow('my_thrown_error');
+    });
+  });
+});
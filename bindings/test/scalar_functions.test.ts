@@ -1,7 +1,10 @@
 import duckdb from '@duckdb/node-bindings';
 import { expect, suite, test } from 'vitest';
+import { INTEGER } from './utils/expectedLogicalTypes';
 import { data } from './utils/expectedVectors';
 import { expectResult } from './utils/expectResult';
+import { nativeFunctionsFixturePath } from './utils/nativeFunctionsFixture';
+import { sleep } from './utils/sleep';
 import { withConnection } from './utils/withConnection';
 
 suite('scalar functions', () => {
@@ -252,6 +255,27 @@ suite('scalar functions', () => {
       ).rejects.toThrow('my_error');
     });
   });
+  test('error handling (rejection in async main func)', async () => {
+    await withConnection(async (connection) => {
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.scalar_function_set_return_type(scalar_function, varchar_type);
+      duckdb.scalar_function_set_function(
+        scalar_function,
+        async (_info, _input, _output) => {
+          await sleep(1);
+          throw new Error('my_async_error');
+        },
+      );
+      duckdb.register_scalar_function(connection, scalar_function);
+      duckdb.destroy_scalar_function_sync(scalar_function);
+
+      await expect(
+        duckdb.query(connection, 'select my_func()'),
+      ).rejects.toThrow('my_async_error');
+    });
+  });
   test('error handling (exception in bind func)', async () => {
     await withConnection(async (connection) => {
       const scalar_function = duckdb.create_scalar_function();
@@ -298,6 +322,248 @@ suite('scalar functions', () => {
       ).rejects.toThrow('my_bind_error');
     });
   });
+  test('bind fn w/ argument expressions', async () => {
+    await withConnection(async (connection) => {
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const integer_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.scalar_function_add_parameter(scalar_function, integer_type);
+      duckdb.scalar_function_add_parameter(scalar_function, varchar_type);
+      duckdb.scalar_function_set_return_type(scalar_function, varchar_type);
+      const seen: unknown[] = [];
+      duckdb.scalar_function_set_bind(scalar_function, (info) => {
+        seen.push(duckdb.scalar_function_bind_get_argument_count(info));
+        const column_arg = duckdb.scalar_function_bind_get_argument(info, 0);
+        const literal_arg = duckdb.scalar_function_bind_get_argument(info, 1);
+        seen.push(duckdb.expression_is_foldable(column_arg));
+        seen.push(duckdb.expression_is_foldable(literal_arg));
+        seen.push(
+          duckdb.get_type_id(duckdb.expression_return_type(literal_arg)),
+        );
+        const client_context = duckdb.scalar_function_get_client_context(info);
+        const folded = duckdb.expression_fold(client_context, literal_arg);
+        duckdb.scalar_function_set_bind_data(info, {
+          'suffix': duckdb.get_varchar(folded),
+        });
+      });
+      duckdb.scalar_function_set_function(
+        scalar_function,
+        (info, input, output) => {
+          const bind_data = duckdb.scalar_function_get_bind_data(info) as {
+            suffix: string;
+          };
+          const rowCount = duckdb.data_chunk_get_size(input);
+          for (let i = 0; i < rowCount; i++) {
+            duckdb.vector_assign_string_element(
+              output,
+              i,
+              `output_${i}_${bind_data.suffix}`,
+            );
+          }
+        },
+      );
+      duckdb.register_scalar_function(connection, scalar_function);
+      duckdb.destroy_scalar_function_sync(scalar_function);
+
+      const result = await duckdb.query(
+        connection,
+        "select my_func(i::integer, 'a' || 'b') as r from range(1) t(i)",
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [
+          { name: 'r', logicalType: { typeId: duckdb.Type.VARCHAR } },
+        ],
+        chunks: [
+          {
+            rowCount: 1,
+            vectors: [data(16, [true], ['output_0_ab'])],
+          },
+        ],
+      });
+      expect(seen).toStrictEqual([2, false, true, duckdb.Type.VARCHAR]);
+    });
+  });
+  test('register & run (init fn w/ state)', async () => {
+    await withConnection(async (connection) => {
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.scalar_function_set_return_type(scalar_function, varchar_type);
+      duckdb.scalar_function_set_extra_info(scalar_function, { 'prefix': 'p' });
+      duckdb.scalar_function_set_bind(scalar_function, (info) => {
+        duckdb.scalar_function_set_bind_data(info, { 'suffix': 's' });
+      });
+      let init_count = 0;
+      duckdb.scalar_function_set_init(scalar_function, (info) => {
+        init_count++;
+        const extra_info = duckdb.scalar_function_init_get_extra_info(info) as {
+          prefix: string;
+        };
+        const bind_data = duckdb.scalar_function_init_get_bind_data(info) as {
+          suffix: string;
+        };
+        duckdb.scalar_function_init_set_state(info, {
+          'label': `${extra_info.prefix}_${bind_data.suffix}`,
+          'calls': 0,
+        });
+      });
+      duckdb.scalar_function_set_function(
+        scalar_function,
+        (info, input, output) => {
+          const state = duckdb.scalar_function_get_state(info) as {
+            label: string;
+            calls: number;
+          };
+          state.calls++;
+          const rowCount = duckdb.data_chunk_get_size(input);
+          for (let i = 0; i < rowCount; i++) {
+            duckdb.vector_assign_string_element(
+              output,
+              i,
+              `${state.label}_${state.calls}`,
+            );
+          }
+        },
+      );
+      duckdb.register_scalar_function(connection, scalar_function);
+      duckdb.destroy_scalar_function_sync(scalar_function);
+
+      const result = await duckdb.query(connection, 'select my_func()');
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [
+          { name: 'my_func()', logicalType: { typeId: duckdb.Type.VARCHAR } },
+        ],
+        chunks: [
+          {
+            rowCount: 1,
+            vectors: [data(16, [true], ['p_s_1'])],
+          },
+        ],
+      });
+      expect(init_count).toBe(1);
+    });
+  });
+  test('error handling (set error in init func)', async () => {
+    await withConnection(async (connection) => {
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.scalar_function_set_return_type(scalar_function, varchar_type);
+      duckdb.scalar_function_set_init(scalar_function, (info) => {
+        duckdb.scalar_function_init_set_error(info, 'my_init_error');
+      });
+      duckdb.scalar_function_set_function(
+        scalar_function,
+        (_info, _input, _output) => {
+          throw new Error('my_error');
+        },
+      );
+      duckdb.register_scalar_function(connection, scalar_function);
+      duckdb.destroy_scalar_function_sync(scalar_function);
+
+      await expect(
+        duckdb.query(connection, 'select my_func()'),
+      ).rejects.toThrow('my_init_error');
+    });
+  });
+  test('async main func', async () => {
+    await withConnection(async (connection) => {
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.scalar_function_set_return_type(scalar_function, varchar_type);
+      duckdb.scalar_function_set_function(
+        scalar_function,
+        async (_info, input, output) => {
+          const rowCount = duckdb.data_chunk_get_size(input);
+          // The output is written after the JS thread has gone back to the
+          // event loop, so DuckDB must still be waiting.
+          await sleep(10);
+          for (let i = 0; i < rowCount; i++) {
+            duckdb.vector_assign_string_element(output, i, `async_${i}`);
+          }
+        },
+      );
+      duckdb.register_scalar_function(connection, scalar_function);
+      duckdb.destroy_scalar_function_sync(scalar_function);
+
+      const result = await duckdb.query(connection, 'select my_func()');
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [
+          { name: 'my_func()', logicalType: { typeId: duckdb.Type.VARCHAR } },
+        ],
+        chunks: [
+          { rowCount: 1, vectors: [data(16, [true], ['async_0'])] },
+        ],
+      });
+    });
+  });
+  test('deduplicate inputs', async () => {
+    await withConnection(async (connection) => {
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.scalar_function_add_parameter(scalar_function, int_type);
+      duckdb.scalar_function_set_return_type(scalar_function, varchar_type);
+      const row_counts: number[] = [];
+      duckdb.scalar_function_set_function(
+        scalar_function,
+        (_info, input, output) => {
+          const rowCount = duckdb.data_chunk_get_size(input);
+          row_counts.push(rowCount);
+          const vec0 = duckdb.data_chunk_get_vector(input, 0);
+          const data0 = duckdb.vector_get_data(vec0, rowCount * 4);
+          const dv0 = new DataView(data0.buffer);
+          for (let i = 0; i < rowCount; i++) {
+            duckdb.vector_assign_string_element(
+              output,
+              i,
+              `output_${dv0.getInt32(i * 4, true)}`,
+            );
+          }
+        },
+      );
+      duckdb.scalar_function_set_deduplicate_inputs(scalar_function, true);
+      duckdb.register_scalar_function(connection, scalar_function);
+      duckdb.destroy_scalar_function_sync(scalar_function);
+
+      const result = await duckdb.query(
+        connection,
+        'select my_func((i % 2)::integer) as my_func_result from range(4) t(i)',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 4,
+        columns: [
+          {
+            name: 'my_func_result',
+            logicalType: { typeId: duckdb.Type.VARCHAR },
+          },
+        ],
+        chunks: [
+          {
+            rowCount: 4,
+            vectors: [
+              data(
+                16,
+                [true, true, true, true],
+                ['output_0', 'output_1', 'output_0', 'output_1'],
+              ),
+            ],
+          },
+        ],
+      });
+      expect(row_counts).toStrictEqual([2]);
+    });
+  });
   test('parameters (fixed, volatile)', async () => {
     await withConnection(async (connection) => {
       const scalar_function = duckdb.create_scalar_function();
@@ -631,4 +897,140 @@ suite('scalar functions', () => {
       });
     });
   });
+  test('register & run (set)', async () => {
+    await withConnection(async (connection) => {
+      const createOverload = (type: duckdb.Type) => {
+        const scalar_function = duckdb.create_scalar_function();
+        duckdb.scalar_function_set_name(scalar_function, 'my_func');
+        duckdb.scalar_function_add_parameter(
+          scalar_function,
+          duckdb.create_logical_type(type),
+        );
+        const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+        duckdb.scalar_function_set_return_type(scalar_function, varchar_type);
+        duckdb.scalar_function_set_extra_info(scalar_function, {
+          type: duckdb.Type[type],
+        });
+        duckdb.scalar_function_set_function(
+          scalar_function,
+          (info, input, output) => {
+            const { type } = duckdb.scalar_function_get_extra_info(info) as {
+              type: string;
+            };
+            const rowCount = duckdb.data_chunk_get_size(input);
+            for (let i = 0; i < rowCount; i++) {
+              duckdb.vector_assign_string_element(output, i, type);
+            }
+          },
+        );
+        return scalar_function;
+      };
+      const scalar_function_set = duckdb.create_scalar_function_set('my_func');
+      duckdb.add_scalar_function_to_set(
+        scalar_function_set,
+        createOverload(duckdb.Type.INTEGER),
+      );
+      duckdb.add_scalar_function_to_set(
+        scalar_function_set,
+        createOverload(duckdb.Type.VARCHAR),
+      );
+      duckdb.register_scalar_function_set(connection, scalar_function_set);
+
+      const result = await duckdb.query(
+        connection,
+        `select my_func(1) as i, my_func('a') as v`,
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [
+          { name: 'i', logicalType: { typeId: duckdb.Type.VARCHAR } },
+          { name: 'v', logicalType: { typeId: duckdb.Type.VARCHAR } },
+        ],
+        chunks: [
+          {
+            rowCount: 1,
+            vectors: [
+              data(16, [true], ['INTEGER']),
+              data(16, [true], ['VARCHAR']),
+            ],
+          },
+        ],
+      });
+    });
+  });
+  test('set with duplicate overload', () => {
+    const createOverload = () => {
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+      duckdb.scalar_function_add_parameter(scalar_function, int_type);
+      duckdb.scalar_function_set_return_type(scalar_function, int_type);
+      return scalar_function;
+    };
+    const scalar_function_set = duckdb.create_scalar_function_set('my_func');
+    duckdb.add_scalar_function_to_set(scalar_function_set, createOverload());
+    expect(() =>
+      duckdb.add_scalar_function_to_set(scalar_function_set, createOverload()),
+    ).toThrowError('Failed to add scalar function to set');
+  });
+  test('native main function', async () => {
+    await withConnection(async (connection) => {
+      const library = duckdb.load_native_library(nativeFunctionsFixturePath);
+      const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_native_add');
+      duckdb.scalar_function_add_parameter(scalar_function, int_type);
+      duckdb.scalar_function_add_parameter(scalar_function, int_type);
+      duckdb.scalar_function_set_return_type(scalar_function, int_type);
+      duckdb.scalar_function_set_native_function(
+        scalar_function,
+        library,
+        'my_native_add',
+      );
+      duckdb.register_scalar_function(connection, scalar_function);
+
+      const result = await duckdb.query(
+        connection,
+        'select my_native_add(a, b) as s from (values (1, 2), (40, null), (20, 22)) t(a, b)',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 3,
+        columns: [{ name: 's', logicalType: INTEGER }],
+        chunks: [
+          {
+            rowCount: 3,
+            vectors: [data(4, [true, false, true], [3, null, 42])],
+          },
+        ],
+      });
+    });
+  });
+  test('native symbol not found', () => {
+    const library = duckdb.load_native_library(nativeFunctionsFixturePath);
+    const scalar_function = duckdb.create_scalar_function();
+    expect(() =>
+      duckdb.scalar_function_set_native_function(
+        scalar_function,
+        library,
+        'my_missing_function',
+      ),
+    ).toThrowError('Symbol not found in native library: my_missing_function');
+  });
+  test('native library not found', () => {
+    expect(() =>
+      duckdb.load_native_library('/nonexistent/libmy_udfs.so'),
+    ).toThrowError(/^Failed to load native library: /);
+  });
+  test('native function with invalid library argument', () => {
+    const scalar_function = duckdb.create_scalar_function();
+    expect(() =>
+      duckdb.scalar_function_set_native_function(
+        scalar_function,
+        scalar_function as unknown as duckdb.NativeLibrary,
+        'my_func',
+      ),
+    ).toThrowError('Invalid native library argument');
+  });
 });
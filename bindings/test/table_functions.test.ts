@@ -1,7 +1,9 @@
 import duckdb from '@duckdb/node-bindings';
 import { expect, suite, test } from 'vitest';
+import { BIGINT } from './utils/expectedLogicalTypes';
 import { data } from './utils/expectedVectors';
 import { expectResult } from './utils/expectResult';
+import { nativeFunctionsFixturePath } from './utils/nativeFunctionsFixture';
 import { withConnection } from './utils/withConnection';
 import { withDatabase } from './utils/withDatabase';
 
@@ -617,6 +619,147 @@ suite('table functions', () => {
     });
   });
 
+  test('chunk queue', async () => {
+    await withConnection(async (connection) => {
+      const table_function = duckdb.create_table_function();
+      duckdb.table_function_set_name(table_function, 'my_func');
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.table_function_set_bind(table_function, (info) => {
+        duckdb.bind_add_result_column(info, 'my_column', varchar_type);
+      });
+      duckdb.table_function_set_init(table_function, (info) => {
+        // Room for one chunk, so the producer has to wait for the scan.
+        const queue = duckdb.create_table_function_chunk_queue(1);
+        duckdb.init_set_chunk_queue(info, queue);
+        void (async () => {
+          for (const value of ['a', 'b', 'c']) {
+            const chunk = duckdb.create_data_chunk([varchar_type]);
+            duckdb.data_chunk_set_size(chunk, 1);
+            const vector = duckdb.data_chunk_get_vector(chunk, 0);
+            duckdb.vector_assign_string_element(vector, 0, value);
+            await duckdb.table_function_chunk_queue_push(queue, chunk);
+          }
+          duckdb.table_function_chunk_queue_close(queue);
+        })();
+      });
+      duckdb.table_function_set_chunk_queue_function(table_function);
+      duckdb.register_table_function(connection, table_function);
+      duckdb.destroy_table_function_sync(table_function);
+
+      const result = await duckdb.query(
+        connection,
+        "select string_agg(my_column, ',' order by my_column) as s from my_func()",
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 's', logicalType: { typeId: duckdb.Type.VARCHAR } }],
+        chunks: [{ rowCount: 1, vectors: [data(16, [true], ['a,b,c'])] }],
+      });
+    });
+  });
+
+  test('chunk queue (error)', async () => {
+    await withConnection(async (connection) => {
+      const table_function = duckdb.create_table_function();
+      duckdb.table_function_set_name(table_function, 'my_func');
+      duckdb.table_function_set_bind(table_function, (info) => {
+        const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+        duckdb.bind_add_result_column(info, 'my_column', varchar_type);
+      });
+      duckdb.table_function_set_init(table_function, (info) => {
+        const queue = duckdb.create_table_function_chunk_queue(1);
+        duckdb.init_set_chunk_queue(info, queue);
+        setTimeout(() => {
+          duckdb.table_function_chunk_queue_close(queue, 'my_producer_error');
+        }, 0);
+      });
+      duckdb.table_function_set_chunk_queue_function(table_function);
+      duckdb.register_table_function(connection, table_function);
+      duckdb.destroy_table_function_sync(table_function);
+
+      await expect(
+        duckdb.query(connection, 'select * from my_func()'),
+      ).rejects.toThrow('my_producer_error');
+    });
+  });
+
+  test('chunk queue (wrong type)', async () => {
+    const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+    const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+    // Each pair has the same type id, but a different layout.
+    const cases: [duckdb.LogicalType, duckdb.LogicalType][] = [
+      [duckdb.create_decimal_type(4, 1), duckdb.create_decimal_type(18, 2)],
+      [
+        duckdb.create_list_type(int_type),
+        duckdb.create_list_type(varchar_type),
+      ],
+    ];
+    for (const [scan_type, chunk_type] of cases) {
+      await withConnection(async (connection) => {
+        const table_function = duckdb.create_table_function();
+        duckdb.table_function_set_name(table_function, 'my_func');
+        duckdb.table_function_set_bind(table_function, (info) => {
+          duckdb.bind_add_result_column(info, 'my_column', scan_type);
+        });
+        duckdb.table_function_set_init(table_function, (info) => {
+          const queue = duckdb.create_table_function_chunk_queue(1);
+          duckdb.init_set_chunk_queue(info, queue);
+          void (async () => {
+            const chunk = duckdb.create_data_chunk([chunk_type]);
+            duckdb.data_chunk_set_size(chunk, 1);
+            await duckdb.table_function_chunk_queue_push(queue, chunk);
+            duckdb.table_function_chunk_queue_close(queue);
+          })();
+        });
+        duckdb.table_function_set_chunk_queue_function(table_function);
+        duckdb.register_table_function(connection, table_function);
+        duckdb.destroy_table_function_sync(table_function);
+
+        await expect(
+          duckdb.query(connection, 'select * from my_func()'),
+        ).rejects.toThrow('Queued chunk column 0 has the wrong type');
+      });
+    }
+  });
+
+  test('chunk queue (scan ends before producer)', async () => {
+    await withConnection(async (connection) => {
+      const table_function = duckdb.create_table_function();
+      duckdb.table_function_set_name(table_function, 'my_func');
+      const varchar_type = duckdb.create_logical_type(duckdb.Type.VARCHAR);
+      duckdb.table_function_set_bind(table_function, (info) => {
+        duckdb.bind_add_result_column(info, 'my_column', varchar_type);
+      });
+      let stopped: Promise<number> | undefined;
+      duckdb.table_function_set_init(table_function, (info) => {
+        const queue = duckdb.create_table_function_chunk_queue(2);
+        duckdb.init_set_chunk_queue(info, queue);
+        stopped = (async () => {
+          // Never closes; pushes until the queue reports the scan is over.
+          let pushed = 0;
+          for (;;) {
+            const chunk = duckdb.create_data_chunk([varchar_type]);
+            duckdb.data_chunk_set_size(chunk, 1);
+            const vector = duckdb.data_chunk_get_vector(chunk, 0);
+            duckdb.vector_assign_string_element(vector, 0, `row_${pushed}`);
+            pushed++;
+            if (!(await duckdb.table_function_chunk_queue_push(queue, chunk))) {
+              return pushed;
+            }
+          }
+        })();
+      });
+      duckdb.table_function_set_chunk_queue_function(table_function);
+      duckdb.register_table_function(connection, table_function);
+      duckdb.destroy_table_function_sync(table_function);
+
+      await duckdb.query(connection, 'select * from my_func() limit 1');
+      expect(stopped).toBeDefined();
+      expect(await stopped).toBeGreaterThan(0);
+    });
+  });
+
   test('a scan can be interrupted', async () => {
     await withConnection(async (connection) => {
       let calls = 0;
@@ -640,4 +783,126 @@ suite('table functions', () => {
       expect(calls).toBeGreaterThanOrEqual(3);
     });
   });
+
+  test('typed array columns', async () => {
+    await withConnection(async (connection) => {
+      // Spans several vectors, so the scan claims more than one range of rows.
+      const row_count = 5000;
+      const i = new Int32Array(row_count);
+      const d = new Float64Array(row_count);
+      const name_offsets = new Uint32Array(row_count + 1);
+      const name_null_mask = new Uint8Array(row_count);
+      for (let row = 0; row < row_count; row++) {
+        i[row] = row;
+        d[row] = row / 2;
+        // Even rows are 'x', odd rows are NULL.
+        name_offsets[row + 1] = name_offsets[row] + (row % 2 === 0 ? 1 : 0);
+        name_null_mask[row] = row % 2;
+      }
+      const name_data = new Uint8Array(row_count / 2).fill(0x78);
+      const table_function = duckdb.create_table_function();
+      duckdb.table_function_set_name(table_function, 'my_func');
+      duckdb.table_function_set_typed_array_columns(table_function, [
+        { name: 'i', data: i },
+        { name: 'd', data: d },
+        {
+          name: 'name',
+          data: name_data,
+          offsets: name_offsets,
+          null_mask: name_null_mask,
+        },
+      ]);
+      duckdb.register_table_function(connection, table_function);
+      duckdb.destroy_table_function_sync(table_function);
+
+      const result = await duckdb.query(
+        connection,
+        "select concat_ws(',', count(*), sum(i), sum(d), count(name)) as s from my_func()",
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 's', logicalType: { typeId: duckdb.Type.VARCHAR } }],
+        chunks: [
+          {
+            rowCount: 1,
+            vectors: [data(16, [true], ['5000,12497500,6248750.0,2500'])],
+          },
+        ],
+      });
+      const projected = await duckdb.query(
+        connection,
+        'select name from my_func() where i = 4000',
+      );
+      await expectResult(projected, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [
+          { name: 'name', logicalType: { typeId: duckdb.Type.VARCHAR } },
+        ],
+        chunks: [{ rowCount: 1, vectors: [data(16, [true], ['x'])] }],
+      });
+    });
+  });
+
+  test('typed array columns must have the same row count', () => {
+    const table_function = duckdb.create_table_function();
+    expect(() =>
+      duckdb.table_function_set_typed_array_columns(table_function, [
+        { name: 'a', data: new Int32Array(2) },
+        { name: 'b', data: new Float64Array(3) },
+      ]),
+    ).toThrow('Typed array columns have different row counts');
+  });
+  test('native callbacks', async () => {
+    await withConnection(async (connection) => {
+      const library = duckdb.load_native_library(nativeFunctionsFixturePath);
+      const table_function = duckdb.create_table_function();
+      duckdb.table_function_set_name(table_function, 'my_native_range');
+      duckdb.table_function_add_parameter(
+        table_function,
+        duckdb.create_logical_type(duckdb.Type.BIGINT),
+      );
+      duckdb.table_function_set_native_bind(
+        table_function,
+        library,
+        'my_native_range_bind',
+      );
+      duckdb.table_function_set_native_init(
+        table_function,
+        library,
+        'my_native_range_init',
+      );
+      duckdb.table_function_set_native_function(
+        table_function,
+        library,
+        'my_native_range',
+      );
+      duckdb.register_table_function(connection, table_function);
+
+      const result = await duckdb.query(
+        connection,
+        'select * from my_native_range(3)',
+      );
+      await expectResult(result, {
+        chunkCount: 1,
+        rowCount: 3,
+        columns: [{ name: 'i', logicalType: BIGINT }],
+        chunks: [
+          { rowCount: 3, vectors: [data(8, [true, true, true], [0n, 1n, 2n])] },
+        ],
+      });
+
+      const sumResult = await duckdb.query(
+        connection,
+        'select sum(i)::bigint as s from my_native_range(5000)',
+      );
+      await expectResult(sumResult, {
+        chunkCount: 1,
+        rowCount: 1,
+        columns: [{ name: 's', logicalType: BIGINT }],
+        chunks: [{ rowCount: 1, vectors: [data(8, [true], [12497500n])] }],
+      });
+    });
+  });
 });
@@ -0,0 +1,9 @@
+import { fileURLToPath } from 'node:url';
+
+/** Built by binding.gyp from fixtures/native_functions.c. */
+export const nativeFunctionsFixturePath = fileURLToPath(
+  new URL(
+    `../../build/Release/native_functions_fixture.${process.platform === 'win32' ? 'dll' : 'so'}`,
+    import.meta.url,
+  ),
+);
@@ -1,6 +1,10 @@
+import duckdb from '@duckdb/node-bindings';
 import { createRequire } from 'node:module';
 import { Worker } from 'node:worker_threads';
 import { expect, suite, test } from 'vitest';
+import { data } from './utils/expectedVectors';
+import { expectResult } from './utils/expectResult';
+import { withConnection } from './utils/withConnection';
 
 // Worker threads are the only place an env is ever torn down for real: Node skips
 // instance data finalizers for the main env at process exit. So this is the only
@@ -77,6 +81,79 @@ const worker_source = `
   });
 `;
 
+// Each pool worker attaches a function that doubles its INTEGER input, then
+// serves calls until told to detach, at which point it reports how many calls it
+// served and, with nothing left keeping it alive, exits.
+const pool_worker_source = `
+  const { parentPort, workerData } = require('node:worker_threads');
+  const duckdb = require(workerData.bindings_path);
+  let calls = 0;
+  duckdb.scalar_function_worker_pool_attach(workerData.pool_id, (input, output) => {
+    calls++;
+    const rowCount = duckdb.data_chunk_get_size(input);
+    const inputData = duckdb.vector_get_data(
+      duckdb.data_chunk_get_vector(input, 0),
+      rowCount * 4,
+    );
+    const inputValues = new Int32Array(inputData.buffer, inputData.byteOffset, rowCount);
+    const outputValues = inputValues.map((value) => value * 2);
+    duckdb.copy_data_to_vector(output, 0, outputValues.buffer, 0, outputValues.byteLength);
+  });
+  parentPort.on('message', () => {
+    duckdb.scalar_function_worker_pool_detach(workerData.pool_id);
+    parentPort.postMessage({ calls });
+    parentPort.close();
+  });
+  parentPort.postMessage({ attached: true });
+`;
+
+const pool_worker_count = 2;
+const pool_chunks_per_query = 5; // range(10000) at a vector size of 2048
+
+// Each table pool worker emits the integers of the partitions it claims, one
+// chunk per call, keeping its position in the current partition as the scan
+// thread's state.
+const table_pool_worker_source = `
+  const { parentPort, workerData } = require('node:worker_threads');
+  const duckdb = require(workerData.bindings_path);
+  let calls = 0;
+  duckdb.table_function_worker_pool_attach(workerData.pool_id, (scan, output) => {
+    calls++;
+    const { partitions, rows_per_partition } = JSON.parse(
+      duckdb.table_function_worker_scan_get_data(scan),
+    );
+    let state = duckdb.table_function_worker_scan_get_state(scan);
+    if (!state || state.next >= state.end) {
+      const partition = duckdb.table_function_worker_scan_next_partition(scan);
+      if (partition >= partitions) {
+        duckdb.data_chunk_set_size(output, 0);
+        return;
+      }
+      state = {
+        next: partition * rows_per_partition,
+        end: (partition + 1) * rows_per_partition,
+      };
+      duckdb.table_function_worker_scan_set_state(scan, state);
+    }
+    const count = Math.min(state.end - state.next, duckdb.vector_size());
+    const values = Int32Array.from({ length: count }, (_, i) => state.next + i);
+    duckdb.copy_data_to_vector(
+      duckdb.data_chunk_get_vector(output, 0), 0, values.buffer, 0, values.byteLength,
+    );
+    duckdb.data_chunk_set_size(output, count);
+    state.next += count;
+  });
+  parentPort.on('message', () => {
+    duckdb.table_function_worker_pool_detach(workerData.pool_id);
+    parentPort.postMessage({ calls });
+    parentPort.close();
+  });
+  parentPort.postMessage({ attached: true });
+`;
+
+const table_pool_partitions = 6;
+const table_pool_rows_per_partition = 3000;
+
 interface WorkerOutcome {
   calls?: number;
   error?: string;
@@ -163,4 +240,226 @@ suite('worker threads', () => {
     },
     testTimeoutMs,
   );
+
+  test(
+    'scalar function worker pools run calls in workers',
+    async () => {
+      await withConnection(async (connection) => {
+        const pool = duckdb.create_scalar_function_worker_pool();
+        const pool_id = duckdb.scalar_function_worker_pool_get_id(pool);
+        const workers = Array.from(
+          { length: pool_worker_count },
+          () =>
+            new Worker(pool_worker_source, {
+              eval: true,
+              workerData: { bindings_path, pool_id },
+            }),
+        );
+        try {
+          await Promise.all(
+            workers.map(
+              (worker) =>
+                new Promise<void>((resolve, reject) => {
+                  worker.once('message', () => resolve());
+                  worker.once('error', reject);
+                }),
+            ),
+          );
+
+          const scalar_function = duckdb.create_scalar_function();
+          duckdb.scalar_function_set_name(scalar_function, 'double_it');
+          const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+          duckdb.scalar_function_add_parameter(scalar_function, int_type);
+          duckdb.scalar_function_set_return_type(scalar_function, int_type);
+          duckdb.scalar_function_set_worker_pool(scalar_function, pool);
+          duckdb.register_scalar_function(connection, scalar_function);
+          duckdb.destroy_scalar_function_sync(scalar_function);
+
+          const result = await duckdb.query(
+            connection,
+            'select sum(double_it(i::integer))::varchar as total from range(10000) t(i)',
+          );
+          await expectResult(result, {
+            chunkCount: 1,
+            rowCount: 1,
+            columns: [
+              { name: 'total', logicalType: { typeId: duckdb.Type.VARCHAR } },
+            ],
+            chunks: [
+              { rowCount: 1, vectors: [data(16, [true], ['99990000'])] },
+            ],
+          });
+
+          const outcomes = await Promise.all(
+            workers.map(
+              (worker) =>
+                new Promise<WorkerOutcome>((resolve, reject) => {
+                  let outcome: WorkerOutcome | undefined;
+                  worker.on('message', (m: WorkerOutcome) => {
+                    outcome = m;
+                  });
+                  worker.once('error', reject);
+                  // As above, a detached worker has to actually exit.
+                  worker.once('exit', () =>
+                    resolve(outcome ?? { error: 'worker sent no message' }),
+                  );
+                  worker.postMessage('detach');
+                }),
+            ),
+          );
+          let calls = 0;
+          for (const outcome of outcomes) {
+            expect(outcome.error).toBeUndefined();
+            calls += outcome.calls ?? 0;
+          }
+          expect(calls).toBe(pool_chunks_per_query);
+        } finally {
+          for (const worker of workers) {
+            void worker.terminate();
+          }
+        }
+      });
+    },
+    testTimeoutMs,
+  );
+  test('scalar function worker pools fail calls when no worker is attached', async () => {
+    await withConnection(async (connection) => {
+      const pool = duckdb.create_scalar_function_worker_pool();
+      const scalar_function = duckdb.create_scalar_function();
+      duckdb.scalar_function_set_name(scalar_function, 'my_func');
+      const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+      duckdb.scalar_function_set_return_type(scalar_function, int_type);
+      duckdb.scalar_function_set_worker_pool(scalar_function, pool);
+      duckdb.register_scalar_function(connection, scalar_function);
+      duckdb.destroy_scalar_function_sync(scalar_function);
+
+      await expect(
+        duckdb.query(connection, 'select my_func()'),
+      ).rejects.toThrow('No workers attached to scalar function worker pool');
+    });
+  });
+
+  test(
+    'table function worker pools run scans in workers',
+    async () => {
+      await withConnection(async (connection) => {
+        const pool = duckdb.create_table_function_worker_pool();
+        const pool_id = duckdb.table_function_worker_pool_get_id(pool);
+        const workers = Array.from(
+          { length: pool_worker_count },
+          () =>
+            new Worker(table_pool_worker_source, {
+              eval: true,
+              workerData: { bindings_path, pool_id },
+            }),
+        );
+        try {
+          await Promise.all(
+            workers.map(
+              (worker) =>
+                new Promise<void>((resolve, reject) => {
+                  worker.once('message', () => resolve());
+                  worker.once('error', reject);
+                }),
+            ),
+          );
+
+          const table_function = duckdb.create_table_function();
+          duckdb.table_function_set_name(table_function, 'partitioned');
+          duckdb.table_function_set_bind(table_function, (info) => {
+            const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+            duckdb.bind_add_result_column(info, 'i', int_type);
+          });
+          duckdb.table_function_set_init(table_function, (info) => {
+            duckdb.init_set_max_threads(info, pool_worker_count);
+            duckdb.init_set_worker_scan_data(
+              info,
+              JSON.stringify({
+                partitions: table_pool_partitions,
+                rows_per_partition: table_pool_rows_per_partition,
+              }),
+            );
+          });
+          duckdb.table_function_set_worker_pool(table_function, pool);
+          duckdb.register_table_function(connection, table_function);
+          duckdb.destroy_table_function_sync(table_function);
+
+          const result = await duckdb.query(
+            connection,
+            'select count(*)::varchar as n, sum(i)::varchar as total from partitioned()',
+          );
+          const row_count = table_pool_partitions * table_pool_rows_per_partition;
+          await expectResult(result, {
+            chunkCount: 1,
+            rowCount: 1,
+            columns: [
+              { name: 'n', logicalType: { typeId: duckdb.Type.VARCHAR } },
+              { name: 'total', logicalType: { typeId: duckdb.Type.VARCHAR } },
+            ],
+            chunks: [
+              {
+                rowCount: 1,
+                vectors: [
+                  data(16, [true], [String(row_count)]),
+                  data(16, [true], [String((row_count * (row_count - 1)) / 2)]),
+                ],
+              },
+            ],
+          });
+
+          const outcomes = await Promise.all(
+            workers.map(
+              (worker) =>
+                new Promise<WorkerOutcome>((resolve, reject) => {
+                  let outcome: WorkerOutcome | undefined;
+                  worker.on('message', (m: WorkerOutcome) => {
+                    outcome = m;
+                  });
+                  worker.once('error', reject);
+                  worker.once('exit', () =>
+                    resolve(outcome ?? { error: 'worker sent no message' }),
+                  );
+                  worker.postMessage('detach');
+                }),
+            ),
+          );
+          let calls = 0;
+          for (const outcome of outcomes) {
+            expect(outcome.error).toBeUndefined();
+            calls += outcome.calls ?? 0;
+          }
+          // Every chunk of every partition, plus at least one final call per
+          // scan thread that finds no partition left.
+          const chunks_per_partition = Math.ceil(
+            table_pool_rows_per_partition / duckdb.vector_size(),
+          );
+          expect(calls).toBeGreaterThan(table_pool_partitions * chunks_per_partition);
+        } finally {
+          for (const worker of workers) {
+            void worker.terminate();
+          }
+        }
+      });
+    },
+    testTimeoutMs,
+  );
+  test('table function worker pools fail scans when no worker is attached', async () => {
+    await withConnection(async (connection) => {
+      const pool = duckdb.create_table_function_worker_pool();
+      const table_function = duckdb.create_table_function();
+      duckdb.table_function_set_name(table_function, 'my_func');
+      duckdb.table_function_set_bind(table_function, (info) => {
+        const int_type = duckdb.create_logical_type(duckdb.Type.INTEGER);
+        duckdb.bind_add_result_column(info, 'i', int_type);
+      });
+      duckdb.table_function_set_init(table_function, () => {});
+      duckdb.table_function_set_worker_pool(table_function, pool);
+      duckdb.register_table_function(connection, table_function);
+      duckdb.destroy_table_function_sync(table_function);
+
+      await expect(
+        duckdb.query(connection, 'select * from my_func()'),
+      ).rejects.toThrow('No workers attached to table function worker pool');
+    });
+  });
 });